@@ -412,10 +412,14 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/hpack_parse_result.h",
         "src/core/ext/transport/chttp2/transport/hpack_parser.cc",
         "src/core/ext/transport/chttp2/transport/hpack_parser.h",
+        "src/core/ext/transport/chttp2/transport/hpack_parser_interner.cc",
+        "src/core/ext/transport/chttp2/transport/hpack_parser_interner.h",
         "src/core/ext/transport/chttp2/transport/hpack_parser_table.cc",
         "src/core/ext/transport/chttp2/transport/hpack_parser_table.h",
         "src/core/ext/transport/chttp2/transport/http2_client_transport.cc",
         "src/core/ext/transport/chttp2/transport/http2_client_transport.h",
+        "src/core/ext/transport/chttp2/transport/http2_server_transport.cc",
+        "src/core/ext/transport/chttp2/transport/http2_server_transport.h",
         "src/core/ext/transport/chttp2/transport/http2_settings.cc",
         "src/core/ext/transport/chttp2/transport/http2_settings.h",
         "src/core/ext/transport/chttp2/transport/http2_settings_manager.cc",
@@ -435,6 +439,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/legacy_frame.h",
         "src/core/ext/transport/chttp2/transport/message_assembler.h",
         "src/core/ext/transport/chttp2/transport/parsing.cc",
+        "src/core/ext/transport/chttp2/transport/phase_accounting.cc",
+        "src/core/ext/transport/chttp2/transport/phase_accounting.h",
         "src/core/ext/transport/chttp2/transport/ping_abuse_policy.cc",
         "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h",
         "src/core/ext/transport/chttp2/transport/ping_callbacks.cc",
@@ -449,6 +455,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/transport_common.h",
         "src/core/ext/transport/chttp2/transport/varint.cc",
         "src/core/ext/transport/chttp2/transport/varint.h",
+        "src/core/ext/transport/chttp2/transport/write_deficit.cc",
+        "src/core/ext/transport/chttp2/transport/write_deficit.h",
         "src/core/ext/transport/chttp2/transport/write_size_policy.cc",
         "src/core/ext/transport/chttp2/transport/write_size_policy.h",
         "src/core/ext/transport/chttp2/transport/writing.cc",
@@ -1370,6 +1378,7 @@ let package = Package(
         "src/core/lib/event_engine/extensions/channelz.h",
         "src/core/lib/event_engine/extensions/chaotic_good_extension.h",
         "src/core/lib/event_engine/extensions/iomgr_compatible.h",
+        "src/core/lib/event_engine/extensions/run_priority.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
         "src/core/lib/event_engine/extensions/supports_win_sockets.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
@@ -1379,8 +1388,12 @@ let package = Package(
         "src/core/lib/event_engine/nameser.h",
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
+        "src/core/lib/event_engine/posix_engine/accept_admission_control.cc",
+        "src/core/lib/event_engine/posix_engine/accept_admission_control.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1418,6 +1431,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc",
@@ -1427,6 +1442,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.cc",
         "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h",
+        "src/core/lib/event_engine/posix_engine/write_latency_sampler.cc",
+        "src/core/lib/event_engine/posix_engine/write_latency_sampler.h",
         "src/core/lib/event_engine/query_extensions.h",
         "src/core/lib/event_engine/ref_counted_dns_resolver_interface.h",
         "src/core/lib/event_engine/resolved_address.cc",
@@ -1439,6 +1456,8 @@ let package = Package(
         "src/core/lib/event_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/thread_local.cc",
         "src/core/lib/event_engine/thread_local.h",
+        "src/core/lib/event_engine/thread_pool/cpu_topology.cc",
+        "src/core/lib/event_engine/thread_pool/cpu_topology.h",
         "src/core/lib/event_engine/thread_pool/thread_count.cc",
         "src/core/lib/event_engine/thread_pool/thread_count.h",
         "src/core/lib/event_engine/thread_pool/thread_pool.h",
@@ -1467,6 +1486,8 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -22,7 +22,11 @@ EXPERIMENT_ENABLES = {
     "channelz_use_v2_for_v1_service": "channelz_use_v2_for_v1_service",
     "chaotic_good_framing_layer": "chaotic_good_framing_layer",
     "chttp2_bound_write_size": "chttp2_bound_write_size",
+    "chttp2_endpoint_aware_write_size": "chttp2_endpoint_aware_write_size",
+    "chttp2_pack_small_messages": "chttp2_pack_small_messages",
+    "chttp2_weighted_fair_writes": "chttp2_weighted_fair_writes",
     "error_flatten": "error_flatten",
+    "event_engine_chase_lev_work_queue": "event_engine_chase_lev_work_queue",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
     "event_engine_dns_non_client_channel": "event_engine_dns_non_client_channel",
@@ -30,9 +34,16 @@ EXPERIMENT_ENABLES = {
     "event_engine_listener": "event_engine_listener",
     "event_engine_callback_cq": "event_engine_callback_cq,event_engine_client,event_engine_listener",
     "event_engine_for_all_other_endpoints": "event_engine_client,event_engine_dns,event_engine_dns_non_client_channel,event_engine_for_all_other_endpoints,event_engine_listener",
+    "event_engine_prioritize_io_callbacks": "event_engine_prioritize_io_callbacks",
     "event_engine_secure_endpoint": "event_engine_secure_endpoint",
+    "event_engine_timer_wheel": "event_engine_timer_wheel",
+    "event_engine_timer_wheel_coarse": "event_engine_timer_wheel,event_engine_timer_wheel_coarse",
     "free_large_allocator": "free_large_allocator",
     "fuse_filters": "fuse_filters",
+    "hpack_adaptive_indexing": "hpack_adaptive_indexing",
+    "hpack_huffman_literals": "hpack_huffman_literals",
+    "hpack_shared_interning": "hpack_shared_interning",
+    "hpack_zero_copy_parsing": "hpack_zero_copy_parsing",
     "keep_alive_ping_timer_batch": "keep_alive_ping_timer_batch",
     "local_connector_secure": "local_connector_secure",
     "max_inflight_pings_strict_limit": "max_inflight_pings_strict_limit",
@@ -81,6 +92,9 @@ EXPERIMENTS = {
             ],
             "core_end2end_test": [
                 "chttp2_bound_write_size",
+                "chttp2_endpoint_aware_write_size",
+                "chttp2_pack_small_messages",
+                "chttp2_weighted_fair_writes",
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
@@ -98,6 +112,7 @@ EXPERIMENTS = {
                 "rr_wrr_connect_from_random_index",
             ],
             "endpoint_test": [
+                "event_engine_prioritize_io_callbacks",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
@@ -107,11 +122,21 @@ EXPERIMENTS = {
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_timer_test": [
+                "event_engine_timer_wheel",
+                "event_engine_timer_wheel_coarse",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_adaptive_indexing",
+                "hpack_huffman_literals",
+                "hpack_shared_interning",
+                "hpack_zero_copy_parsing",
+            ],
             "lb_unit_test": [
                 "rr_wrr_connect_from_random_index",
             ],
@@ -128,6 +153,9 @@ EXPERIMENTS = {
             "secure_endpoint_test": [
                 "pipelined_read_secure_endpoint",
             ],
+            "thread_pool_test": [
+                "event_engine_chase_lev_work_queue",
+            ],
             "xds_end2end_test": [
                 "error_flatten",
             ],
@@ -169,6 +197,9 @@ EXPERIMENTS = {
             ],
             "core_end2end_test": [
                 "chttp2_bound_write_size",
+                "chttp2_endpoint_aware_write_size",
+                "chttp2_pack_small_messages",
+                "chttp2_weighted_fair_writes",
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
@@ -186,6 +217,7 @@ EXPERIMENTS = {
                 "rr_wrr_connect_from_random_index",
             ],
             "endpoint_test": [
+                "event_engine_prioritize_io_callbacks",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
@@ -195,11 +227,21 @@ EXPERIMENTS = {
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_timer_test": [
+                "event_engine_timer_wheel",
+                "event_engine_timer_wheel_coarse",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_adaptive_indexing",
+                "hpack_huffman_literals",
+                "hpack_shared_interning",
+                "hpack_zero_copy_parsing",
+            ],
             "lb_unit_test": [
                 "rr_wrr_connect_from_random_index",
             ],
@@ -216,6 +258,9 @@ EXPERIMENTS = {
             "secure_endpoint_test": [
                 "pipelined_read_secure_endpoint",
             ],
+            "thread_pool_test": [
+                "event_engine_chase_lev_work_queue",
+            ],
             "xds_end2end_test": [
                 "error_flatten",
             ],
@@ -257,6 +302,9 @@ EXPERIMENTS = {
             ],
             "core_end2end_test": [
                 "chttp2_bound_write_size",
+                "chttp2_endpoint_aware_write_size",
+                "chttp2_pack_small_messages",
+                "chttp2_weighted_fair_writes",
                 "error_flatten",
                 "event_engine_fork",
                 "local_connector_secure",
@@ -274,6 +322,7 @@ EXPERIMENTS = {
                 "rr_wrr_connect_from_random_index",
             ],
             "endpoint_test": [
+                "event_engine_prioritize_io_callbacks",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
@@ -283,11 +332,21 @@ EXPERIMENTS = {
             "event_engine_fork_test": [
                 "event_engine_fork",
             ],
+            "event_engine_timer_test": [
+                "event_engine_timer_wheel",
+                "event_engine_timer_wheel_coarse",
+            ],
             "flow_control_test": [
                 "multiping",
                 "tcp_frame_size_tuning",
                 "tcp_rcv_lowat",
             ],
+            "hpack_test": [
+                "hpack_adaptive_indexing",
+                "hpack_huffman_literals",
+                "hpack_shared_interning",
+                "hpack_zero_copy_parsing",
+            ],
             "lb_unit_test": [
                 "rr_wrr_connect_from_random_index",
             ],
@@ -304,6 +363,9 @@ EXPERIMENTS = {
             "secure_endpoint_test": [
                 "pipelined_read_secure_endpoint",
             ],
+            "thread_pool_test": [
+                "event_engine_chase_lev_work_queue",
+            ],
             "xds_end2end_test": [
                 "error_flatten",
             ],
@@ -41,6 +41,15 @@ load("//bazel:test_experiments.bzl", "TEST_EXPERIMENTS", "TEST_EXPERIMENT_ENABLE
 # The set of pollers to test against if a test exercises polling
 POLLERS = ["epoll1", "poll"]
 
+# Pollers that a test exercising polling is only run against if it lists them
+# in extra_pollers, because they only change poller specific paths.
+OPT_IN_POLLERS = ["io_uring"]
+
+# GRPC_POLL_STRATEGY to use for a poller, if it isn't just the poller name.
+# Only the EventEngine knows io_uring: iomgr falls back to epoll1, as does the
+# EventEngine on kernels without io_uring support.
+POLL_STRATEGIES = {"io_uring": "io_uring,epoll1"}
+
 # The set of known EventEngines to test
 EVENT_ENGINES = {"default": {"tags": []}}
 
@@ -313,7 +322,7 @@ def ios_cc_test(
             deps = ios_test_deps,
         )
 
-def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_polling, uses_event_engine, flaky):
+def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, extra_pollers, uses_polling, uses_event_engine, flaky):
     """Common logic used to parameterize tests for every poller and EventEngine.
 
     Used by expand_tests (repeatedly) to form base lists of pollers for each experiment.
@@ -326,6 +335,7 @@ def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_pol
         args: base args
         flaky: base flaky
         exclude_pollers: list of poller names to exclude for this set of tests.
+        extra_pollers: list of OPT_IN_POLLERS to also run this set of tests with.
         uses_polling: set to False if the test is not sensitive to polling methodology.
         uses_event_engine: set to False if the test is not sensitive to
             EventEngine implementation differences
@@ -334,6 +344,10 @@ def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_pol
         A list of dictionaries containing modified values of name, srcs, deps, tags, and args.
     """
 
+    for poller in extra_pollers:
+        if poller not in OPT_IN_POLLERS:
+            fail("unknown opt-in poller: %s" % poller)
+
     poller_config = []
 
     # See work_stealing_thread_pool.cc for details.
@@ -354,7 +368,7 @@ def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_pol
     else:
         # On linux we run the same test with the default EventEngine, once for each
         # poller
-        for poller in POLLERS:
+        for poller in POLLERS + extra_pollers:
             if poller in exclude_pollers:
                 continue
             poller_config.append({
@@ -368,7 +382,7 @@ def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_pol
                 ]),
                 "args": args,
                 "env": {
-                    "GRPC_POLL_STRATEGY": poller,
+                    "GRPC_POLL_STRATEGY": POLL_STRATEGIES.get(poller, poller),
                 } | default_env,
                 "flaky": flaky,
             })
@@ -412,7 +426,7 @@ def expand_poller_config(name, srcs, deps, tags, args, exclude_pollers, uses_pol
 
     return poller_config
 
-def expand_tests(name, srcs, deps, tags, args, exclude_pollers, uses_polling, uses_event_engine, flaky):
+def expand_tests(name, srcs, deps, tags, args, exclude_pollers, extra_pollers, uses_polling, uses_event_engine, flaky):
     """Common logic used to parameterize tests for every poller and EventEngine and experiment.
 
     Args:
@@ -423,6 +437,7 @@ def expand_tests(name, srcs, deps, tags, args, exclude_pollers, uses_polling, us
         args: base args
         flaky: base flaky
         exclude_pollers: list of poller names to exclude for this set of tests.
+        extra_pollers: list of OPT_IN_POLLERS to also run this set of tests with.
         uses_polling: set to False if the test is not sensitive to polling methodology.
         uses_event_engine: set to False if the test is not sensitive to
             EventEngine implementation differences
@@ -486,6 +501,7 @@ def expand_tests(name, srcs, deps, tags, args, exclude_pollers, uses_polling, us
         "tags": tags,
         "args": args,
         "exclude_pollers": exclude_pollers,
+        "extra_pollers": extra_pollers,
         "uses_polling": uses_polling,
         "uses_event_engine": uses_event_engine,
         "flaky": flaky,
@@ -533,7 +549,7 @@ def expand_tests(name, srcs, deps, tags, args, exclude_pollers, uses_polling, us
                     experiment_config.append(config)
     return experiment_config
 
-def grpc_cc_test(name, srcs = [], deps = [], external_deps = [], args = [], data = [], uses_polling = True, size = "medium", timeout = None, tags = [], exec_compatible_with = [], exec_properties = {}, shard_count = None, flaky = None, copts = [], linkstatic = None, exclude_pollers = [], uses_event_engine = True):
+def grpc_cc_test(name, srcs = [], deps = [], external_deps = [], args = [], data = [], uses_polling = True, size = "medium", timeout = None, tags = [], exec_compatible_with = [], exec_properties = {}, shard_count = None, flaky = None, copts = [], linkstatic = None, exclude_pollers = [], extra_pollers = [], uses_event_engine = True):
     """A cc_test target for use in the gRPC repo.
 
     Args:
@@ -556,6 +572,7 @@ def grpc_cc_test(name, srcs = [], deps = [], external_deps = [], args = [], data
         copts: Add these to the compiler invocation.
         linkstatic: link the binary in static mode
         exclude_pollers: list of poller names to exclude for this set of tests.
+        extra_pollers: list of OPT_IN_POLLERS to also run this set of tests with.
         uses_event_engine: set to False if the test is not sensitive to
             EventEngine implementation differences
     """
@@ -594,7 +611,7 @@ def grpc_cc_test(name, srcs = [], deps = [], external_deps = [], args = [], data
         alwayslink = 1,
     )
 
-    for poller_config in expand_tests(name, srcs, core_deps, tags, args, exclude_pollers, uses_polling, uses_event_engine, flaky):
+    for poller_config in expand_tests(name, srcs, core_deps, tags, args, exclude_pollers, extra_pollers, uses_polling, uses_event_engine, flaky):
         if poller_config["srcs"] != srcs:
             fail("srcs changed")
         if poller_config["deps"] != core_deps:
@@ -661,7 +678,7 @@ def grpc_generate_objc_one_off_targets():
 def grpc_generate_one_off_internal_targets():
     pass
 
-def grpc_sh_test(name, srcs = [], args = [], data = [], uses_polling = True, size = "medium", timeout = None, tags = [], env = {}, exec_compatible_with = [], exec_properties = {}, shard_count = None, flaky = None, exclude_pollers = [], uses_event_engine = True):
+def grpc_sh_test(name, srcs = [], args = [], data = [], uses_polling = True, size = "medium", timeout = None, tags = [], env = {}, exec_compatible_with = [], exec_properties = {}, shard_count = None, flaky = None, exclude_pollers = [], extra_pollers = [], uses_event_engine = True):
     """Execute an sh_test for every <poller> x <EventEngine> combination
 
     Args:
@@ -681,6 +698,7 @@ def grpc_sh_test(name, srcs = [], args = [], data = [], uses_polling = True, siz
         shard_count: The number of shards for this test.
         flaky: Whether this test is flaky.
         exclude_pollers: list of poller names to exclude for this set of tests.
+        extra_pollers: list of OPT_IN_POLLERS to also run this set of tests with.
         uses_event_engine: set to False if the test is not sensitive to
             EventEngine implementation differences
     """
@@ -693,7 +711,7 @@ def grpc_sh_test(name, srcs = [], args = [], data = [], uses_polling = True, siz
         "shard_count": shard_count,
     }
 
-    for poller_config in expand_tests(name, srcs, [], tags, args, exclude_pollers, uses_polling, uses_event_engine, flaky):
+    for poller_config in expand_tests(name, srcs, [], tags, args, exclude_pollers, extra_pollers, uses_polling, uses_event_engine, flaky):
         native.sh_test(
             name = poller_config["name"],
             srcs = poller_config["srcs"],
@@ -221,6 +221,46 @@
 #define GRPC_ARG_ABSOLUTE_MAX_METADATA_SIZE "grpc.absolute_max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** EXPERIMENTAL. Number of listening sockets to open per bound address of a
+ * server, each one owned by its own poller thread (default 1). Requires
+ * SO_REUSEPORT: the kernel spreads incoming connections across the sockets,
+ * and the accepts and I/O readiness notifications of a connection are then
+ * handled by the poller thread of the socket it arrived on, as are the
+ * callbacks and timers scheduled from that thread. Only supported by the posix
+ * EventEngine, and ignored when fork support is enabled. Int valued, capped at
+ * the number of CPUs. */
+#define GRPC_ARG_TCP_LISTENER_SHARD_COUNT \
+  "grpc.experimental.tcp_listener_shard_count"
+/** EXPERIMENTAL. If positive, sets SO_BUSY_POLL to this many microseconds (and
+ * SO_PREFER_BUSY_POLL where available) on client sockets and on listening
+ * sockets, whose accepted connections inherit it. Raising it above the
+ * net.core.busy_read sysctl requires CAP_NET_ADMIN; failures are ignored. Only
+ * supported by the posix EventEngine. Int valued, default 0 (unset). */
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
+/** EXPERIMENTAL. If positive, small writes (up to 16KB) issued from
+ * EventEngine thread pool threads are deferred to the end of the batch of
+ * closures the thread is running, and flushed together with the writes of the
+ * other endpoints deferred in the same batch. A deferred write is delayed by at
+ * most this many microseconds once further writes join the batch. Only
+ * supported by the posix EventEngine. Int valued, default 0 (disabled). */
+#define GRPC_ARG_TCP_WRITE_BATCH_MAX_DELAY_US \
+  "grpc.experimental.tcp_write_batch_max_delay_us"
+/** EXPERIMENTAL. If positive, one in every this many writes that carry no
+ * write event sink of their own is timestamped by the kernel, and the time it
+ * spent in the endpoint, the TCP stack, the packet scheduler and on the wire is
+ * recorded in per-endpoint histograms (exported through channelz) and in the
+ * global stats. Only supported by the posix EventEngine on Linux. Int valued,
+ * default 0 (disabled). */
+#define GRPC_ARG_TCP_WRITE_TIMESTAMP_SAMPLE_INTERVAL \
+  "grpc.experimental.tcp_write_timestamp_sample_interval"
+/** EXPERIMENTAL. If non-zero, a listener stops accepting connections while the
+ * memory quota of its resource quota is under high pressure, or while it holds
+ * GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS connections, and leaves new
+ * connections in the kernel accept queue until the pressure and the number of
+ * connections have dropped again. Only supported by the posix EventEngine.
+ * Boolean valued, default 0 (disabled). */
+#define GRPC_ARG_TCP_LISTENER_ADMISSION_CONTROL \
+  "grpc.experimental.tcp_listener_admission_control"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable). */
@@ -284,6 +324,16 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map the received payload pages into slices with
+   TCP_ZEROCOPY_RECEIVE instead of copying them, where the kernel supports it.
+   By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only attempt a zerocopy receive if a read
+   wants at least this many bytes. By default, this is set to 256KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_receive_bytes_threshold"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF.
     Default value is -1(kReadBufferSizeUnset) indicating that the system will
     decide the buffer size. Range varies from 0 to INT_MAX. */
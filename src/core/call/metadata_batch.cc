@@ -94,6 +94,7 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
         allow_list.insert(std::string(GrpcStreamNetworkState::DebugKey()));
         allow_list.insert(std::string(GrpcTarPit::DebugKey()));
         allow_list.insert(std::string(GrpcTrailersOnly::DebugKey()));
+        allow_list.insert(std::string(GrpcWriteWeight::DebugKey()));
         allow_list.insert(std::string(PeerString::DebugKey()));
         allow_list.insert(std::string(WaitForReady::DebugKey()));
         // go/keep-sorted end
@@ -630,6 +630,15 @@ struct GrpcTarPit {
   static absl::string_view DisplayValue(Empty) { return "tarpit"; }
 };
 
+// Annotation added by filters to set the relative share of connection write
+// bandwidth a call receives when its transport schedules writes fairly.
+struct GrpcWriteWeight {
+  static absl::string_view DebugKey() { return "GrpcWriteWeight"; }
+  static constexpr bool kRepeatable = false;
+  using ValueType = uint32_t;
+  static std::string DisplayValue(ValueType x) { return std::to_string(x); }
+};
+
 namespace metadata_detail {
 
 // Build a key/value formatted debug string.
@@ -1657,7 +1666,7 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     grpc_core::GrpcStatusContext, grpc_core::GrpcStatusFromWire,
     grpc_core::GrpcCallWasCancelled, grpc_core::WaitForReady,
     grpc_core::IsTransparentRetry, grpc_core::GrpcTrailersOnly,
-    grpc_core::GrpcTarPit,
+    grpc_core::GrpcTarPit, grpc_core::GrpcWriteWeight,
     grpc_core::GrpcRegisteredMethod GRPC_CUSTOM_CLIENT_METADATA
         GRPC_CUSTOM_SERVER_METADATA>;
 
@@ -1406,6 +1406,10 @@ absl::Status ClientChannel::ApplyServiceConfigToCall(
         !wait_for_ready->explicitly_set) {
       wait_for_ready->value = method_params->wait_for_ready().value();
     }
+    if (method_params->write_weight().has_value()) {
+      client_initial_metadata.Set(GrpcWriteWeight(),
+                                  *method_params->write_weight());
+    }
   }
   return absl::OkStatus();
 }
@@ -1843,6 +1843,10 @@ grpc_error_handle ClientChannelFilter::CallData::ApplyServiceConfigToCallLocked(
         !wait_for_ready->explicitly_set) {
       wait_for_ready->value = method_params->wait_for_ready().value();
     }
+    if (method_params->write_weight().has_value()) {
+      send_initial_metadata()->Set(GrpcWriteWeight(),
+                                   *method_params->write_weight());
+    }
   }
   return absl::OkStatus();
 }
@@ -114,6 +114,8 @@ const JsonLoaderInterface* ClientChannelMethodParsedConfig::JsonLoader(
           .OptionalField("timeout", &ClientChannelMethodParsedConfig::timeout_)
           .OptionalField("waitForReady",
                          &ClientChannelMethodParsedConfig::wait_for_ready_)
+          .OptionalField("writeWeight",
+                         &ClientChannelMethodParsedConfig::write_weight_)
           .Finish();
   return loader;
 }
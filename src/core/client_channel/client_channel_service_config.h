@@ -19,6 +19,7 @@
 
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <optional>
@@ -77,11 +78,16 @@ class ClientChannelMethodParsedConfig final
 
   std::optional<bool> wait_for_ready() const { return wait_for_ready_; }
 
+  // Relative share of connection writes, for transports that schedule writes
+  // fairly between calls.
+  std::optional<uint32_t> write_weight() const { return write_weight_; }
+
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
 
  private:
   Duration timeout_;
   std::optional<bool> wait_for_ready_;
+  std::optional<uint32_t> write_weight_;
 };
 
 class ClientChannelServiceConfigParser final
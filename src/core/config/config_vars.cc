@@ -83,6 +83,16 @@ ABSL_FLAG(
     "EXPERIMENTAL: If non-zero, extend the lifetime of channelz nodes past the "
     "underlying object lifetime, up to this many nodes. The value may be "
     "adjusted slightly to account for implementation limits.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_posix_poller_busy_poll_us, {},
+          "EXPERIMENTAL: If non-zero, the epoll1 poller of the posix "
+          "EventEngine spins on a non-blocking epoll_wait for up to this many "
+          "microseconds before blocking.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_thread_pool_pin_threads, {},
+          "EXPERIMENTAL: If true, pin each EventEngine thread pool worker to "
+          "one CPU, spreading the workers over NUMA nodes.");
+ABSL_FLAG(absl::optional<bool>, grpc_chttp2_phase_accounting, {},
+          "EXPERIMENTAL: If true, chttp2 transports account for the time "
+          "spent in each phase of their work, and report it in channelz.");
 
 namespace grpc_core {
 
@@ -95,6 +105,10 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
                      overrides.channelz_max_orphaned_nodes, 0)),
+      posix_poller_busy_poll_us_(
+          LoadConfig(FLAGS_grpc_posix_poller_busy_poll_us,
+                     "GRPC_POSIX_POLLER_BUSY_POLL_US",
+                     overrides.posix_poller_busy_poll_us, 0)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
@@ -108,6 +122,14 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_cpp_experimental_disable_reflection,
                      "GRPC_CPP_EXPERIMENTAL_DISABLE_REFLECTION",
                      overrides.cpp_experimental_disable_reflection, false)),
+      event_engine_thread_pool_pin_threads_(
+          LoadConfig(FLAGS_grpc_event_engine_thread_pool_pin_threads,
+                     "GRPC_EVENT_ENGINE_THREAD_POOL_PIN_THREADS",
+                     overrides.event_engine_thread_pool_pin_threads, false)),
+      chttp2_phase_accounting_(
+          LoadConfig(FLAGS_grpc_chttp2_phase_accounting,
+                     "GRPC_CHTTP2_PHASE_ACCOUNTING",
+                     overrides.chttp2_phase_accounting, false)),
       dns_resolver_(LoadConfig(FLAGS_grpc_dns_resolver, "GRPC_DNS_RESOLVER",
                                overrides.dns_resolver, "")),
       verbosity_(LoadConfig(FLAGS_grpc_verbosity, "GRPC_VERBOSITY",
@@ -158,7 +180,12 @@ std::string ConfigVars::ToString() const {
       ", ssl_cipher_suites: ", "\"", absl::CEscape(SslCipherSuites()), "\"",
       ", cpp_experimental_disable_reflection: ",
       CppExperimentalDisableReflection() ? "true" : "false",
-      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes());
+      ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes(),
+      ", posix_poller_busy_poll_us: ", PosixPollerBusyPollUs(),
+      ", event_engine_thread_pool_pin_threads: ",
+      EventEngineThreadPoolPinThreads() ? "true" : "false",
+      ", chttp2_phase_accounting: ",
+      Chttp2PhaseAccounting() ? "true" : "false");
 }
 
 }  // namespace grpc_core
@@ -36,10 +36,13 @@ class GPR_DLL ConfigVars {
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
     absl::optional<int32_t> channelz_max_orphaned_nodes;
+    absl::optional<int32_t> posix_poller_busy_poll_us;
     absl::optional<bool> enable_fork_support;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<bool> cpp_experimental_disable_reflection;
+    absl::optional<bool> event_engine_thread_pool_pin_threads;
+    absl::optional<bool> chttp2_phase_accounting;
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
@@ -111,6 +114,18 @@ class GPR_DLL ConfigVars {
   int32_t ChannelzMaxOrphanedNodes() const {
     return channelz_max_orphaned_nodes_;
   }
+  // EXPERIMENTAL: If non-zero, the epoll1 poller of the posix EventEngine
+  // spins on a non-blocking epoll_wait for up to this many microseconds before
+  // blocking.
+  int32_t PosixPollerBusyPollUs() const { return posix_poller_busy_poll_us_; }
+  // EXPERIMENTAL: If true, pin each EventEngine thread pool worker to one CPU,
+  // spreading the workers over NUMA nodes.
+  bool EventEngineThreadPoolPinThreads() const {
+    return event_engine_thread_pool_pin_threads_;
+  }
+  // EXPERIMENTAL: If true, chttp2 transports account for the time spent in
+  // each phase of their work, and report it in channelz.
+  bool Chttp2PhaseAccounting() const { return chttp2_phase_accounting_; }
 
  private:
   explicit ConfigVars(const Overrides& overrides);
@@ -118,10 +133,13 @@ class GPR_DLL ConfigVars {
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
   int32_t channelz_max_orphaned_nodes_;
+  int32_t posix_poller_busy_poll_us_;
   bool enable_fork_support_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
   bool cpp_experimental_disable_reflection_;
+  bool event_engine_thread_pool_pin_threads_;
+  bool chttp2_phase_accounting_;
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
@@ -37,6 +37,10 @@ namespace chaotic_good {
   "grpc.chaotic_good.inlined_payload_size_threshold"
 #define GRPC_ARG_CHAOTIC_GOOD_SCHEDULER_CONFIG \
   "grpc.chaotic_good.scheduler_config"
+// Client only: advertise the DATA_ENDPOINT_DRAINING feature. Off by default,
+// as servers that do not know the feature reject the handshake.
+#define GRPC_ARG_CHAOTIC_GOOD_DATA_ENDPOINT_DRAINING \
+  "grpc.chaotic_good.data_endpoint_draining"
 
 // Transport configuration.
 // Most of our configuration is derived from channel args, and then exchanged
@@ -47,7 +51,9 @@ class Config {
   explicit Config(
       const ChannelArgs& channel_args,
       std::initializer_list<chaotic_good_frame::Settings::Features>
-          supported_features = {chaotic_good_frame::Settings::CHUNKING})
+          supported_features = {
+              chaotic_good_frame::Settings::CHUNKING,
+              chaotic_good_frame::Settings::DATA_ENDPOINT_DRAINING})
       : supported_features_(supported_features) {
     decode_alignment_ =
         std::max(1, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_ALIGNMENT)
@@ -71,6 +77,9 @@ class Config {
                .value_or(inline_payload_size_threshold_));
     tracing_enabled_ =
         channel_args.GetBool(GRPC_ARG_TCP_TRACING_ENABLED).value_or(false);
+    advertise_data_endpoint_draining_ =
+        channel_args.GetBool(GRPC_ARG_CHAOTIC_GOOD_DATA_ENDPOINT_DRAINING)
+            .value_or(false);
   }
 
   Config(const Config&) = delete;
@@ -92,11 +101,23 @@ class Config {
     for (const auto& pending_data_endpoint : pending_data_endpoints_) {
       settings.add_connection_id(pending_data_endpoint.id());
     }
+    // Only set if the client asked for it: see ReceiveClientIncomingSettings.
+    if (supports_data_endpoint_draining()) {
+      settings.add_supported_features(
+          chaotic_good_frame::Settings::DATA_ENDPOINT_DRAINING);
+    }
     PrepareOutgoingSettings(settings);
   }
 
   void PrepareClientOutgoingSettings(chaotic_good_frame::Settings& settings) {
     CHECK_EQ(pending_data_endpoints_.size(), 0u);
+    if (!advertise_data_endpoint_draining_) {
+      supported_features_.erase(
+          chaotic_good_frame::Settings::DATA_ENDPOINT_DRAINING);
+    } else if (supports_data_endpoint_draining()) {
+      settings.add_supported_features(
+          chaotic_good_frame::Settings::DATA_ENDPOINT_DRAINING);
+    }
     PrepareOutgoingSettings(settings);
   }
 
@@ -154,6 +175,7 @@ class Config {
     options.decode_alignment = decode_alignment_;
     options.inlined_payload_size_threshold = inline_payload_size_threshold_;
     options.scheduler_config = scheduler_config_;
+    options.enable_data_endpoint_draining = supports_data_endpoint_draining();
     return options;
   }
 
@@ -179,10 +201,10 @@ class Config {
   }
 
   std::string ToString() const {
-    return absl::StrCat(GRPC_DUMP_ARGS(tracing_enabled_, encode_alignment_,
-                                       decode_alignment_, max_send_chunk_size_,
-                                       max_recv_chunk_size_,
-                                       inline_payload_size_threshold_));
+    return absl::StrCat(GRPC_DUMP_ARGS(
+        tracing_enabled_, encode_alignment_, decode_alignment_,
+        max_send_chunk_size_, max_recv_chunk_size_,
+        inline_payload_size_threshold_, supports_data_endpoint_draining()));
   }
 
   template <typename Sink>
@@ -194,6 +216,11 @@ class Config {
     return supported_features_.contains(chaotic_good_frame::Settings::CHUNKING);
   }
 
+  bool supports_data_endpoint_draining() const {
+    return supported_features_.contains(
+        chaotic_good_frame::Settings::DATA_ENDPOINT_DRAINING);
+  }
+
  private:
   // Fill-in a settings frame to be sent with the results of the negotiation so
   // far. For the client this will be whatever we got from channel args; for the
@@ -219,6 +246,7 @@ class Config {
   }
 
   bool tracing_enabled_ = false;
+  bool advertise_data_endpoint_draining_ = false;
   uint32_t encode_alignment_ = 64;
   uint32_t decode_alignment_ = 64;
   uint32_t max_send_chunk_size_ = 1024 * 1024;
@@ -153,13 +153,17 @@ void OutputBuffers::Reader::EndReadNext() {
   }
 }
 
-Poll<std::vector<OutputBuffers::QueuedFrame>>
+Poll<std::optional<std::vector<OutputBuffers::QueuedFrame>>>
 OutputBuffers::Reader::PollReadNext() {
   GRPC_LATENT_SEE_SCOPE("OutputBuffers::PollReadNext");
   mu_.Lock();
   while (true) {
     GRPC_LATENT_SEE_SCOPE("OutputBuffers::PollReadNext::loop");
     if (frames_.empty()) {
+      if (draining_) {
+        mu_.Unlock();
+        return std::nullopt;
+      }
       if (!reading_) {
         reading_ = true;
         output_buffers_->WakeupScheduler();
@@ -176,6 +180,23 @@ OutputBuffers::Reader::PollReadNext() {
   }
 }
 
+void OutputBuffers::Reader::StartDraining() {
+  mu_.Lock();
+  if (draining_) {
+    mu_.Unlock();
+    return;
+  }
+  draining_ = true;
+  // Frames the scheduler assigns to a reader that is not reading get written
+  // back to the queue for another reader to pick up.
+  reading_ = false;
+  auto waker = std::move(waker_);
+  mu_.Unlock();
+  // A draining reader takes no new frames, so it no longer counts as ready.
+  output_buffers_->num_readers_.fetch_sub(1, std::memory_order_relaxed);
+  waker.WakeupAsync();
+}
+
 void OutputBuffers::Reader::SetNetworkMetrics(
     const std::optional<SendRate::NetworkSend>& network_send,
     const SendRate::NetworkMetrics& metrics) {
@@ -189,6 +210,7 @@ channelz::PropertyList OutputBuffers::Reader::ChannelzProperties() {
   MutexLock lock(&mu_);
   return channelz::PropertyList()
       .Set("reading", reading_)
+      .Set("draining", draining_)
       .Merge(send_rate_.ChannelzProperties())
       .Set("queued_frames", [this]() -> std::optional<channelz::PropertyTable> {
         mu_.AssertHeld();
@@ -238,10 +260,13 @@ void OutputBuffers::DestroyReader(uint32_t id) {
   mu_reader_data_.Unlock();
   reader->mu_.Lock();
   reader->reading_ = false;
+  // Marking the reader draining keeps a late StartDraining from discounting
+  // it a second time.
+  const bool was_draining = std::exchange(reader->draining_, true);
   auto waker = std::move(reader->waker_);
   reader->mu_.Unlock();
   waker.Wakeup();
-  num_readers_.fetch_sub(1, std::memory_order_relaxed);
+  if (!was_draining) num_readers_.fetch_sub(1, std::memory_order_relaxed);
 }
 
 void OutputBuffers::WakeupScheduler() {
@@ -694,10 +719,26 @@ class MetricsCollector
 auto Endpoint::PullDataPayload(RefCountedPtr<EndpointContext> ctx) {
   return Map(
       ctx->reader->Next(),
-      [ctx](
-          ValueOrFailure<std::vector<OutputBuffers::QueuedFrame>> queued_frames)
-          -> ValueOrFailure<SliceBuffer> {
-        if (!queued_frames.ok()) return Failure{};
+      [ctx](std::optional<std::vector<OutputBuffers::QueuedFrame>>
+                queued_frames) -> ValueOrFailure<SliceBuffer> {
+        if (!queued_frames.has_value()) {
+          // All frames assigned to this endpoint have been written: tell the
+          // peer that no more data follows.
+          DCHECK(ctx->enable_draining);
+          GRPC_TRACE_LOG(chaotic_good, INFO)
+              << "CHAOTIC_GOOD: " << ctx->reader.get()
+              << " Drained data endpoint #" << ctx->id;
+          const size_t header_size =
+              TcpDataFrameHeader::kFrameHeaderSize +
+              DataConnectionPadding(TcpDataFrameHeader::kFrameHeaderSize,
+                                    ctx->encode_alignment);
+          auto hdr = MutableSlice::CreateUninitialized(header_size);
+          memset(hdr.data(), 0, header_size);
+          TcpDataFrameHeader{kEndpointDrainedPayloadTag, ctx->clock->Now(), 0}
+              .Serialize(hdr.data());
+          ctx->drained_marker_sent = true;
+          return SliceBuffer(Slice(std::move(hdr)));
+        }
         GRPC_TRACE_LOG(chaotic_good, INFO)
             << "CHAOTIC_GOOD: " << ctx->reader.get() << " "
             << ResolvedAddressToString(ctx->endpoint->GetPeerAddress())
@@ -793,10 +834,11 @@ auto Endpoint::WriteLoop(RefCountedPtr<EndpointContext> ctx) {
                 return status;
               });
         },
-        [id = ctx->id, reader = ctx->reader]() -> LoopCtl<absl::Status> {
+        [ctx]() -> LoopCtl<absl::Status> {
           GRPC_TRACE_LOG(chaotic_good, INFO)
-              << "CHAOTIC_GOOD: " << reader.get() << " "
-              << "Write done to data endpoint #" << id;
+              << "CHAOTIC_GOOD: " << ctx->reader.get() << " "
+              << "Write done to data endpoint #" << ctx->id;
+          if (ctx->drained_marker_sent) return absl::OkStatus();
           return Continue{};
         });
   });
@@ -845,6 +887,17 @@ auto Endpoint::ReadLoop(RefCountedPtr<EndpointContext> ctx) {
               << " on data connection #" << ctx->id;
           buffer.RemoveLastNBytesNoInline(DataConnectionPadding(
               frame_header.payload_length, ctx->decode_alignment));
+          if (GPR_UNLIKELY(ctx->enable_draining &&
+                           frame_header.payload_tag ==
+                               kEndpointDrainedPayloadTag)) {
+            // The peer will send nothing more on this endpoint: drain our
+            // side too (if we haven't already) so the endpoint can retire.
+            GRPC_TRACE_LOG(chaotic_good, INFO)
+                << "CHAOTIC_GOOD: Peer drained data connection #" << ctx->id;
+            ctx->reader->StartDraining();
+            ctx->peer_drained.Set();
+            return absl::OkStatus();
+          }
           if (GPR_UNLIKELY(frame_header.payload_tag ==
                            kSecurityFramePayloadTag)) {
             ReceiveSecurityFrame(*ctx->endpoint, std::move(buffer));
@@ -880,6 +933,7 @@ void Endpoint::AddData(channelz::DataSink sink) {
                  return ctx_->secure_frame_queue->InstantaneousQueuedBytes();
                }())
           .Set("enable_tracing", ctx_->enable_tracing)
+          .Set("enable_draining", ctx_->enable_draining)
           .Merge(ctx_->reader->ChannelzProperties()));
   party_->ExportToChannelz(absl::StrCat("endpoint_party", ctx_->id), sink);
 }
@@ -889,7 +943,7 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
                    RefCountedPtr<OutputBuffers> output_buffers,
                    RefCountedPtr<InputQueue> input_queues,
                    PendingConnection pending_connection, bool enable_tracing,
-                   TransportContextPtr ctx,
+                   bool enable_draining, TransportContextPtr ctx,
                    std::shared_ptr<TcpZTraceCollector> ztrace_collector) {
   auto ep_ctx = MakeRefCounted<EndpointContext>();
   ctx_ = ep_ctx;
@@ -897,6 +951,7 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
   ep_ctx->encode_alignment = encode_alignment;
   ep_ctx->decode_alignment = decode_alignment;
   ep_ctx->enable_tracing = enable_tracing;
+  ep_ctx->enable_draining = enable_draining;
   ep_ctx->output_buffers = std::move(output_buffers);
   ep_ctx->input_queues = std::move(input_queues);
   ep_ctx->ztrace_collector = std::move(ztrace_collector);
@@ -965,17 +1020,33 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
                   [ep_ctx](absl::Status status) {
                     GRPC_TRACE_LOG(chaotic_good, INFO)
                         << "CHAOTIC_GOOD: read party done: " << status;
+                    // The read loop only finishes successfully once the peer
+                    // has drained this endpoint.
+                    if (status.ok()) return;
                     ep_ctx->input_queues->SetClosed(std::move(status));
                   });
-              return Map(GRPC_LATENT_SEE_PROMISE("DataEndpointWrite",
-                                                 WriteLoop(std::move(ep_ctx))),
-                         [read_party, socket_node = std::move(socket_node)](
-                             auto x) { return x; });
+              return Map(
+                  TrySeq(GRPC_LATENT_SEE_PROMISE("DataEndpointWrite",
+                                                 WriteLoop(ep_ctx)),
+                         [ep_ctx]() {
+                           return Map(ep_ctx->peer_drained.Wait(),
+                                      [](Empty) { return absl::OkStatus(); });
+                         }),
+                  [read_party, socket_node = std::move(socket_node)](auto x) {
+                    return x;
+                  });
             });
       },
       [ep_ctx](absl::Status status) {
         GRPC_TRACE_LOG(chaotic_good, INFO)
             << "CHAOTIC_GOOD: write party done: " << status;
+        if (status.ok()) {
+          // Both sides drained: close the connection, the endpoint is reaped
+          // by DataEndpoints.
+          ep_ctx->endpoint.reset();
+          ep_ctx->retired.store(true, std::memory_order_release);
+          return;
+        }
         ep_ctx->input_queues->SetClosed(std::move(status));
       });
 }
@@ -989,8 +1060,10 @@ DataEndpoints::DataEndpoints(
     std::vector<PendingConnection> endpoints_vec, TransportContextPtr ctx,
     uint32_t encode_alignment, uint32_t decode_alignment,
     std::shared_ptr<TcpZTraceCollector> ztrace_collector, bool enable_tracing,
-    std::string scheduler_config, data_endpoints_detail::Clock* clock)
+    bool enable_draining, std::string scheduler_config,
+    data_endpoints_detail::Clock* clock)
     : channelz::DataSource(ctx->socket_node),
+      enable_draining_(enable_draining),
       output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>(
           clock, encode_alignment, ztrace_collector,
           std::move(scheduler_config), ctx)),
@@ -998,12 +1071,40 @@ DataEndpoints::DataEndpoints(
   for (size_t i = 0; i < endpoints_vec.size(); ++i) {
     endpoints_.emplace_back(std::make_unique<data_endpoints_detail::Endpoint>(
         i, encode_alignment, decode_alignment, clock, output_buffers_,
-        input_queues_, std::move(endpoints_vec[i]), enable_tracing, ctx,
-        ztrace_collector));
+        input_queues_, std::move(endpoints_vec[i]), enable_tracing,
+        enable_draining, ctx, ztrace_collector));
   }
   SourceConstructed();
 }
 
+bool DataEndpoints::RetireEndpoint(uint32_t id) {
+  // The peer would take the drained marker for a regular frame.
+  if (!enable_draining_) return false;
+  MutexLock lock(&mu_);
+  ReapRetiredEndpointsLocked();
+  if (id >= endpoints_.size() || endpoints_[id] == nullptr) return false;
+  if (endpoints_[id]->draining()) return true;
+  // Keep at least one endpoint that takes new data frames.
+  bool has_other_active_endpoint = false;
+  for (size_t i = 0; i < endpoints_.size(); ++i) {
+    if (i != id && endpoints_[i] != nullptr && !endpoints_[i]->draining()) {
+      has_other_active_endpoint = true;
+      break;
+    }
+  }
+  if (!has_other_active_endpoint) return false;
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Retire data endpoint #" << id;
+  endpoints_[id]->StartDraining();
+  return true;
+}
+
+void DataEndpoints::ReapRetiredEndpointsLocked() {
+  for (auto& endpoint : endpoints_) {
+    if (endpoint != nullptr && endpoint->retired()) endpoint.reset();
+  }
+}
+
 void DataEndpoints::AddData(channelz::DataSink sink) {
   output_buffers_->AddData(sink);
   input_queues_->AddData(sink);
@@ -1016,6 +1117,7 @@ void DataEndpoints::AddData(channelz::DataSink sink) {
   };
   MutexLock lock(&mu_);
   for (size_t i = 0; i < endpoints_.size(); ++i) {
+    if (endpoints_[i] == nullptr) continue;
     endpoints_[i]->AddData(sink);
   }
 }
@@ -19,7 +19,9 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <queue>
 
 #include "src/core/channelz/channelz.h"
@@ -29,6 +31,7 @@
 #include "src/core/ext/transport/chaotic_good/scheduler.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/mpsc.h"
 #include "src/core/lib/promise/party.h"
@@ -41,6 +44,12 @@ namespace chaotic_good {
 
 namespace data_endpoints_detail {
 
+// Payload tag of the empty data frame sent as the last frame on a retiring
+// data endpoint, if DATA_ENDPOINT_DRAINING was negotiated. Payload tags of
+// regular frames are limited to 56 bits.
+inline constexpr uint64_t kEndpointDrainedPayloadTag =
+    std::numeric_limits<uint64_t>::max();
+
 class Clock {
  public:
   virtual uint64_t Now() = 0;
@@ -148,6 +157,14 @@ class OutputBuffers final
         const std::optional<SendRate::NetworkSend>& network_send,
         const SendRate::NetworkMetrics& metrics);
     channelz::PropertyList ChannelzProperties();
+    // Stop scheduling new frames onto this reader. Frames already assigned to
+    // it are still returned by Next(), after which Next() resolves to
+    // std::nullopt.
+    void StartDraining();
+    bool draining() {
+      MutexLock lock(&mu_);
+      return draining_;
+    }
     void Drop() {
       CHECK(!dropped_);
       dropped_ = true;
@@ -176,7 +193,7 @@ class OutputBuffers final
         return *this;
       }
 
-      Poll<std::vector<QueuedFrame>> operator()() {
+      Poll<std::optional<std::vector<QueuedFrame>>> operator()() {
         auto r = reader_->PollReadNext();
         if (r.ready()) reader_ = nullptr;
         return r;
@@ -187,13 +204,14 @@ class OutputBuffers final
     };
 
     void EndReadNext();
-    Poll<std::vector<QueuedFrame>> PollReadNext();
+    Poll<std::optional<std::vector<QueuedFrame>>> PollReadNext();
 
     const RefCountedPtr<OutputBuffers> output_buffers_;
     const uint32_t id_;
 
     Mutex mu_;
     bool reading_ ABSL_GUARDED_BY(mu_) = false;
+    bool draining_ ABSL_GUARDED_BY(mu_) = false;
     bool dropped_{false};
     SendRate send_rate_ ABSL_GUARDED_BY(mu_);
     Waker waker_ ABSL_GUARDED_BY(mu_);
@@ -450,7 +468,7 @@ class Endpoint final {
            Clock* clock, RefCountedPtr<OutputBuffers> output_buffers,
            RefCountedPtr<InputQueue> input_queues,
            PendingConnection pending_connection, bool enable_tracing,
-           TransportContextPtr ctx,
+           bool enable_draining, TransportContextPtr ctx,
            std::shared_ptr<TcpZTraceCollector> ztrace_collector);
   Endpoint(const Endpoint&) = delete;
   Endpoint& operator=(const Endpoint&) = delete;
@@ -463,12 +481,23 @@ class Endpoint final {
 
   void AddData(channelz::DataSink sink);
 
+  // Begin retiring this endpoint: flush the frames already assigned to it,
+  // then send the drained marker. The endpoint is retired once the peer has
+  // sent its own drained marker. Only valid if draining was enabled.
+  void StartDraining() {
+    DCHECK(ctx_->enable_draining);
+    ctx_->reader->StartDraining();
+  }
+  bool draining() const { return ctx_->reader->draining(); }
+  bool retired() const { return ctx_->retired.load(std::memory_order_acquire); }
+
  private:
   struct EndpointContext : public RefCounted<EndpointContext> {
     uint32_t id;
     uint32_t encode_alignment;
     uint32_t decode_alignment;
     bool enable_tracing;
+    bool enable_draining;
     // TODO(ctiller): Inline members into EndpointContext.
     RefCountedPtr<OutputBuffers> output_buffers;
     RefCountedPtr<InputQueue> input_queues;
@@ -480,6 +509,10 @@ class Endpoint final {
     Clock* clock;
     RefCountedPtr<OutputBuffers::Reader> reader;
     Timestamp last_metrics_update = Timestamp::ProcessEpoch();
+    // Only accessed from the write loop.
+    bool drained_marker_sent = false;
+    InterActivityLatch<void> peer_drained;
+    std::atomic<bool> retired{false};
   };
 
   static auto PullDataPayload(RefCountedPtr<EndpointContext> ctx);
@@ -502,7 +535,8 @@ class DataEndpoints final : public channelz::DataSource {
                          TransportContextPtr ctx, uint32_t encode_alignment,
                          uint32_t decode_alignment,
                          std::shared_ptr<TcpZTraceCollector> ztrace_collector,
-                         bool enable_tracing, std::string scheduler_config,
+                         bool enable_tracing, bool enable_draining,
+                         std::string scheduler_config,
                          data_endpoints_detail::Clock* clock = DefaultClock());
   ~DataEndpoints() { SourceDestructing(); }
 
@@ -524,6 +558,15 @@ class DataEndpoints final : public channelz::DataSource {
 
   bool empty() const { return output_buffers_->ReadyEndpoints() == 0; }
 
+  // Gracefully retire a data endpoint: no new frames are scheduled onto it,
+  // frames already assigned to it are sent, and the connection is closed once
+  // both peers have drained it. A peer that sees the endpoint drained retires
+  // it too, so this only needs to be initiated by one side.
+  // Returns false (and does nothing) if the peers did not negotiate
+  // DATA_ENDPOINT_DRAINING, if there is no such endpoint, or if it is the last
+  // endpoint that is not draining: data frames would have nowhere to go.
+  bool RetireEndpoint(uint32_t id);
+
   void SetMpscProbe(MpscProbe<OutgoingFrame> probe) {
     output_buffers_->SetMpscProbe(std::move(probe));
   }
@@ -540,9 +583,14 @@ class DataEndpoints final : public channelz::DataSource {
     return &clock;
   }
 
+  void ReapRetiredEndpointsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const bool enable_draining_;
   RefCountedPtr<data_endpoints_detail::OutputBuffers> output_buffers_;
   RefCountedPtr<data_endpoints_detail::InputQueue> input_queues_;
   Mutex mu_;
+  // Indexed by connection id; retired endpoints leave a nullptr behind so that
+  // ids are never reused within a connection.
   std::vector<std::unique_ptr<data_endpoints_detail::Endpoint>> endpoints_
       ABSL_GUARDED_BY(mu_);
 };
@@ -56,6 +56,7 @@ TcpFrameTransport::TcpFrameTransport(
       data_endpoints_(std::move(pending_data_endpoints), ctx,
                       options.encode_alignment, options.decode_alignment,
                       ztrace_collector_, options.enable_tracing,
+                      options.enable_data_endpoint_draining,
                       options.scheduler_config),
       options_(options) {
   auto* transport_framing_endpoint_extension =
@@ -248,7 +249,9 @@ void TcpFrameTransport::AddData(channelz::DataSink sink) {
                    .Set("decode_alignment", options_.decode_alignment)
                    .Set("inlined_payload_size_threshold",
                         options_.inlined_payload_size_threshold)
-                   .Set("enable_tracing", options_.enable_tracing));
+                   .Set("enable_tracing", options_.enable_tracing)
+                   .Set("enable_data_endpoint_draining",
+                        options_.enable_data_endpoint_draining));
 }
 
 RefCountedPtr<channelz::SocketNode> TcpFrameTransport::MakeSocketNode(
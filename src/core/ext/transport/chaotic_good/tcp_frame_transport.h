@@ -44,6 +44,8 @@ class TcpFrameTransport final : public FrameTransport,
     uint32_t inlined_payload_size_threshold = 8 * 1024;
     std::string scheduler_config = "spanrr";
     bool enable_tracing = false;
+    // Set if both peers negotiated DATA_ENDPOINT_DRAINING.
+    bool enable_data_endpoint_draining = false;
   };
 
   TcpFrameTransport(Options options, PromiseEndpoint control_endpoint,
@@ -12,10 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "src/core/config/config_vars.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/ext/transport/chttp2/client/chttp2_connector.h"
 #include "src/core/ext/transport/chttp2/server/chttp2_server.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_interner.h"
+#include "src/core/ext/transport/chttp2/transport/phase_accounting.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/transport/endpoint_transport.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 namespace grpc_core {
 namespace {
@@ -36,5 +42,14 @@ class Chttp2Transport final : public EndpointTransport {
 void RegisterChttp2Transport(CoreConfiguration::Builder* builder) {
   builder->endpoint_transport_registry()->RegisterTransport(
       "h2", std::make_unique<Chttp2Transport>());
+  Chttp2PhaseAccounting::SetEnabled(ConfigVars::Get().Chttp2PhaseAccounting());
+  // Each channel and server gets its own interner, shared by its transports.
+  builder->channel_args_preconditioning()->RegisterStage([](ChannelArgs args) {
+    if (!IsHpackSharedInterningEnabled() ||
+        args.GetObject<HPackParserInterner>() != nullptr) {
+      return args;
+    }
+    return args.SetObject(MakeRefCounted<HPackParserInterner>());
+  });
 }
 }  // namespace grpc_core
\ No newline at end of file
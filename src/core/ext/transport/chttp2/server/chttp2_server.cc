@@ -66,6 +66,7 @@
 #include "src/core/lib/event_engine/shim.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/utils.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
@@ -80,6 +81,7 @@
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server.h"
 #include "src/core/util/debug_location.h"
@@ -201,9 +203,13 @@ void NewChttp2ServerListener::ActiveConnection::HandshakingState::
     return;
   }
   timer_handle_.reset();
-  auto t = std::get<RefCountedPtr<grpc_chttp2_transport>>(connection_->state_);
-  t->DisconnectWithError(GRPC_ERROR_CREATE(
-      "Did not receive HTTP/2 settings before handshake timeout"));
+  Match(
+      connection_->state_,
+      [](const OrphanablePtr<HandshakingState>&) {},
+      [](const auto& transport) {
+        transport->DisconnectWithError(GRPC_ERROR_CREATE(
+            "Did not receive HTTP/2 settings before handshake timeout"));
+      });
 }
 
 void NewChttp2ServerListener::ActiveConnection::HandshakingState::
@@ -221,13 +227,77 @@ void NewChttp2ServerListener::ActiveConnection::HandshakingState::
       DEBUG_LOCATION);
 }
 
+bool NewChttp2ServerListener::ActiveConnection::HandshakingState::
+    MaybeStartPromiseBasedTransportLocked(HandshakerArgs* args) {
+#ifdef GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2
+  // GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2 is a temporary fix to help some
+  // customers who are having severe memory constraints. This macro will not
+  // always be available and we strongly recommend anyone to avoid the usage of
+  // this MACRO for any other purpose. We expect to delete this MACRO within
+  // 8-15 months.
+  return false;
+#else
+  if (!IsPromiseBasedHttp2ServerTransportEnabled() ||
+      !grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          args->endpoint.get())) {
+    return false;
+  }
+  std::unique_ptr<EventEngine::Endpoint> event_engine_endpoint =
+      grpc_event_engine::experimental::grpc_take_wrapped_event_engine_endpoint(
+          args->endpoint.release());
+  if (event_engine_endpoint == nullptr) {
+    // The endpoint has been released, so there is nothing left to fall back
+    // to. Treat this like a failed handshake.
+    LOG(ERROR) << "Failed to take endpoint.";
+    return true;
+  }
+  PromiseEndpoint promise_endpoint(std::move(event_engine_endpoint),
+                                   std::move(args->read_buffer));
+  Ref().release();  // Held by OnReceiveSettings().
+  GRPC_CLOSURE_INIT(&on_receive_settings_, OnReceiveSettings, this,
+                    grpc_schedule_on_exec_ctx);
+  // Refs held by OnClose()
+  connection_->Ref().release();
+  auto* transport = new http2::Http2ServerTransport(
+      std::move(promise_endpoint), args->args,
+      args->args.GetObjectRef<EventEngine>(), &on_receive_settings_,
+      &connection_->on_close_);
+  RefCountedPtr<http2::Http2ServerTransport> transport_ref =
+      transport->RefAsSubclass<http2::Http2ServerTransport>();
+  // The connection is cleaned up by on_close from here on, even if the
+  // channel cannot be created: SetupTransport takes ownership of a server
+  // transport and orphans it on failure, which closes the transport.
+  connection_->state_ = std::move(transport_ref);
+  grpc_error_handle channel_init_err =
+      connection_->listener_state_->SetupTransport(
+          transport, accepting_pollset_, args->args);
+  if (!channel_init_err.ok()) {
+    LOG(ERROR) << "Failed to create channel: "
+               << StatusToString(channel_init_err);
+    return true;
+  }
+  // Use the on_receive_settings callback to enforce the handshake deadline.
+  timer_handle_ = connection_->listener_state_->event_engine()->RunAfter(
+      deadline_ - Timestamp::Now(), [self = Ref()]() mutable {
+        // HandshakingState deletion might require an active ExecCtx.
+        ExecCtx exec_ctx;
+        auto* self_ptr = self.get();
+        self_ptr->connection_->work_serializer_.Run(
+            [self = std::move(self)]() { self->OnTimeoutLocked(); },
+            DEBUG_LOCATION);
+      });
+  return true;
+#endif  // GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2
+}
+
 void NewChttp2ServerListener::ActiveConnection::HandshakingState::
     OnHandshakeDoneLocked(absl::StatusOr<HandshakerArgs*> result) {
   // If the handshaking succeeded but there is no endpoint, then the
   // handshaker may have handed off the connection to some external
   // code, so we can just clean up here without creating a transport.
   if (!connection_->shutdown_ && result.ok() &&
-      (*result)->endpoint != nullptr) {
+      (*result)->endpoint != nullptr &&
+      !MaybeStartPromiseBasedTransportLocked(*result)) {
     RefCountedPtr<Transport> transport =
         grpc_create_chttp2_transport((*result)->args,
                                      std::move((*result)->endpoint), false)
@@ -270,7 +340,7 @@ void NewChttp2ServerListener::ActiveConnection::HandshakingState::
   handshake_mgr_.reset();
   connection_->listener_state_->OnHandshakeDone(connection_.get());
   // Clean up if we don't have a transport
-  if (!std::holds_alternative<RefCountedPtr<grpc_chttp2_transport>>(
+  if (std::holds_alternative<OrphanablePtr<HandshakingState>>(
           connection_->state_)) {
     connection_->listener_state_->connection_quota()->ReleaseConnections(1);
     connection_->listener_state_->RemoveLogicalConnection(connection_.get());
@@ -364,7 +434,7 @@ void NewChttp2ServerListener::ActiveConnection::SendGoAwayImplLocked() {
                 absl::UnavailableError("Connection going away"));
           }
         },
-        [](const RefCountedPtr<grpc_chttp2_transport>& transport) {
+        [](const auto& transport) {
           // Send a GOAWAY if the transport exists
           if (transport != nullptr) {
             grpc_transport_op* op = grpc_make_transport_op(nullptr);
@@ -391,7 +461,7 @@ void NewChttp2ServerListener::ActiveConnection::
               absl::UnavailableError("Connection to be disconnected"));
         }
       },
-      [](const RefCountedPtr<grpc_chttp2_transport>& transport) {
+      [](const auto& transport) {
         // Disconnect immediately if the transport exists
         if (transport != nullptr) {
           grpc_transport_op* op = grpc_make_transport_op(nullptr);
@@ -26,6 +26,14 @@
 
 #include <functional>
 
+#ifndef GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2
+// GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2 is a temporary fix to help
+// some customers who are having severe memory constraints. This macro
+// will not always be available and we strongly recommend anyone to avoid
+// the usage of this MACRO for any other purpose. We expect to delete this
+// MACRO within 8-15 months.
+#include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
+#endif
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -85,6 +93,10 @@ class NewChttp2ServerListener : public Server::ListenerInterface {
       void OnTimeoutLocked();
       static void OnReceiveSettings(void* arg, grpc_error_handle /* error */);
       void OnHandshakeDoneLocked(absl::StatusOr<HandshakerArgs*> result);
+      // Starts a promise based HTTP/2 transport on the endpoint if that
+      // transport is enabled. Returns false if the legacy transport should
+      // be created instead.
+      bool MaybeStartPromiseBasedTransportLocked(HandshakerArgs* args);
 
       RefCountedPtr<ActiveConnection> const connection_;
       grpc_tcp_server* const tcp_server_;
@@ -132,7 +144,12 @@ class NewChttp2ServerListener : public Server::ListenerInterface {
     // Set by HandshakingState before the handshaking begins and set to a valid
     // transport when handshaking is done successfully.
     std::variant<OrphanablePtr<HandshakingState>,
-                 RefCountedPtr<grpc_chttp2_transport>>
+                 RefCountedPtr<grpc_chttp2_transport>
+#ifndef GRPC_EXPERIMENTAL_TEMPORARILY_DISABLE_PH2
+                 ,
+                 RefCountedPtr<http2::Http2ServerTransport>
+#endif
+                 >
         state_;
     grpc_closure on_close_;
     bool shutdown_ = false;
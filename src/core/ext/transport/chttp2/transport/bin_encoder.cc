@@ -25,14 +25,14 @@
 #include "absl/log/check.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 
-static const char alphabet[] =
+static constexpr char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
 struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -45,6 +45,28 @@ static const b64_huff_sym huff_alphabet[64] = {
     {0x2, 5},  {0x19, 6}, {0x1a, 6},   {0x1b, 6}, {0x1c, 6}, {0x1d, 6},
     {0x1e, 6}, {0x1f, 6}, {0x7fb, 11}, {0x18, 6}};
 
+// Every 12 bits of input become two base64 symbols, so the tables below are
+// indexed by 12 bits of input: a full triplet takes two lookups, not four.
+struct b64_pair_tables {
+  // The two base64 characters encoding each 12 bit value.
+  char chars[4096][2]{};
+  // The huffman codes of those two characters, concatenated, shifted left by 8
+  // bits and or'd with their total length.
+  uint32_t huff[4096]{};
+  constexpr b64_pair_tables() {
+    for (int i = 0; i < 4096; i++) {
+      const b64_huff_sym& hi = huff_alphabet[i >> 6];
+      const b64_huff_sym& lo = huff_alphabet[i & 0x3f];
+      chars[i][0] = alphabet[i >> 6];
+      chars[i][1] = alphabet[i & 0x3f];
+      huff[i] = (((static_cast<uint32_t>(hi.bits) << lo.length) | lo.bits)
+                 << 8) |
+                static_cast<uint32_t>(hi.length + lo.length);
+    }
+  }
+};
+static constexpr b64_pair_tables pair_tables;
+
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
 grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
@@ -59,10 +81,10 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    memcpy(out, pair_tables.chars[triplet >> 12], 2);
+    memcpy(out + 2, pair_tables.chars[triplet & 0xfff], 2);
     out += 4;
     in += 3;
   }
@@ -91,79 +113,92 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+size_t grpc_chttp2_huffman_compressed_length(const uint8_t* input,
+                                             size_t length) {
+  // Four independent sums, so that the additions do not wait on each other.
+  size_t nbits[4] = {0, 0, 0, 0};
+  size_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    nbits[0] += grpc_chttp2_huffsyms[input[i]].length;
+    nbits[1] += grpc_chttp2_huffsyms[input[i + 1]].length;
+    nbits[2] += grpc_chttp2_huffsyms[input[i + 2]].length;
+    nbits[3] += grpc_chttp2_huffsyms[input[i + 3]].length;
   }
+  for (; i < length; ++i) {
+    nbits[0] += grpc_chttp2_huffsyms[input[i]].length;
+  }
+  const size_t total = nbits[0] + nbits[1] + nbits[2] + nbits[3];
+  return total / 8 + (total % 8 != 0);
+}
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+void grpc_chttp2_huffman_compress_into(const uint8_t* input, size_t length,
+                                       uint8_t* output) {
+  // Codes are at most 30 bits long, so with fewer than 32 bits pending the
+  // accumulator never overflows, and output is written 32 bits at a time.
+  uint64_t temp = 0;
+  uint32_t temp_length = 0;
+  for (const uint8_t* end = input + length; input != end; ++input) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*input];
+    temp = (temp << sym.length) | sym.bits;
+    temp_length += sym.length;
+    if (temp_length >= 32) {
+      temp_length -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp >> temp_length);
+      output[0] = static_cast<uint8_t>(word >> 24);
+      output[1] = static_cast<uint8_t>(word >> 16);
+      output[2] = static_cast<uint8_t>(word >> 8);
+      output[3] = static_cast<uint8_t>(word);
+      output += 4;
     }
   }
-
+  while (temp_length >= 8) {
+    temp_length -= 8;
+    *output++ = static_cast<uint8_t>(temp >> temp_length);
+  }
   if (temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out++ =
+    // Pad with the most significant bits of the EOS symbol, all ones.
+    *output++ =
         static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
                              static_cast<uint8_t>(0xffu >> temp_length));
   }
+}
 
-  CHECK(out == GRPC_SLICE_END_PTR(output));
-
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  const uint8_t* in = GRPC_SLICE_START_PTR(input);
+  const size_t length = GRPC_SLICE_LENGTH(input);
+  grpc_slice output =
+      GRPC_SLICE_MALLOC(grpc_chttp2_huffman_compressed_length(in, length));
+  grpc_chttp2_huffman_compress_into(in, length, GRPC_SLICE_START_PTR(output));
   return output;
 }
 
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
-  }
-}
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
-  *wire_size += 2;
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+// Appends length bits of code. Pairs of codes are at most 22 bits long and
+// fewer than 32 bits are left pending, so temp never overflows.
+static void enc_add(huff_out* out, uint32_t code, uint32_t length) {
+  out->temp = (out->temp << length) | code;
+  out->temp_length += length;
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t word = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(word >> 24);
+    out->out[1] = static_cast<uint8_t>(word >> 16);
+    out->out[2] = static_cast<uint8_t>(word >> 8);
+    out->out[3] = static_cast<uint8_t>(word);
+    out->out += 4;
+  }
 }
 
-static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
-  *wire_size += 1;
-  b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+// Appends the huffman codes of the two base64 symbols encoding the 12 bit
+// value pair.
+static void enc_add_pair(huff_out* out, uint32_t pair) {
+  const uint32_t sym = pair_tables.huff[pair];
+  enc_add(out, sym >> 8, sym & 0xff);
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -183,17 +218,14 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   out.temp = 0;
   out.temp_length = 0;
   out.out = start_out;
-  *wire_size = 0;
+  *wire_size = static_cast<uint32_t>(output_syms);
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    enc_add_pair(&out, triplet >> 12);
+    enc_add_pair(&out, triplet & 0xfff);
     in += 3;
   }
 
@@ -202,20 +234,22 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4),
-               wire_size);
+      enc_add_pair(&out, static_cast<uint32_t>(in[0]) << 4);
       in += 1;
       break;
     case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2), wire_size);
+      const b64_huff_sym& last = huff_alphabet[(in[1] & 0xf) << 2];
+      enc_add_pair(&out, (static_cast<uint32_t>(in[0]) << 4) | (in[1] >> 4));
+      enc_add(&out, last.bits, last.length);
       in += 2;
       break;
     }
   }
 
+  while (out.temp_length >= 8) {
+    out.temp_length -= 8;
+    *out.out++ = static_cast<uint8_t>(out.temp >> out.temp_length);
+  }
   if (out.temp_length) {
     // NB: the following integer arithmetic operation needs to be in its
     // expanded form due to the "integral promotion" performed (see section
@@ -21,6 +21,7 @@
 
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // base64 encode a slice. Returns a new slice, does not take ownership of the
@@ -31,6 +32,16 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input);
 // standard. Returns a new slice, does not take ownership of the input
 grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input);
 
+// Returns the number of bytes that length bytes at input take once compressed
+// with the static huffman encoder.
+size_t grpc_chttp2_huffman_compressed_length(const uint8_t* input,
+                                             size_t length);
+
+// Compresses length bytes at input with the static huffman encoder into output,
+// which must hold grpc_chttp2_huffman_compressed_length(input, length) bytes.
+void grpc_chttp2_huffman_compress_into(const uint8_t* input, size_t length,
+                                       uint8_t* output);
+
 // equivalent to:
 // grpc_slice x = grpc_chttp2_base64_encode(input);
 // grpc_slice y = grpc_chttp2_huffman_compress(x);
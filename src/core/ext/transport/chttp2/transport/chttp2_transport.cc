@@ -615,6 +615,8 @@ void grpc_chttp2_transport::ChannelzDataSource::AddData(
                   .Set("ping_rate_policy",
                        t->ping_rate_policy.ChannelzProperties())
                   .Set("ping_callbacks", t->ping_callbacks.ChannelzProperties())
+                  .Set("phase_accounting",
+                       t->phase_accounting.ChannelzProperties())
                   .Set("goaway_error", t->goaway_error)
                   .Set("sent_goaway_state",
                        [t]() {
@@ -707,7 +709,11 @@ grpc_chttp2_transport::grpc_chttp2_transport(
       flow_control(
           peer_string.as_string_view(),
           channel_args.GetBool(GRPC_ARG_HTTP2_BDP_PROBE).value_or(true),
-          &memory_owner),
+          &memory_owner,
+          channel_args.GetBool(GRPC_ARG_HTTP2_MODEL_FLOW_CONTROL)
+                  .value_or(false)
+              ? grpc_core::chttp2::FlowControlStrategy::kModel
+              : grpc_core::chttp2::FlowControlStrategy::kDefault),
       deframe_state(is_client ? GRPC_DTS_FH_0 : GRPC_DTS_CLIENT_PREFIX_0),
       is_client(is_client) {
   context_list = new grpc_core::ContextList();
@@ -786,6 +792,9 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   grpc_auth_context* auth_context = channel_args.GetObject<grpc_auth_context>();
   http2_stats = grpc_core::CreateHttp2StatsCollector(auth_context);
   hpack_parser.hpack_table()->SetHttp2StatsCollector(http2_stats);
+  hpack_parser.SetInterner(
+      channel_args.GetObjectRef<grpc_core::HPackParserInterner>());
+  phase_accounting.SetHttp2StatsCollector(http2_stats);
 
 #ifdef GRPC_POSIX_SOCKET_TCP
   closure_barrier_may_cover_write =
@@ -1143,6 +1152,9 @@ static void write_action_begin_locked(
   if (!t->closed_with_error.ok()) {
     r.writing = false;
   } else {
+    grpc_core::Chttp2PhaseAccounting::Timer timer(
+        &t->phase_accounting,
+        grpc_core::Chttp2PhaseAccounting::Phase::kWriteAssembly);
     r = grpc_chttp2_begin_write(t.get());
   }
   if (r.writing) {
@@ -1169,6 +1181,51 @@ static void write_action_begin_locked(
   }
 }
 
+// Ask the endpoint to report the connection state that the write size policy
+// sizes writes by, if a sample is due.
+static void sample_endpoint_for_write_size(
+    grpc_chttp2_transport* t,
+    grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs& args) {
+  EventEngine::Endpoint* ee_ep =
+      grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+          t->ep.get());
+  if (ee_ep == nullptr) return;
+  auto telemetry_info = ee_ep->GetTelemetryInfo();
+  if (telemetry_info == nullptr) return;
+  const auto pacing_rate = telemetry_info->GetMetricKey("pacing_rate");
+  const auto min_rtt = telemetry_info->GetMetricKey("min_rtt");
+  const auto congestion_window =
+      telemetry_info->GetMetricKey("congestion_window");
+  const auto notsent = telemetry_info->GetMetricKey("data_notsent");
+  std::vector<size_t> keys;
+  for (const auto& key : {pacing_rate, min_rtt, congestion_window, notsent}) {
+    if (key.has_value()) keys.push_back(*key);
+  }
+  if (keys.empty()) return;
+  auto sample = t->write_size_policy.MaybeSampleEndpoint();
+  if (sample == nullptr) return;
+  args.set_metrics_sink(WriteEventSink(
+      telemetry_info->GetMetricsSet(keys), {WriteEvent::kSendMsg},
+      [sample = std::move(sample), pacing_rate, min_rtt, congestion_window,
+       notsent](WriteEvent, absl::Time, std::vector<WriteMetric> metrics) {
+        grpc_core::Chttp2WriteSizePolicy::EndpointMetrics endpoint_metrics;
+        for (const auto& metric : metrics) {
+          if (metric.value < 0) continue;
+          const uint64_t value = metric.value;
+          if (metric.key == pacing_rate) {
+            endpoint_metrics.pacing_rate = value;
+          } else if (metric.key == min_rtt) {
+            endpoint_metrics.min_rtt_us = value;
+          } else if (metric.key == congestion_window) {
+            endpoint_metrics.congestion_window = value;
+          } else if (metric.key == notsent) {
+            endpoint_metrics.notsent_bytes = value;
+          }
+        }
+        sample->Set(endpoint_metrics);
+      }));
+}
+
 static void write_action(
     grpc_chttp2_transport* t,
     std::vector<TcpCallTracerWithOffset> tcp_call_tracers) {
@@ -1229,6 +1286,8 @@ static void write_action(
             }));
       }
     }
+  } else if (grpc_core::IsChttp2EndpointAwareWriteSizeEnabled()) {
+    sample_endpoint_for_write_size(t, args);
   }
   GRPC_TRACE_LOG(http2_ping, INFO)
       << (t->is_client ? "CLIENT" : "SERVER") << "[" << t << "]: Write "
@@ -1236,6 +1295,9 @@ static void write_action(
   t->write_size_policy.BeginWrite(t->outbuf.Length());
   t->http2_ztrace_collector.Append(grpc_core::H2BeginEndpointWrite{
       static_cast<uint32_t>(t->outbuf.Length())});
+  grpc_core::Chttp2PhaseAccounting::Timer timer(
+      &t->phase_accounting,
+      grpc_core::Chttp2PhaseAccounting::Phase::kEndpointWrite);
   grpc_endpoint_write(t->ep.get(), t->outbuf.c_slice_buffer(),
                       grpc_core::InitTransportClosure<write_action_end>(
                           t->Ref(), &t->write_action_end_locked),
@@ -1549,6 +1611,10 @@ static void send_initial_metadata_locked(
   if (contains_non_ok_status(s->send_initial_metadata)) {
     s->seen_error = true;
   }
+  if (auto weight =
+          s->send_initial_metadata->get(grpc_core::GrpcWriteWeight())) {
+    s->write_deficit.SetWeight(*weight);
+  }
   if (!s->write_closed) {
     if (t->is_client) {
       if (t->closed_with_error.ok()) {
@@ -2901,6 +2967,9 @@ static void read_action_parse_loop_locked(
   if (t->closed_with_error.ok()) {
     grpc_error_handle errors[3] = {error, absl::OkStatus(), absl::OkStatus()};
     size_t requests_started = 0;
+    grpc_core::Chttp2PhaseAccounting::Timer timer(
+        &t->phase_accounting,
+        grpc_core::Chttp2PhaseAccounting::Phase::kReadParsing);
     for (size_t i = 0;
          i < t->read_buffer.count && errors[1] == absl::OkStatus(); i++) {
       auto r = grpc_chttp2_perform_read(t.get(), t->read_buffer.slices[i],
@@ -98,9 +98,11 @@ std::ostream& operator<<(std::ostream& out, const FlowControlAction& action) {
 
 TransportFlowControl::TransportFlowControl(absl::string_view name,
                                            bool enable_bdp_probe,
-                                           MemoryOwner* memory_owner)
+                                           MemoryOwner* memory_owner,
+                                           FlowControlStrategy strategy)
     : memory_owner_(memory_owner),
       enable_bdp_probe_(enable_bdp_probe),
+      strategy_(strategy),
       bdp_estimator_(name) {}
 
 uint32_t TransportFlowControl::DesiredAnnounceSize(bool writing_anyway) const {
@@ -135,10 +137,29 @@ absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
                                         -incoming_frame_size);
     sfc_->min_progress_size_ -=
         std::min(sfc_->min_progress_size_, incoming_frame_size);
+    if (sfc_->tfc_->strategy() == FlowControlStrategy::kModel) {
+      sfc_->TrackReceiveRate(incoming_frame_size);
+    }
     return absl::OkStatus();
   });
 }
 
+void StreamFlowControl::TrackReceiveRate(int64_t incoming_frame_size) {
+  const Timestamp now = Timestamp::Now();
+  if (receive_rate_start_ == Timestamp::InfPast()) receive_rate_start_ = now;
+  receive_rate_bytes_ += incoming_frame_size;
+  // Measure over at least one round trip, so that the rate is not just the
+  // burst of a single window.
+  const Duration elapsed = now - receive_rate_start_;
+  const Duration interval = std::max(
+      Duration::Milliseconds(10),
+      Duration::FromSecondsAsDouble(tfc_->bdp_estimator()->EstimateRtt()));
+  if (elapsed < interval) return;
+  receive_rate_ = static_cast<double>(receive_rate_bytes_) / elapsed.seconds();
+  receive_rate_start_ = now;
+  receive_rate_bytes_ = 0;
+}
+
 absl::Status TransportFlowControl::IncomingUpdateContext::RecvData(
     int64_t incoming_frame_size, absl::FunctionRef<absl::Status()> stream) {
   if (incoming_frame_size > tfc_->announced_window_) {
@@ -172,12 +193,9 @@ FlowControlAction TransportFlowControl::UpdateAction(FlowControlAction action) {
   return action;
 }
 
-double
-TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
-    const {
+double TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp(
+    double memory_pressure) const {
   const double bdp = bdp_estimator_.EstimateBdp() * 2.0;
-  const double memory_pressure =
-      memory_owner_->GetPressureInfo().pressure_control_value;
   // Linear interpolation between two values.
   // Given a line segment between the two points (t_min, a), and (t_max, b),
   // and a value t such that t_min <= t <= t_max, return the value on the line
@@ -226,6 +244,54 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   }
 }
 
+double TransportFlowControl::TargetInitialWindowSizeFromModel(
+    const BasicMemoryQuota::PressureInfo& pressure_info) {
+  const double memory_pressure = pressure_info.pressure_control_value;
+  // No window may commit us to more than the quota recommends for a single
+  // allocation. Past the same 20% pressure where the default strategy stops
+  // letting anything go, the cap shrinks linearly to zero at full pressure.
+  const double kAnythingGoesPressure = 0.2;
+  double cap = std::min(
+      static_cast<double>(kMaxInitialWindowSize),
+      static_cast<double>(pressure_info.max_recommended_allocation_size));
+  if (memory_pressure >= 1.0) {
+    cap = 0;
+  } else if (memory_pressure > kAnythingGoesPressure) {
+    cap *= (1.0 - memory_pressure) / (1.0 - kAnythingGoesPressure);
+  }
+  model_window_cap_ = static_cast<int64_t>(cap);
+  const double rtt = bdp_estimator_.EstimateRtt();
+  const double bandwidth = bdp_estimator_.EstimatePeakBandwidth();
+  if (rtt == 0 || bandwidth == 0) {
+    // Nothing measured yet.
+    return std::min(cap, TargetInitialWindowSizeBasedOnMemoryPressureAndBdp(
+                             memory_pressure));
+  }
+  const double bdp = bandwidth * rtt;
+  // Leave room for the bandwidth to grow. A sender that is limited by our
+  // window delivers at most one window per round trip, so a measurement close
+  // to the window says little about what the path could carry: probe further.
+  const double kHeadroom = 2.0;
+  const double kWindowLimitedHeadroom = 4.0;
+  const bool window_limited =
+      bdp >= 0.75 * static_cast<double>(target_initial_window_size_);
+  const double target =
+      std::max(static_cast<double>(kDefaultWindow),
+               bdp * (window_limited ? kWindowLimitedHeadroom : kHeadroom));
+  return std::min(cap, target);
+}
+
+int64_t TransportFlowControl::MaxStreamWindowDelta(double receive_rate) const {
+  if (strategy_ != FlowControlStrategy::kModel) return kMaxWindowDelta;
+  // Enough for the stream to keep receiving at twice its current rate for a
+  // round trip, so that a stream limited by its window can keep growing.
+  const double want = 2.0 * receive_rate * bdp_estimator_.EstimateRtt();
+  const int64_t cap =
+      Clamp(model_window_cap_, kMaxWindowDelta, kModelMaxWindowDelta);
+  return Clamp(static_cast<int64_t>(std::min(want, static_cast<double>(cap))),
+               kMaxWindowDelta, cap);
+}
+
 void TransportFlowControl::UpdateSetting(
     absl::string_view name, int64_t* desired_value, uint32_t new_desired_value,
     FlowControlAction* action,
@@ -270,9 +336,18 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
     // target might change based on how much memory pressure we are under
     // TODO(ncteisen): experiment with setting target to be huge under low
     // memory pressure.
-    uint32_t target = static_cast<uint32_t>(RoundUpToPowerOf2(
-        Clamp(TargetInitialWindowSizeBasedOnMemoryPressureAndBdp(), 0.0,
-              static_cast<double>(kMaxInitialWindowSize))));
+    const auto pressure_info = memory_owner_->GetPressureInfo();
+    const double target_estimate =
+        strategy_ == FlowControlStrategy::kModel
+            ? TargetInitialWindowSizeFromModel(pressure_info)
+            : TargetInitialWindowSizeBasedOnMemoryPressureAndBdp(
+                  pressure_info.pressure_control_value);
+    uint32_t target = static_cast<uint32_t>(RoundUpToPowerOf2(Clamp(
+        target_estimate, 0.0, static_cast<double>(kMaxInitialWindowSize))));
+    if (strategy_ == FlowControlStrategy::kModel) {
+      // Rounding up must not take us past the memory cap.
+      target = std::min<int64_t>(target, model_window_cap_);
+    }
     if (target < kMinPositiveInitialWindowSize) target = 0;
     if (g_test_only_transport_target_window_estimates_mocker != nullptr) {
       // Hook for simulating unusual flow control situations in tests.
@@ -347,7 +422,8 @@ uint32_t StreamFlowControl::DesiredAnnounceSize() const {
         return announced_window_delta_;
       }
     } else {
-      return std::min(min_progress_size_, kMaxWindowDelta);
+      return std::min(min_progress_size_,
+                      tfc_->MaxStreamWindowDelta(receive_rate_));
     }
   }();
   return Clamp(desired_window_delta - announced_window_delta_, int64_t{0},
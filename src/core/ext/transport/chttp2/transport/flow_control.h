@@ -59,6 +59,11 @@ static constexpr const uint32_t kMaxInitialWindowSize = (1u << 30);
 static constexpr const int64_t kMaxWindowDelta = (1u << 20);
 static constexpr const int kDefaultPreferredRxCryptoFrameSize = INT_MAX;
 
+// The maximum per-stream flow control window delta to advertise under
+// FlowControlStrategy::kModel. Small enough that the delta plus the largest
+// initial window still fits in a window.
+static constexpr const int64_t kModelMaxWindowDelta = (1u << 29);
+
 // TODO(ctiller): clean up when flow_control_fixes is enabled by default
 static constexpr uint32_t kFrameSize = 1024 * 1024;
 static constexpr const uint32_t kMinInitialWindowSize = 128;
@@ -68,6 +73,23 @@ class StreamFlowControl;
 
 enum class StallEdge { kNoChange, kStalled, kUnstalled };
 
+// How window sizes are tuned.
+enum class FlowControlStrategy {
+  // Grow the initial window with the BDP estimate, and announce at most
+  // kMaxWindowDelta per stream.
+  kDefault,
+  // Set the initial window directly from the measured bandwidth and ping
+  // round trip time, and size per stream windows from each stream's observed
+  // receive rate.
+  kModel,
+};
+
+// The largest per-stream window delta strategy may announce.
+inline constexpr int64_t MaxWindowDelta(FlowControlStrategy strategy) {
+  return strategy == FlowControlStrategy::kModel ? kModelMaxWindowDelta
+                                                 : kMaxWindowDelta;
+}
+
 // Encapsulates a collections of actions the transport needs to take with
 // regard to flow control. Each action comes with urgencies that tell the
 // transport how quickly the action must take place.
@@ -165,11 +187,17 @@ std::ostream& operator<<(std::ostream& out, const FlowControlAction& action);
 // to be as performant as possible.
 class TransportFlowControl final {
  public:
-  explicit TransportFlowControl(absl::string_view name, bool enable_bdp_probe,
-                                MemoryOwner* memory_owner);
+  explicit TransportFlowControl(
+      absl::string_view name, bool enable_bdp_probe, MemoryOwner* memory_owner,
+      FlowControlStrategy strategy = FlowControlStrategy::kDefault);
   ~TransportFlowControl() {}
 
   bool bdp_probe() const { return enable_bdp_probe_; }
+  FlowControlStrategy strategy() const { return strategy_; }
+
+  // The largest window delta to announce for a stream that is receiving
+  // receive_rate bytes per second.
+  int64_t MaxStreamWindowDelta(double receive_rate) const;
 
   // returns an announce if we should send a transport update to our peer,
   // else returns zero; writing_anyway indicates if a write would happen
@@ -348,7 +376,10 @@ class TransportFlowControl final {
   }
 
  private:
-  double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp(
+      double memory_pressure) const;
+  double TargetInitialWindowSizeFromModel(
+      const BasicMemoryQuota::PressureInfo& pressure_info);
   static void UpdateSetting(absl::string_view name, int64_t* desired_value,
                             uint32_t new_desired_value,
                             FlowControlAction* action,
@@ -371,6 +402,10 @@ class TransportFlowControl final {
 
   /// should we probe bdp?
   const bool enable_bdp_probe_;
+  const FlowControlStrategy strategy_;
+  // Under FlowControlStrategy::kModel, the most memory a window may commit us
+  // to, as of the last PeriodicUpdate().
+  int64_t model_window_cap_ = kMaxWindowDelta;
 
   // bdp estimation
   BdpEstimator bdp_estimator_;
@@ -458,6 +493,9 @@ class StreamFlowControl final {
   int64_t remote_window_delta() const { return remote_window_delta_; }
   int64_t announced_window_delta() const { return announced_window_delta_; }
   int64_t min_progress_size() const { return min_progress_size_; }
+  // Bytes per second received over the last measurement interval, tracked
+  // only under FlowControlStrategy::kModel.
+  double receive_rate() const { return receive_rate_; }
 
   // A snapshot of the flow control stats to export.
   struct Stats {
@@ -484,7 +522,12 @@ class StreamFlowControl final {
   int64_t remote_window_delta_ = 0;
   int64_t announced_window_delta_ = 0;
   std::optional<int64_t> pending_size_;
+  // Receive rate measurement: bytes received since receive_rate_start_.
+  Timestamp receive_rate_start_ = Timestamp::InfPast();
+  int64_t receive_rate_bytes_ = 0;
+  double receive_rate_ = 0;
 
+  void TrackReceiveRate(int64_t incoming_frame_size);
   FlowControlAction UpdateAction(FlowControlAction action);
 };
 
@@ -52,6 +52,25 @@ absl::Status grpc_chttp2_data_parser_begin_frame(uint8_t flags,
   return absl::OkStatus();
 }
 
+// DATA frames up to this size whose payload is spread over slices smaller
+// than kMaxPackedSliceSize on average, as a run of small messages each with
+// its own gRPC header is, are copied into one slice.
+static constexpr uint32_t kMaxPackedFrameSize = 16384;
+static constexpr uint32_t kMaxPackedSliceSize = 256;
+
+static bool should_pack_data(const grpc_slice_buffer* inbuf,
+                             uint32_t write_bytes) {
+  if (write_bytes > kMaxPackedFrameSize) return false;
+  size_t covered = 0;
+  uint32_t count = 0;
+  for (size_t i = 0; i < inbuf->count && covered < write_bytes; ++i) {
+    covered += GRPC_SLICE_LENGTH(inbuf->slices[i]);
+    ++count;
+  }
+  // A single message is a header and a payload: copying it saves little.
+  return count > 2 && write_bytes / count < kMaxPackedSliceSize;
+}
+
 void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              uint32_t write_bytes, int is_eof,
                              grpc_core::CallTracerInterface* call_tracer,
@@ -78,7 +97,15 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   ztrace_collector->Append(
       grpc_core::H2DataTrace<false>{id, is_eof != 0, write_bytes});
 
-  grpc_slice_buffer_move_first_no_ref(inbuf, write_bytes, outbuf);
+  if (grpc_core::IsChttp2PackSmallMessagesEnabled() &&
+      should_pack_data(inbuf, write_bytes)) {
+    grpc_slice packed = GRPC_SLICE_MALLOC(write_bytes);
+    grpc_slice_buffer_move_first_into_buffer(inbuf, write_bytes,
+                                             GRPC_SLICE_START_PTR(packed));
+    grpc_slice_buffer_add(outbuf, packed);
+  } else {
+    grpc_slice_buffer_move_first_no_ref(inbuf, write_bytes, outbuf);
+  }
 
   grpc_core::http2_global_stats().IncrementHttp2WriteDataFrameSize(write_bytes);
   call_tracer->RecordOutgoingBytes({header_size, 0, 0});
@@ -20,6 +20,8 @@
 #include <cstddef>
 #include <cstdint>
 
+#include "absl/strings/string_view.h"
+
 namespace grpc_core {
 namespace hpack_constants {
 // Per entry overhead bytes as per the spec
@@ -41,6 +43,13 @@ static constexpr size_t SizeForEntry(size_t key_length,
 
 static constexpr uint32_t kInitialTableEntries =
     EntriesForBytes(kInitialTableSize);
+
+// Returns true for headers carrying credentials, which must not be kept in
+// HPACK tables or beyond the connection that carries them.
+inline bool IsCredentialHeader(absl::string_view key) {
+  return key == "authorization" || key == "proxy-authorization" ||
+         key == "cookie" || key == "set-cookie";
+}
 }  // namespace hpack_constants
 }  // namespace grpc_core
 
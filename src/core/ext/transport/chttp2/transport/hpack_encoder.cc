@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
@@ -33,6 +34,7 @@
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/timeout_encoding.h"
 #include "src/core/util/crash.h"
@@ -165,11 +167,26 @@ WireValue GetWireValue(Slice value, bool true_binary_enabled, bool is_bin_hdr) {
       return WireValue(0x80, false, std::move(output), hpack_length);
     }
   } else {
-    // TODO(ctiller): opportunistically compress non-binary headers
     return WireValue(0x00, false, std::move(value));
   }
 }
 
+// Returns the huffman encoding of a non-binary string if the
+// hpack_huffman_literals experiment is enabled and the encoding is shorter,
+// and sets *huffman_prefix to the string length prefix bit that marks it.
+// Otherwise returns s unchanged, without allocating.
+Slice HuffmanCompressIfShorter(Slice s, uint8_t* huffman_prefix) {
+  *huffman_prefix = 0x00;
+  if (!IsHpackHuffmanLiteralsEnabled()) return s;
+  const size_t length =
+      grpc_chttp2_huffman_compressed_length(s.data(), s.size());
+  if (length >= s.size()) return s;
+  MutableSlice compressed = MutableSlice::CreateUninitialized(length);
+  grpc_chttp2_huffman_compress_into(s.data(), s.size(), compressed.data());
+  *huffman_prefix = 0x80;
+  return Slice(std::move(compressed));
+}
+
 struct DefinitelyInterned {
   static bool IsBinary(grpc_slice key) {
     return grpc_is_refcounted_slice_binary_header(key);
@@ -212,15 +229,19 @@ class BinaryStringValue {
 class NonBinaryStringValue {
  public:
   explicit NonBinaryStringValue(Slice value)
-      : value_(std::move(value)), len_val_(value_.length()) {}
+      : value_(HuffmanCompressIfShorter(std::move(value), &huffman_prefix_)),
+        len_val_(value_.length()) {}
 
   size_t prefix_length() const { return len_val_.length(); }
 
-  void WritePrefix(uint8_t* prefix_data) { len_val_.Write(0x00, prefix_data); }
+  void WritePrefix(uint8_t* prefix_data) {
+    len_val_.Write(huffman_prefix_, prefix_data);
+  }
 
   Slice data() { return std::move(value_); }
 
  private:
+  uint8_t huffman_prefix_;
   Slice value_;
   VarintWriter<1> len_val_;
 };
@@ -228,18 +249,20 @@ class NonBinaryStringValue {
 class StringKey {
  public:
   explicit StringKey(Slice key)
-      : key_(std::move(key)), len_key_(key_.length()) {}
+      : key_(HuffmanCompressIfShorter(std::move(key), &huffman_prefix_)),
+        len_key_(key_.length()) {}
 
   size_t prefix_length() const { return 1 + len_key_.length(); }
 
   void WritePrefix(uint8_t type, uint8_t* data) {
     data[0] = type;
-    len_key_.Write(0x00, data + 1);
+    len_key_.Write(huffman_prefix_, data + 1);
   }
 
   Slice key() { return std::move(key_); }
 
  private:
+  uint8_t huffman_prefix_;
   Slice key_;
   VarintWriter<1> len_key_;
 };
@@ -314,6 +337,16 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output_.Append(emit.data());
 }
 
+void Encoder::EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                       Slice value_slice) {
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x10, output_.AddTiny(key.prefix_length()));
+  output_.Append(key.key());
+  NonBinaryStringValue emit(std::move(value_slice));
+  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  output_.Append(emit.data());
+}
+
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
@@ -363,9 +396,79 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
   values_.emplace_back(value.Ref(), index);
 }
 
+void AdaptiveIndex::EmitTo(const Slice& key, const Slice& value,
+                           size_t max_retained_bytes, Encoder* encoder) {
+  // Credentials are never indexed, neither here nor by intermediaries.
+  if (hpack_constants::IsCredentialHeader(key.as_string_view())) {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNeverIdx(key.Ref(), value.Ref());
+    return;
+  }
+  auto& table = encoder->hpack_table();
+  // An entry that takes more than a quarter of the table would evict too
+  // many others.
+  if (hpack_constants::SizeForEntry(key.size(), value.size()) >
+      table.max_size() / 4) {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  const size_t hash =
+      absl::HashOf(key.as_string_view(), value.as_string_view());
+  Entry& entry = entries_[hash % kNumEntries];
+  if (entry.hits > 0 && entry.hash == hash) {
+    if (entry.key.empty()) {
+      // Seen before, but not indexed yet.
+      entry.hits = std::min<uint8_t>(entry.hits + 1, kMaxHits);
+      const size_t size = key.size() + value.size();
+      if (entry.hits < kIndexAfterHits ||
+          retained_bytes_ + size > max_retained_bytes) {
+        encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(),
+                                                        value.Ref());
+        return;
+      }
+      // Keep copies rather than refs: the slices may point into much larger
+      // buffers, such as those of a received frame.
+      entry.key = Slice::FromCopiedString(key.as_string_view());
+      entry.value = Slice::FromCopiedString(value.as_string_view());
+      retained_bytes_ += size;
+      entry.index = encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(
+          key.Ref(), value.Ref());
+      return;
+    }
+    if (entry.key == key && entry.value == value) {
+      entry.hits = std::min<uint8_t>(entry.hits + 1, kMaxHits);
+      if (table.ConvertibleToDynamicIndex(entry.index)) {
+        encoder->EmitIndexed(table.DynamicIndex(entry.index));
+      } else {
+        // Evicted from the table since: index it again.
+        entry.index = encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(
+            key.Ref(), value.Ref());
+      }
+      return;
+    }
+  }
+  // The slot belongs to another pair (or to none): age it.
+  if (entry.hits > 0) --entry.hits;
+  if (entry.hits == 0) {
+    Release(entry);
+    entry.hash = hash;
+    entry.hits = 1;
+  }
+  encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+}
+
+void AdaptiveIndex::Release(Entry& entry) {
+  retained_bytes_ -= entry.key.size() + entry.value.size();
+  entry.key = Slice();
+  entry.value = Slice();
+  entry.index = 0;
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  } else if (IsHpackAdaptiveIndexingEnabled()) {
+    compressor_->adaptive_index_.EmitTo(key, value,
+                                        compressor_->max_usable_size_, this);
   } else {
     EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   }
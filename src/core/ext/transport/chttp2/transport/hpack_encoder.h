@@ -72,6 +72,8 @@ class Encoder {
                                            Slice value_slice);
   void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                               Slice value_slice);
+  void EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                Slice value_slice);
 
   void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key, Slice value,
                            size_t transport_length);
@@ -277,6 +279,46 @@ class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
   SliceIndex index_;
 };
 
+// Indexes application-defined metadata, which has no trait and hence no
+// compressor of its own, once the same key and value have been sent on the
+// connection kIndexAfterHits times. Until then, and for key/value pairs that
+// are seen only once, the metadata is sent as a literal without indexing so
+// that it does not evict useful entries from the table.
+// Pairs are counted in a small direct-mapped table of hashes: a pair that
+// lands on a slot held by another pair ages it, and takes the slot over once
+// the count of that pair has dropped to zero.
+class AdaptiveIndex {
+ public:
+  // Number of times a key/value pair is seen before it is indexed.
+  static constexpr uint8_t kIndexAfterHits = 2;
+
+  // Encodes key (which must not be a binary header) and value. At most
+  // max_retained_bytes of keys and values are kept to recognize indexed pairs.
+  // Credentials are sent as never indexed literals.
+  void EmitTo(const Slice& key, const Slice& value, size_t max_retained_bytes,
+              Encoder* encoder);
+
+  size_t retained_bytes() const { return retained_bytes_; }
+
+ private:
+  static constexpr size_t kNumEntries = 64;
+  static constexpr uint8_t kMaxHits = 16;
+
+  struct Entry {
+    size_t hash = 0;
+    uint8_t hits = 0;
+    // Set once the pair has been indexed.
+    uint32_t index = 0;
+    Slice key;
+    Slice value;
+  };
+
+  void Release(Entry& entry);
+
+  Entry entries_[kNumEntries];
+  size_t retained_bytes_ = 0;
+};
+
 struct PreviousTimeout {
   Timeout timeout = Timeout::FromDuration(Duration::Zero());
   // Dynamic table index of a previously sent timeout
@@ -393,6 +435,9 @@ class HPackCompressor {
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
+  // Application-defined metadata, when the hpack_adaptive_indexing
+  // experiment is enabled.
+  hpack_encoder_detail::AdaptiveIndex adaptive_index_;
 };
 
 namespace hpack_encoder_detail {
@@ -43,8 +43,10 @@
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_interner.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/lib/surface/validate_metadata.h"
@@ -58,29 +60,49 @@
 namespace grpc_core {
 
 namespace {
-// The alphabet used for base64 encoding binary metadata.
+// The alphabet used for base64 encoding binary metadata. Padding is stripped
+// before decoding, so it is not part of the alphabet.
 constexpr char kBase64Alphabet[] =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=";
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
-// An inverted table: for each value in kBase64Alphabet, table contains the
-// index with which it's stored, so we can quickly invert the encoding without
-// any complicated runtime logic.
+// Set in a decoded value if any of its characters was outside the alphabet.
+constexpr uint32_t kBase64Invalid = 0x1000000;
+
+// Inverted tables, one for each position of a character within a group of
+// four: for each value in kBase64Alphabet, table contains the index with
+// which it's stored, already shifted into its place in the decoded 24 bits.
+// Decoding a group is then four loads or'd together, and a single test of
+// kBase64Invalid validates all four characters at once.
 struct Base64InverseTable {
-  uint8_t table[256]{};
+  uint32_t table[4][256]{};
   constexpr Base64InverseTable() {
-    for (int i = 0; i < 256; i++) {
-      table[i] = 255;
-    }
-    for (const char* p = kBase64Alphabet; *p; p++) {
-      uint8_t idx = *p;
-      uint8_t ofs = p - kBase64Alphabet;
-      table[idx] = ofs;
+    for (int pos = 0; pos < 4; pos++) {
+      for (int i = 0; i < 256; i++) {
+        table[pos][i] = kBase64Invalid;
+      }
+      for (const char* p = kBase64Alphabet; *p; p++) {
+        uint8_t idx = *p;
+        uint32_t ofs = p - kBase64Alphabet;
+        table[pos][idx] = ofs << (18 - (6 * pos));
+      }
     }
   }
+
+  // Decodes the first n characters of a group, 2 <= n <= 4.
+  uint32_t Decode(const uint8_t* cur, int n) const {
+    uint32_t bits = table[0][cur[0]] | table[1][cur[1]];
+    if (n > 2) bits |= table[2][cur[2]];
+    if (n > 3) bits |= table[3][cur[3]];
+    return bits;
+  }
 };
 
 constexpr Base64InverseTable kBase64InverseTable;
 
+// Values at least this long are referenced from the read buffer regardless of
+// how much of it they cover: copying them costs more than pinning the buffer.
+constexpr size_t kMinReferencedValueLength = 16 * 1024;
+
 }  // namespace
 
 // Input tracks the current byte through the input data and provides it
@@ -94,6 +116,7 @@ class HPackParser::Input {
         begin_(begin),
         end_(end),
         frontier_(begin),
+        length_(end - begin),
         frame_error_(frame_error),
         field_error_(field_error),
         bitsrc_(bitsrc) {}
@@ -106,6 +129,8 @@ class HPackParser::Input {
   bool end_of_stream() const { return begin_ == end_; }
   // How many bytes until end of input
   size_t remaining() const { return end_ - begin_; }
+  // Total number of bytes in the input, consumed or not
+  size_t length() const { return length_; }
   // Current position, as a pointer
   const uint8_t* cur_ptr() const { return begin_; }
   // End position, as a pointer
@@ -324,6 +349,8 @@ class HPackParser::Input {
   const uint8_t* const end_;
   // Frontier denotes the first byte past successfully processed input
   const uint8_t* frontier_;
+  // Total length of the input
+  const size_t length_;
   // Current error
   HpackParseResult& frame_error_;
   HpackParseResult& field_error_;
@@ -387,7 +414,13 @@ HPackParser::String::StringResult HPackParser::String::ParseUncompressed(
   auto* refcount = input->slice_refcount();
   auto* p = input->cur_ptr();
   input->Advance(length);
-  if (refcount != nullptr) {
+  // Referencing the read slice pins all of it, and any zerocopy region behind
+  // it, for as long as the value lives. Only do that for values that are large
+  // on their own or that make up a large part of the slice; Take() copies
+  // everything else.
+  if (refcount != nullptr && IsHpackZeroCopyParsingEnabled() &&
+      length > GRPC_SLICE_INLINED_SIZE &&
+      (length >= kMinReferencedValueLength || 2 * length >= input->length())) {
     return StringResult{HpackParseStatus::kOk, wire_size,
                         String(refcount, p, p + length)};
   } else {
@@ -402,74 +435,52 @@ std::optional<std::vector<uint8_t>> HPackParser::String::Unbase64Loop(
     --end;
   }
 
-  std::vector<uint8_t> out;
-  out.reserve((3 * (end - cur) / 4) + 3);
-
-  // Decode 4 bytes at a time while we can
-  while (end - cur >= 4) {
-    uint32_t bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    uint32_t buffer = bits << 18;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 12;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 6;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits;
-    ++cur;
-
-    out.insert(out.end(), {static_cast<uint8_t>(buffer >> 16),
-                           static_cast<uint8_t>(buffer >> 8),
-                           static_cast<uint8_t>(buffer)});
+  const size_t groups = (end - cur) / 4;
+  const size_t tail = (end - cur) % 4;
+  if (tail == 1) return {};
+  std::vector<uint8_t> out((3 * groups) + (tail == 0 ? 0 : tail - 1));
+  uint8_t* p = out.data();
+
+  // Decode 8 bytes at a time while we can
+  const uint8_t* const pairs_end = cur + (groups / 2) * 8;
+  while (cur != pairs_end) {
+    const uint32_t a = kBase64InverseTable.Decode(cur, 4);
+    const uint32_t b = kBase64InverseTable.Decode(cur + 4, 4);
+    if ((a | b) & kBase64Invalid) return {};
+    p[0] = static_cast<uint8_t>(a >> 16);
+    p[1] = static_cast<uint8_t>(a >> 8);
+    p[2] = static_cast<uint8_t>(a);
+    p[3] = static_cast<uint8_t>(b >> 16);
+    p[4] = static_cast<uint8_t>(b >> 8);
+    p[5] = static_cast<uint8_t>(b);
+    cur += 8;
+    p += 6;
+  }
+  if (groups % 2 != 0) {
+    const uint32_t buffer = kBase64InverseTable.Decode(cur, 4);
+    if (buffer & kBase64Invalid) return {};
+    p[0] = static_cast<uint8_t>(buffer >> 16);
+    p[1] = static_cast<uint8_t>(buffer >> 8);
+    p[2] = static_cast<uint8_t>(buffer);
+    cur += 4;
+    p += 3;
   }
-  // Deal with the last 0, 1, 2, or 3 bytes.
-  switch (end - cur) {
+  // Deal with the last 0, 2, or 3 bytes: the bits they encode beyond the
+  // output bytes must be zero.
+  switch (tail) {
     case 0:
       return out;
-    case 1:
-      return {};
     case 2: {
-      uint32_t bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      uint32_t buffer = bits << 18;
-
-      ++cur;
-      bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      buffer |= bits << 12;
-
-      if (buffer & 0xffff) return {};
-      out.push_back(static_cast<uint8_t>(buffer >> 16));
+      const uint32_t buffer = kBase64InverseTable.Decode(cur, 2);
+      if (buffer & (kBase64Invalid | 0xffff)) return {};
+      p[0] = static_cast<uint8_t>(buffer >> 16);
       return out;
     }
     case 3: {
-      uint32_t bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      uint32_t buffer = bits << 18;
-
-      ++cur;
-      bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      buffer |= bits << 12;
-
-      ++cur;
-      bits = kBase64InverseTable.table[*cur];
-      if (bits > 63) return {};
-      buffer |= bits << 6;
-
-      ++cur;
-      if (buffer & 0xff) return {};
-      out.push_back(static_cast<uint8_t>(buffer >> 16));
-      out.push_back(static_cast<uint8_t>(buffer >> 8));
+      const uint32_t buffer = kBase64InverseTable.Decode(cur, 3);
+      if (buffer & (kBase64Invalid | 0xff)) return {};
+      p[0] = static_cast<uint8_t>(buffer >> 16);
+      p[1] = static_cast<uint8_t>(buffer >> 8);
       return out;
     }
   }
@@ -571,10 +582,12 @@ HPackParser::String::StringResult HPackParser::String::ParseBinary(
 class HPackParser::Parser {
  public:
   Parser(Input* input, grpc_metadata_batch*& metadata_buffer,
-         InterSliceState& state, LogInfo log_info)
+         InterSliceState& state, HPackParserInterner::Cache* interner,
+         LogInfo log_info)
       : input_(input),
         metadata_buffer_(metadata_buffer),
         state_(state),
+        interner_(interner),
         log_info_(log_info) {}
 
   bool Parse() {
@@ -997,17 +1010,33 @@ class HPackParser::Parser {
     auto value_slice = value.value.Take();
     const auto transport_size =
         key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
-    auto md = grpc_metadata_batch::Parse(
-        key_string, std::move(value_slice), state_.add_to_table, transport_size,
-        [key_string, this](absl::string_view message, const Slice&) {
-          if (!state_.field_error.ok()) return;
-          input_->SetErrorAndContinueParsing(
-              HpackParseResult::MetadataParseError(key_string));
-          LOG(ERROR) << "Error parsing '" << key_string
-                     << "' metadata: " << message;
-        });
+    // Entries headed for the table may share storage with identical entries
+    // of other connections.
+    HPackParserInterner::Cache* interner =
+        state_.add_to_table && state_.field_error.ok() ? interner_ : nullptr;
+    std::optional<ParsedMetadata<grpc_metadata_batch>> md;
+    if (interner != nullptr) {
+      md = interner->Lookup(key_string, value_slice.as_string_view(),
+                            transport_size);
+    }
+    if (!md.has_value()) {
+      Slice interned_value = interner != nullptr ? value_slice.Ref() : Slice();
+      md = grpc_metadata_batch::Parse(
+          key_string, std::move(value_slice), state_.add_to_table,
+          transport_size,
+          [key_string, this](absl::string_view message, const Slice&) {
+            if (!state_.field_error.ok()) return;
+            input_->SetErrorAndContinueParsing(
+                HpackParseResult::MetadataParseError(key_string));
+            LOG(ERROR) << "Error parsing '" << key_string
+                       << "' metadata: " << message;
+          });
+      if (interner != nullptr && state_.field_error.ok()) {
+        md = interner->Intern(interned_value.as_string_view(), std::move(*md));
+      }
+    }
     HPackTable::Memento memento{
-        std::move(md), state_.field_error.PersistentStreamErrorOrNullptr()};
+        std::move(*md), state_.field_error.PersistentStreamErrorOrNullptr()};
     input_->UpdateFrontier();
     state_.parse_state = ParseState::kTop;
     if (state_.add_to_table) {
@@ -1068,12 +1097,17 @@ class HPackParser::Parser {
   Input* const input_;
   grpc_metadata_batch*& metadata_buffer_;
   InterSliceState& state_;
+  HPackParserInterner::Cache* const interner_;
   const LogInfo log_info_;
 };
 
 Slice HPackParser::String::Take() {
   if (auto* p = std::get_if<Slice>(&value_)) {
-    return p->Copy();
+    // The slice references the read buffer, and ParseUncompressed() only
+    // produces one when the value is worth pinning it. Entries added to the
+    // table are still copied when they are parsed, so the table never pins a
+    // read buffer.
+    return std::move(*p);
   } else if (auto* p = std::get_if<absl::Span<const uint8_t>>(&value_)) {
     return Slice::FromCopiedBuffer(*p);
   } else if (auto* p = std::get_if<std::vector<uint8_t>>(&value_)) {
@@ -1174,9 +1208,12 @@ void HPackParser::ParseInputInner(Input* input) {
       priority_ = Priority::None;
     }
   }
+  HPackParserInterner::Cache* interner =
+      interner_.has_value() ? &*interner_ : nullptr;
   while (!input->end_of_stream()) {
     if (GPR_UNLIKELY(
-            !Parser(input, metadata_buffer_, state_, log_info_).Parse())) {
+            !Parser(input, metadata_buffer_, state_, interner, log_info_)
+                 .Parse())) {
       return;
     }
     input->UpdateFrontier();
@@ -36,6 +36,7 @@
 #include "absl/types/span.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_interner.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/lib/iomgr/error.h"
@@ -43,6 +44,7 @@
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/random_early_detection.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 // IWYU pragma: no_include <type_traits>
 
@@ -108,6 +110,10 @@ class HPackParser {
 
   // Retrieve the associated hpack table (for tests, debugging)
   HPackTable* hpack_table() { return &state_.hpack_table; }
+  // Share the storage of new table entries through interner
+  void SetInterner(RefCountedPtr<HPackParserInterner> interner) {
+    interner_.emplace(std::move(interner));
+  }
   // Is the current frame a boundary of some sort
   bool is_boundary() const { return boundary_ != Boundary::None; }
   // Is the current frame the end of a stream
@@ -277,6 +283,8 @@ class HPackParser {
   // Information for logging
   LogInfo log_info_;
   InterSliceState state_;
+  // Shares table entries with the other connections of the channel, if set
+  std::optional<HPackParserInterner::Cache> interner_;
 };
 
 }  // namespace grpc_core
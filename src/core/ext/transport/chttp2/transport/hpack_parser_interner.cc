@@ -0,0 +1,163 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_interner.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/hash/hash.h"
+#include "absl/strings/match.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Interned entries parsed without error once, so parsing them again cannot
+// fail.
+void IgnoreParseError(absl::string_view, const Slice&) {}
+
+uint32_t ValueWireSize(absl::string_view key, uint32_t transport_size) {
+  return transport_size - key.size() - hpack_constants::kEntryOverhead;
+}
+
+}  // namespace
+
+bool HPackParserInterner::MayIntern(absl::string_view key) {
+  return !hpack_constants::IsCredentialHeader(key) &&
+         !absl::EndsWith(key, "-bin");
+}
+
+bool HPackParserInterner::MayInternEntry(absl::string_view key,
+                                         absl::string_view value) {
+  return hpack_constants::SizeForEntry(key.size(), value.size()) <=
+             kMaxEntryBytes &&
+         MayIntern(key);
+}
+
+size_t HPackParserInterner::ShardIndex(absl::string_view key,
+                                       absl::string_view value) {
+  return absl::HashOf(key, value) % kNumShards;
+}
+
+ParsedMetadata<grpc_metadata_batch> HPackParserInterner::Share(
+    const Entry& entry, uint32_t transport_size) {
+  // The interned value is compact and owned, so there is no need to copy it
+  // even though the result will live in a table.
+  return entry.md.WithNewValue(entry.value.Ref(),
+                               /*will_keep_past_request_lifetime=*/false,
+                               ValueWireSize(entry.md.key(), transport_size),
+                               IgnoreParseError);
+}
+
+std::optional<ParsedMetadata<grpc_metadata_batch>> HPackParserInterner::Lookup(
+    absl::string_view key, absl::string_view value, uint32_t transport_size) {
+  if (!MayInternEntry(key, value)) return std::nullopt;
+  RefCountedPtr<Entry> entry = Find(key, value);
+  if (entry == nullptr) return std::nullopt;
+  return Share(*entry, transport_size);
+}
+
+ParsedMetadata<grpc_metadata_batch> HPackParserInterner::Intern(
+    absl::string_view value, ParsedMetadata<grpc_metadata_batch> md) {
+  if (!MayInternEntry(md.key(), value)) return md;
+  RefCountedPtr<Entry> entry = Add(value, md);
+  if (entry == nullptr) return md;
+  return Share(*entry, md.transport_size());
+}
+
+RefCountedPtr<HPackParserInterner::Entry> HPackParserInterner::Find(
+    absl::string_view key, absl::string_view value) {
+  Shard& shard = shards_[ShardIndex(key, value)];
+  MutexLock lock(&shard.mu);
+  auto it = shard.entries.find(Key(key, value));
+  if (it == shard.entries.end()) return nullptr;
+  it->second->referenced.store(true, std::memory_order_relaxed);
+  return it->second;
+}
+
+RefCountedPtr<HPackParserInterner::Entry> HPackParserInterner::Add(
+    absl::string_view value, const ParsedMetadata<grpc_metadata_batch>& md) {
+  const size_t bytes = hpack_constants::SizeForEntry(md.key().size(),
+                                                     value.size());
+  auto entry = MakeRefCounted<Entry>();
+  entry->value = Slice::FromCopiedString(value);
+  entry->md = md.WithNewValue(entry->value.Ref(),
+                              /*will_keep_past_request_lifetime=*/false,
+                              ValueWireSize(md.key(), md.transport_size()),
+                              IgnoreParseError);
+  const Key key(entry->md.key(), entry->value.as_string_view());
+  Shard& shard = shards_[ShardIndex(key.first, key.second)];
+  MutexLock lock(&shard.mu);
+  auto it = shard.entries.find(key);
+  // Another connection interned the same entry first.
+  if (it != shard.entries.end()) return it->second;
+  if (!MakeRoomFor(shard, bytes)) return nullptr;
+  shard.entries.emplace(key, entry);
+  shard.order.push_back(key);
+  shard.bytes += bytes;
+  return entry;
+}
+
+bool HPackParserInterner::MakeRoomFor(Shard& shard, size_t bytes) {
+  static constexpr size_t kMaxShardBytes = kMaxBytes / kNumShards;
+  // Second chance eviction: entries looked up since they were last considered
+  // go to the back of the queue instead.
+  while (shard.bytes + bytes > kMaxShardBytes && !shard.order.empty()) {
+    const Key key = shard.order.front();
+    shard.order.pop_front();
+    auto it = shard.entries.find(key);
+    if (it->second->referenced.exchange(false, std::memory_order_relaxed)) {
+      shard.order.push_back(key);
+      continue;
+    }
+    shard.bytes -= hpack_constants::SizeForEntry(key.first.size(),
+                                                 key.second.size());
+    it->second->forgotten.store(true, std::memory_order_relaxed);
+    shard.entries.erase(it);
+  }
+  return shard.bytes + bytes <= kMaxShardBytes;
+}
+
+std::optional<ParsedMetadata<grpc_metadata_batch>>
+HPackParserInterner::Cache::Lookup(absl::string_view key,
+                                   absl::string_view value,
+                                   uint32_t transport_size) {
+  if (!MayInternEntry(key, value)) return std::nullopt;
+  RefCountedPtr<Entry>& slot = slots_[absl::HashOf(key, value) % kNumSlots];
+  if (slot != nullptr && slot->forgotten.load(std::memory_order_relaxed)) {
+    slot.reset();
+  }
+  if (slot == nullptr || !slot->Matches(key, value)) {
+    RefCountedPtr<Entry> entry = interner_->Find(key, value);
+    if (entry == nullptr) return std::nullopt;
+    slot = std::move(entry);
+  } else {
+    slot->referenced.store(true, std::memory_order_relaxed);
+  }
+  return Share(*slot, transport_size);
+}
+
+ParsedMetadata<grpc_metadata_batch> HPackParserInterner::Cache::Intern(
+    absl::string_view value, ParsedMetadata<grpc_metadata_batch> md) {
+  if (!MayInternEntry(md.key(), value)) return md;
+  RefCountedPtr<Entry> entry = interner_->Add(value, md);
+  if (entry == nullptr) return md;
+  ParsedMetadata<grpc_metadata_batch> shared =
+      Share(*entry, md.transport_size());
+  slots_[absl::HashOf(md.key(), value) % kNumSlots] = std::move(entry);
+  return shared;
+}
+
+}  // namespace grpc_core
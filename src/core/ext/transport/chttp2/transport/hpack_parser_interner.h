@@ -0,0 +1,177 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_PARSER_INTERNER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_PARSER_INTERNER_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <optional>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/call/parsed_metadata.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// Shares storage between identical HPACK dynamic table entries decoded by
+// different connections of a channel or server.
+//
+// Every connection learns the headers its peer keeps sending (authority,
+// user-agent, application metadata) into its own dynamic table, and each
+// table entry normally holds private copies of its key and value. A client
+// with thousands of connections to the same backends therefore holds
+// thousands of copies of the same few strings. Entries added through the
+// interner instead share a single refcounted copy of their key and value.
+//
+// The interner remembers a bounded number of bytes of entries, and is owned
+// by the channel args of the channel or server whose transports use it, so
+// its entries go away with them. Forgetting an entry does not affect the
+// tables still using it: they keep their references, and later connections
+// simply intern a fresh copy. Credentials and binary headers are never
+// interned, so that they are not kept past the tables holding them.
+//
+// Entries are spread over kNumShards independently locked shards. Each
+// parser also goes through a Cache of the entries it used last, which it
+// looks up without taking any lock.
+class HPackParserInterner : public RefCounted<HPackParserInterner> {
+ private:
+  struct Entry;
+
+ public:
+  static constexpr size_t kNumShards = 16;
+  // Total size, by the HPACK definition, of the entries remembered.
+  static constexpr size_t kMaxBytes = 256 * 1024;
+  // Entries larger than this are not interned.
+  static constexpr size_t kMaxEntryBytes = 4096;
+
+  // The entries a single parser looked up or interned last. Not thread safe.
+  class Cache {
+   public:
+    static constexpr size_t kNumSlots = 8;
+
+    explicit Cache(RefCountedPtr<HPackParserInterner> interner)
+        : interner_(std::move(interner)) {}
+
+    // Same as HPackParserInterner::Lookup() and HPackParserInterner::Intern().
+    std::optional<ParsedMetadata<grpc_metadata_batch>> Lookup(
+        absl::string_view key, absl::string_view value,
+        uint32_t transport_size);
+    ParsedMetadata<grpc_metadata_batch> Intern(
+        absl::string_view value, ParsedMetadata<grpc_metadata_batch> md);
+
+   private:
+    RefCountedPtr<HPackParserInterner> interner_;
+    RefCountedPtr<Entry> slots_[kNumSlots];
+  };
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.hpack_parser_interner";
+  }
+  static int ChannelArgsCompare(const HPackParserInterner* a,
+                                const HPackParserInterner* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns false for headers that must not outlive the connection that
+  // received them: credentials, cookies and binary headers.
+  static bool MayIntern(absl::string_view key);
+
+  // Returns an entry for key and value sharing the storage of an identical
+  // entry interned earlier, or nullopt if there is none.
+  std::optional<ParsedMetadata<grpc_metadata_batch>> Lookup(
+      absl::string_view key, absl::string_view value, uint32_t transport_size);
+
+  // Interns md, which was parsed without error from value, and returns an
+  // equivalent entry sharing the interned storage. Returns md itself if it
+  // may not be interned.
+  ParsedMetadata<grpc_metadata_batch> Intern(
+      absl::string_view value, ParsedMetadata<grpc_metadata_batch> md);
+
+  // Returns the shard key and value belong to.
+  static size_t ShardIndex(absl::string_view key, absl::string_view value);
+
+  size_t TestOnlyBytes() {
+    size_t bytes = 0;
+    for (Shard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      bytes += shard.bytes;
+    }
+    return bytes;
+  }
+
+ private:
+  struct Entry : public RefCounted<Entry, NonPolymorphicRefCount> {
+    // The interned value.
+    Slice value;
+    // The entry as first parsed, holding the interned key.
+    ParsedMetadata<grpc_metadata_batch> md;
+    // Set by lookups; entries are only forgotten once unset.
+    std::atomic<bool> referenced{false};
+    // Set once the entry is forgotten, so that caches drop it.
+    std::atomic<bool> forgotten{false};
+
+    bool Matches(absl::string_view key, absl::string_view value) const {
+      return md.key() == key && this->value.as_string_view() == value;
+    }
+  };
+  using Key = std::pair<absl::string_view, absl::string_view>;
+
+  struct Shard {
+    Mutex mu;
+    // Keys point into the entries they map to.
+    absl::flat_hash_map<Key, RefCountedPtr<Entry>> entries
+        ABSL_GUARDED_BY(mu);
+    // Keys in the order they were interned, for eviction.
+    std::deque<Key> order ABSL_GUARDED_BY(mu);
+    size_t bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  // Returns whether an entry of key and value may be interned.
+  static bool MayInternEntry(absl::string_view key, absl::string_view value);
+
+  // Returns md sharing the storage of entry.
+  static ParsedMetadata<grpc_metadata_batch> Share(const Entry& entry,
+                                                   uint32_t transport_size);
+
+  // Returns the entry for key and value, or nullptr if there is none.
+  RefCountedPtr<Entry> Find(absl::string_view key, absl::string_view value);
+  // Returns the entry for md, interning it if needed, or nullptr if it could
+  // not be interned.
+  RefCountedPtr<Entry> Add(absl::string_view value,
+                           const ParsedMetadata<grpc_metadata_batch>& md);
+
+  // Forgets entries of shard until one of the given size fits, or returns
+  // false.
+  static bool MakeRoomFor(Shard& shard, size_t bytes)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+
+  Shard shards_[kNumShards];
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HPACK_PARSER_INTERNER_H
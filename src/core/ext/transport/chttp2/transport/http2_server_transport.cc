@@ -19,38 +19,66 @@
 #include "src/core/ext/transport/chttp2/transport/http2_server_transport.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
 #include "src/core/call/call_destination.h"
+#include "src/core/call/call_spine.h"
+#include "src/core/call/message.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/header_assembler.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/ext/transport/chttp2/transport/http2_settings.h"
+#include "src/core/ext/transport/chttp2/transport/http2_settings_manager.h"
+#include "src/core/ext/transport/chttp2/transport/http2_status.h"
+#include "src/core/ext/transport/chttp2/transport/internal_channel_arg_names.h"
+#include "src/core/ext/transport/chttp2/transport/message_assembler.h"
+#include "src/core/ext/transport/chttp2/transport/transport_common.h"
 #include "src/core/lib/channel/channel_args.h"
-#include "src/core/lib/debug/trace_impl.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/match_promise.h"
 #include "src/core/lib/promise/party.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
+#include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
-#include "src/core/util/ref_counted.h"
+#include "src/core/util/latent_see.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 namespace http2 {
 
-#define GRPC_HTTP2_SERVER_DLOG \
-  DLOG_IF(INFO, GRPC_TRACE_FLAG_ENABLED(http2_ph2_transport))
-
 using grpc_event_engine::experimental::EventEngine;
 
 // Experimental : This is just the initial skeleton of class
@@ -60,144 +88,604 @@ using grpc_event_engine::experimental::EventEngine;
 // TODO(tjagtap) : [PH2][P3] : Delete this comment when http2
 // rollout begins
 
-// TODO(akshitpatel) : [PH2][P2] : Choose appropriate size later.
-// TODO(tjagtap) : [PH2][P2] : Consider moving to common code.
-constexpr int kMpscSize = 10;
+namespace {
+
+// How long the transport waits for the GOAWAY frame it sends while closing to
+// be written before it closes the endpoint regardless.
+constexpr Duration kGoawayWriteTimeout = Duration::Seconds(5);
+
+// How long a graceful GOAWAY waits for the ack of its ping before it sends the
+// final GOAWAY regardless. Same as CHTTP2.
+constexpr Duration kGracefulGoawayPingTimeout = Duration::Seconds(20);
+
+Http2Status AbslStatusToHttp2Status(const absl::Status& status) {
+  return (status.ok()) ? Http2Status::Ok()
+                       : Http2Status::AbslConnectionError(
+                             status.code(), std::string(status.message()));
+}
+
+}  // namespace
 
 void Http2ServerTransport::SetCallDestination(
     RefCountedPtr<UnstartedCallDestination> call_destination) {
-  // TODO(tjagtap) : [PH2][P2] : Implement this function.
   CHECK(call_destination_ == nullptr);
   CHECK(call_destination != nullptr);
-  call_destination_ = call_destination;
-  // got_acceptor_.Set(); // Copied from CG. Understand and fix.
+  call_destination_ = std::move(call_destination);
+  got_call_destination_.Set();
 }
 
-void Http2ServerTransport::PerformOp(GRPC_UNUSED grpc_transport_op*) {
+void Http2ServerTransport::PerformOp(grpc_transport_op* op) {
+  // Notes : Refer : src/core/ext/transport/chaotic_good/server_transport.cc
+  // Functions : StartConnectivityWatch, StopConnectivityWatch, PerformOp
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport PerformOp Begin";
-  // TODO(tjagtap) : [PH2][P2] : Implement this function.
+  if (op->start_connectivity_watch != nullptr) {
+    StartConnectivityWatch(op->start_connectivity_watch_state,
+                           std::move(op->start_connectivity_watch));
+  }
+  if (op->stop_connectivity_watch != nullptr) {
+    StopConnectivityWatch(op->stop_connectivity_watch);
+  }
+  if (op->set_accept_stream) {
+    // Streams are always handed to the call destination.
+    LOG_IF(ERROR, op->set_accept_stream_fn != nullptr)
+        << "set_accept_stream not supported on promise based http2 servers";
+  }
+  if (!op->goaway_error.ok()) {
+    Http2ErrorCode error_code = Http2ErrorCode::kNoError;
+    std::string message;
+    grpc_error_get_status(op->goaway_error, Timestamp::InfFuture(), nullptr,
+                          &message, &error_code, nullptr);
+    SendGracefulGoaway(error_code, message);
+  }
+  if (!op->disconnect_with_error.ok()) {
+    Http2ErrorCode error_code = Http2ErrorCode::kNoError;
+    std::string message;
+    grpc_error_get_status(op->disconnect_with_error, Timestamp::InfFuture(),
+                          nullptr, &message, &error_code, nullptr);
+    MaybeSpawnCloseTransport(
+        Http2Status::AbslConnectionError(absl::StatusCode::kUnavailable,
+                                         std::move(message)),
+        error_code);
+  }
+  ExecCtx::Run(DEBUG_LOCATION, op->on_consumed, absl::OkStatus());
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport PerformOp End";
 }
 
+void Http2ServerTransport::StartConnectivityWatch(
+    grpc_connectivity_state state,
+    OrphanablePtr<ConnectivityStateWatcherInterface> watcher) {
+  MutexLock lock(&transport_mutex_);
+  state_tracker_.AddWatcher(state, std::move(watcher));
+}
+
+void Http2ServerTransport::StopConnectivityWatch(
+    ConnectivityStateWatcherInterface* watcher) {
+  MutexLock lock(&transport_mutex_);
+  state_tracker_.RemoveWatcher(watcher);
+}
+
 void Http2ServerTransport::Orphan() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport Orphan Begin";
-  // TODO(tjagtap) : [PH2][P2] : Implement the needed cleanup
-  general_party_.reset();
+  // Accessing general_party here is not advisable. It may so happen that
+  // the party is already freed/may free up any time. The only guarantee here
+  // is that the transport is still valid.
+  MaybeSpawnCloseTransport(
+      Http2Status::AbslConnectionError(absl::StatusCode::kUnavailable,
+                                       "Orphaned"),
+      Http2ErrorCode::kNoError);
   Unref();
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport Orphan End";
 }
 
 void Http2ServerTransport::AbortWithError() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport AbortWithError Begin";
-  // TODO(tjagtap) : [PH2][P2] : Implement this function.
+  MaybeSpawnCloseTransport(
+      Http2Status::AbslConnectionError(absl::StatusCode::kUnavailable,
+                                       "Transport aborted"),
+      Http2ErrorCode::kInternalError);
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport AbortWithError End";
 }
 
-Http2Status ProcessHttp2DataFrame(Http2DataFrame frame) {
+///////////////////////////////////////////////////////////////////////////////
+// Processing each type of frame
+
+Http2Status Http2ServerTransport::ProcessHttp2DataFrame(Http2DataFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-data
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2DataFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2DataFrame Promise { stream_id="
-      << frame.stream_id << ", end_stream=" << frame.end_stream
-      << ", payload=" << frame.payload.JoinIntoString() << "}";
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessHttp2DataFrame { "
+                            "stream_id="
+                         << frame.stream_id
+                         << ", end_stream=" << frame.end_stream
+                         << ", length=" << frame.payload.Length() << "}";
+  ping_manager_.ReceivedDataFrame();
+
+  RefCountedPtr<Stream> stream = LookupStream(frame.stream_id);
+
+  // RFC9113 : The entire DATA frame payload is included in flow control,
+  // including the Pad Length and Padding fields if present. This holds even
+  // for frames of streams that are already closed.
+  {
+    MutexLock lock(&transport_mutex_);
+    const int64_t flow_controlled_bytes = current_frame_header_.length;
+    absl::Status flow_control_status;
+    chttp2::FlowControlAction action;
+    if (stream == nullptr) {
+      chttp2::TransportFlowControl::IncomingUpdateContext update(
+          &flow_control_);
+      flow_control_status = update.RecvData(flow_controlled_bytes);
+      action = update.MakeAction();
+    } else {
+      chttp2::StreamFlowControl::IncomingUpdateContext update(
+          &stream->flow_control);
+      flow_control_status = update.RecvData(flow_controlled_bytes);
+      // Messages are handed to the call as soon as they are complete, so no
+      // received data is waiting to be read by the application.
+      update.SetPendingSize(0);
+      action = update.MakeAction();
+    }
+    if (!flow_control_status.ok()) {
+      return Http2Status::Http2ConnectionError(
+          Http2ErrorCode::kFlowControlError,
+          std::string(flow_control_status.message()));
+    }
+    // The peer sends nothing more on a stream after END_STREAM, so there is no
+    // point in opening the window of such a stream.
+    if (stream != nullptr && !frame.end_stream &&
+        action.send_stream_update() ==
+            chttp2::FlowControlAction::Urgency::UPDATE_IMMEDIATELY) {
+      const uint32_t increment = stream->flow_control.MaybeSendUpdate();
+      if (increment > 0) {
+        pending_window_updates_.emplace_back(
+            Http2WindowUpdateFrame{frame.stream_id, increment});
+      }
+    }
+    if (action.send_transport_update() ==
+        chttp2::FlowControlAction::Urgency::UPDATE_IMMEDIATELY) {
+      const uint32_t increment =
+          flow_control_.MaybeSendUpdate(/*writing_anyway=*/false);
+      if (increment > 0) {
+        pending_window_updates_.emplace_back(
+            Http2WindowUpdateFrame{/*stream_id=*/0, increment});
+      }
+    }
+  }
+
+  if (stream == nullptr) {
+    // RFC9113 : If a DATA frame is received whose stream is not in the "open"
+    // or "half-closed (local)" state, the recipient MUST respond with a stream
+    // error (Section 5.4.2) of type STREAM_CLOSED.
+    // Frames for streams that this server has already reset are expected
+    // though, because the peer may have sent them before it saw the
+    // RST_STREAM. These are dropped.
+    GRPC_HTTP2_SERVER_DLOG
+        << "Http2ServerTransport ProcessHttp2DataFrame { stream_id="
+        << frame.stream_id << "} Lookup Failed";
+    return Http2Status::Ok();
+  }
+
+  if (stream->GetStreamState() == HttpStreamState::kHalfClosedRemote ||
+      stream->GetStreamState() == HttpStreamState::kClosed) {
+    return Http2Status::Http2StreamError(
+        Http2ErrorCode::kStreamClosed,
+        std::string(RFC9113::kHalfClosedRemoteState));
+  }
+  if (!stream->did_receive_initial_metadata) {
+    // RFC9113 : DATA frames are only allowed once the HEADERS of the request
+    // have been received.
+    return Http2Status::Http2StreamError(
+        Http2ErrorCode::kProtocolError,
+        "DATA frame received before the request HEADERS");
+  }
+
+  GrpcMessageAssembler& assembler = stream->assembler;
+  Http2Status status =
+      assembler.AppendNewDataFrame(frame.payload, frame.end_stream);
+  if (!status.IsOk()) {
+    return status;
+  }
+
+  // Pass the messages up the stack if it is ready.
+  while (true) {
+    ValueOrHttp2Status<MessageHandle> result = assembler.ExtractMessage();
+    if (!result.IsOk()) {
+      return ValueOrHttp2Status<MessageHandle>::TakeStatus(std::move(result));
+    }
+    MessageHandle message = TakeValue(std::move(result));
+    if (message == nullptr) break;
+    GRPC_HTTP2_SERVER_DLOG
+        << "Http2ServerTransport ProcessHttp2DataFrame SpawnPushMessage "
+        << message->DebugString();
+    stream->call->SpawnPushMessage(std::move(message));
+  }
+
+  if (frame.end_stream) {
+    stream->call->SpawnFinishSends();
+    CloseStream(frame.stream_id, absl::OkStatus(),
+                CloseStreamArgs{
+                    /*close_reads=*/true,
+                    /*close_writes=*/false,
+                    /*send_rst_stream=*/false,
+                    /*cancel_call=*/false,
+                });
+  }
   return Http2Status::Ok();
 }
 
-Http2Status ProcessHttp2HeaderFrame(Http2HeaderFrame frame) {
+Http2Status Http2ServerTransport::ProcessHttp2HeaderFrame(
+    Http2HeaderFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-headers
   GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2HeaderFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2HeaderFrame Promise { stream_id="
+      << "Http2ServerTransport ProcessHttp2HeaderFrame { stream_id="
       << frame.stream_id << ", end_headers=" << frame.end_headers
       << ", end_stream=" << frame.end_stream
-      << ", payload=" << frame.payload.JoinIntoString() << " }";
+      << ", length=" << frame.payload.Length() << " }";
+  ping_manager_.ReceivedDataFrame();
+
+  incoming_header_in_progress_ = !frame.end_headers;
+  incoming_header_stream_id_ = frame.stream_id;
+  incoming_header_end_stream_ = frame.end_stream;
+
+  RefCountedPtr<Stream> stream = LookupStream(frame.stream_id);
+  if (stream == nullptr) {
+    MutexLock lock(&transport_mutex_);
+    // RFC9113 : Streams initiated by a client MUST use odd-numbered stream
+    // identifiers.
+    if ((frame.stream_id % 2) == 0) {
+      return Http2Status::Http2ConnectionError(
+          Http2ErrorCode::kProtocolError,
+          "HEADERS frame with an even stream id");
+    }
+    if (frame.stream_id <= last_seen_new_stream_id_) {
+      // A stream that this server has already closed. The client may have
+      // sent its trailers before it saw the RST_STREAM. As in CHTTP2, the
+      // headers of lower stream ids that were never opened are discarded too,
+      // instead of being treated as a connection error.
+      return StartDiscardingHeaders(std::move(frame));
+    }
+    last_seen_new_stream_id_ = frame.stream_id;
+    // The stream is created even if it is going to be refused, because its
+    // header block must be decoded to keep the HPACK state in sync.
+    stream = MakeRefCounted<Stream>(frame.stream_id, &flow_control_);
+    stream_list_.emplace(frame.stream_id, stream);
+  } else if (stream->GetStreamState() == HttpStreamState::kHalfClosedRemote ||
+             stream->GetStreamState() == HttpStreamState::kClosed) {
+    // The header block of a rejected frame is still decoded, to keep the
+    // HPACK state in sync with the peer.
+    Http2Status discard_status = StartDiscardingHeaders(std::move(frame));
+    if (!discard_status.IsOk()) return discard_status;
+    return Http2Status::Http2StreamError(
+        Http2ErrorCode::kStreamClosed,
+        std::string(RFC9113::kHalfClosedRemoteState));
+  } else if (!frame.end_stream) {
+    Http2Status discard_status = StartDiscardingHeaders(std::move(frame));
+    if (!discard_status.IsOk()) return discard_status;
+    return Http2Status::Http2StreamError(
+        Http2ErrorCode::kProtocolError,
+        "gRPC Error : A gRPC client can send upto 1 initial metadata followed "
+        "by upto 1 trailing metadata, which must end the stream");
+  }
+
+  // The CONTINUATION frames of this header block belong to this stream even
+  // if it is closed before the block is complete.
+  if (!frame.end_headers) incoming_header_stream_ = stream;
+  Http2Status append_result =
+      stream->header_assembler.AppendHeaderFrame(std::move(frame));
+  if (!append_result.IsOk()) {
+    return append_result;
+  }
+  return ProcessMetadata(std::move(stream));
+}
+
+Http2Status Http2ServerTransport::ProcessMetadata(
+    RefCountedPtr<Stream> stream) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessMetadata";
+  if (!stream->header_assembler.IsReady()) {
+    return Http2Status::Ok();
+  }
+  const uint32_t stream_id = stream->stream_id;
+  const bool is_initial_metadata = !stream->did_receive_initial_metadata;
+  ValueOrHttp2Status<Arena::PoolPtr<grpc_metadata_batch>> read_result =
+      stream->header_assembler.ReadMetadata(parser_, is_initial_metadata,
+                                            /*is_client=*/false);
+  if (!read_result.IsOk()) {
+    GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessMetadata Failed";
+    return ValueOrHttp2Status<Arena::PoolPtr<grpc_metadata_batch>>::TakeStatus(
+        std::move(read_result));
+  }
+  Arena::PoolPtr<grpc_metadata_batch> metadata =
+      TakeValue(std::move(read_result));
+  // A stream that was closed while its header block was in flight has been
+  // decoded only to keep the HPACK state in sync.
+  if (LookupStream(stream_id) == nullptr) return Http2Status::Ok();
+
+  if (!is_initial_metadata) {
+    // Trailers sent by a client carry nothing that gRPC uses, they only end
+    // the stream.
+    stream->did_receive_trailing_metadata = true;
+  } else {
+    stream->did_receive_initial_metadata = true;
+    Http2Status status = StartCall(stream_id, std::move(metadata));
+    if (!status.IsOk()) return status;
+  }
+
+  if (incoming_header_end_stream_) {
+    // The stream is gone if StartCall refused it.
+    if (stream->call.has_value()) {
+      stream->call->SpawnFinishSends();
+    }
+    CloseStream(stream_id, absl::OkStatus(),
+                CloseStreamArgs{
+                    /*close_reads=*/true,
+                    /*close_writes=*/false,
+                    /*send_rst_stream=*/false,
+                    /*cancel_call=*/false,
+                });
+  }
+  return Http2Status::Ok();
+}
+
+Http2Status Http2ServerTransport::StartDiscardingHeaders(
+    Http2HeaderFrame frame) {
+  const uint32_t stream_id = frame.stream_id;
+  discarded_headers_ = std::make_unique<HeaderAssembler>(stream_id);
+  Http2Status append_result =
+      discarded_headers_->AppendHeaderFrame(std::move(frame));
+  if (!append_result.IsOk()) return append_result;
+  return DiscardHeaders(stream_id);
+}
+
+Http2Status Http2ServerTransport::DiscardHeaders(const uint32_t stream_id) {
+  if (!discarded_headers_->IsReady()) return Http2Status::Ok();
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport DiscardHeaders stream_id="
+                         << stream_id;
+  std::unique_ptr<HeaderAssembler> assembler = std::move(discarded_headers_);
+  ValueOrHttp2Status<Arena::PoolPtr<grpc_metadata_batch>> read_result =
+      assembler->ReadMetadata(parser_, /*is_initial_metadata=*/false,
+                              /*is_client=*/false);
+  if (!read_result.IsOk()) {
+    return ValueOrHttp2Status<Arena::PoolPtr<grpc_metadata_batch>>::TakeStatus(
+        std::move(read_result));
+  }
   return Http2Status::Ok();
 }
 
-Http2Status ProcessHttp2RstStreamFrame(Http2RstStreamFrame frame) {
+Http2Status Http2ServerTransport::ProcessHttp2RstStreamFrame(
+    Http2RstStreamFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-rst_stream
   GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2RstStreamFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2RstStreamFrame Promise{ stream_id="
+      << "Http2ServerTransport ProcessHttp2RstStreamFrame { stream_id="
       << frame.stream_id << ", error_code=" << frame.error_code << " }";
+  Http2ErrorCode error_code =
+      Http2ErrorCodeFromRstFrameErrorCode(frame.error_code);
+  absl::StatusCode status_code = ErrorCodeToAbslStatusCode(error_code);
+  if (status_code == absl::StatusCode::kOk) {
+    // A client that resets a stream with NO_ERROR still abandons the call.
+    status_code = absl::StatusCode::kCancelled;
+  }
+  CloseStream(frame.stream_id,
+              absl::Status(status_code, "Reset stream frame received."),
+              CloseStreamArgs{
+                  /*close_reads=*/true,
+                  /*close_writes=*/true,
+                  /*send_rst_stream=*/false,
+                  /*cancel_call=*/true,
+              });
+  // In case of stream error, we do not want the Read Loop to be broken. Hence
+  // returning an ok status.
   return Http2Status::Ok();
 }
 
-Http2Status ProcessHttp2SettingsFrame(Http2SettingsFrame frame) {
+auto Http2ServerTransport::ProcessHttp2SettingsFrame(Http2SettingsFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-settings
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2SettingsFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  // Load into this.settings_
-  // Take necessary actions as per settings that have changed.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2SettingsFrame Promise { ack="
-      << frame.ack << ", settings length=" << frame.settings.size() << "}";
-  return Http2Status::Ok();
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessHttp2SettingsFrame { "
+                            "ack="
+                         << frame.ack
+                         << ", settings length=" << frame.settings.size()
+                         << "}";
+
+  // The server listener uses this to enforce the handshake deadline.
+  if (on_receive_settings_ != nullptr) {
+    ExecCtx::Run(DEBUG_LOCATION, std::exchange(on_receive_settings_, nullptr),
+                 absl::OkStatus());
+  }
+
+  Http2Status status = [&]() {
+    if (frame.ack) {
+      MutexLock lock(&transport_mutex_);
+      if (!settings_.AckLastSend()) {
+        return Http2Status::Http2ConnectionError(
+            Http2ErrorCode::kProtocolError,
+            "SETTINGS ACK received without any SETTINGS outstanding");
+      }
+      std::ignore = flow_control_.SetAckedInitialWindow(
+          settings_.acked().initial_window_size());
+      // Stops the settings timeout. The server only sends its SETTINGS once.
+      settings_acked_.Set();
+      return Http2Status::Ok();
+    }
+    // Check if the received settings have legal values
+    Http2Status validate_status = ValidateSettingsValues(frame.settings);
+    if (!validate_status.IsOk()) {
+      return validate_status;
+    }
+    MutexLock lock(&transport_mutex_);
+    const uint32_t old_initial_window_size =
+        settings_.peer().initial_window_size();
+    const uint32_t old_header_table_size = settings_.peer().header_table_size();
+    Http2ErrorCode error_code = settings_.ApplyIncomingSettings(frame.settings);
+    if (error_code != Http2ErrorCode::kNoError) {
+      return Http2Status::Http2ConnectionError(error_code,
+                                               "Invalid SETTINGS received");
+    }
+    if (settings_.peer().header_table_size() != old_header_table_size) {
+      pending_encoder_table_size_ = settings_.peer().header_table_size();
+    }
+    // RFC9113 : A change to SETTINGS_INITIAL_WINDOW_SIZE can cause the
+    // available space in a flow-control window to become positive.
+    if (settings_.peer().initial_window_size() != old_initial_window_size) {
+      WakeStalledWriters();
+    }
+    return Http2Status::Ok();
+  }();
+
+  const bool send_ack = status.IsOk() && !frame.ack;
+  return If(
+      send_ack,
+      [self = RefAsSubclass<Http2ServerTransport>()]() {
+        // RFC9113 : Upon receiving a SETTINGS frame without the ACK flag, the
+        // recipient MUST immediately emit a SETTINGS frame with the ACK flag
+        // set.
+        return Map(self->EnqueueOutgoingFrame(Http2SettingsFrame{true, {}}),
+                   [](absl::Status status) {
+                     return AbslStatusToHttp2Status(status);
+                   });
+      },
+      [status = std::move(status)]() mutable {
+        return Immediate(std::move(status));
+      });
 }
 
-Http2Status ProcessHttp2PingFrame(Http2PingFrame frame) {
+auto Http2ServerTransport::ProcessHttp2PingFrame(Http2PingFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-ping
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2PingFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2PingFrame Promise { ack="
-      << frame.ack << ", opaque=" << frame.opaque << " }";
-  return Http2Status::Ok();
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessHttp2PingFrame { ack="
+                         << frame.ack << ", opaque=" << frame.opaque << " }";
+  return AssertResultType<Http2Status>(If(
+      frame.ack,
+      [self = RefAsSubclass<Http2ServerTransport>(), opaque = frame.opaque]() {
+        // Received a ping ack.
+        return self->AckPing(opaque);
+      },
+      [self = RefAsSubclass<Http2ServerTransport>(), opaque = frame.opaque]() {
+        bool transport_idle;
+        {
+          MutexLock lock(&self->transport_mutex_);
+          transport_idle = !self->keepalive_permit_without_calls_ &&
+                           self->stream_list_.empty();
+        }
+        return If(
+            self->ping_manager_.NotifyPingAbusePolicy(transport_idle),
+            []() {
+              // The client sends pings more often than this server allows.
+              // CHTTP2 clients look for this debug data to back off their
+              // keepalive time.
+              return Immediate(Http2Status::Http2ConnectionError(
+                  Http2ErrorCode::kEnhanceYourCalm, "too_many_pings"));
+            },
+            [self, opaque]() {
+              // RFC9113: PING responses SHOULD be given higher priority than
+              // any other frame.
+              self->pending_ping_acks_.push_back(opaque);
+              return Map(self->TriggerWriteCycle(), [](absl::Status status) {
+                return AbslStatusToHttp2Status(status);
+              });
+            });
+      }));
 }
 
-Http2Status ProcessHttp2GoawayFrame(Http2GoawayFrame frame) {
+Http2Status Http2ServerTransport::ProcessHttp2GoawayFrame(
+    Http2GoawayFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-goaway
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2GoawayFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2GoawayFrame Promise { "
-         "last_stream_id="
-      << frame.last_stream_id << ", error_code=" << frame.error_code
-      << ", debug_data=" << frame.debug_data.as_string_view() << "}";
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessHttp2GoawayFrame { "
+                            "last_stream_id="
+                         << frame.last_stream_id
+                         << ", error_code=" << frame.error_code
+                         << ", debug_data=" << frame.debug_data.as_string_view()
+                         << "}";
+  const Http2ErrorCode error_code =
+      Http2ErrorCodeFromRstFrameErrorCode(frame.error_code);
+  if (error_code != Http2ErrorCode::kNoError) {
+    // The client will not use this connection any more.
+    return Http2Status::AbslConnectionError(
+        absl::StatusCode::kUnavailable,
+        absl::StrCat("GOAWAY received: ", frame.debug_data.as_string_view()));
+  }
+  // A server never opens streams, so a graceful GOAWAY from the client only
+  // means that the client will not open new streams either. Let the open
+  // streams complete, then close.
+  SendGracefulGoaway(Http2ErrorCode::kNoError, "GOAWAY received");
   return Http2Status::Ok();
 }
 
-Http2Status ProcessHttp2WindowUpdateFrame(Http2WindowUpdateFrame frame) {
+Http2Status Http2ServerTransport::ProcessHttp2WindowUpdateFrame(
+    Http2WindowUpdateFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-window_update
   GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2WindowUpdateFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2WindowUpdateFrame Promise { "
-         " stream_id="
+      << "Http2ServerTransport ProcessHttp2WindowUpdateFrame { stream_id="
       << frame.stream_id << ", increment=" << frame.increment << "}";
+  MutexLock lock(&transport_mutex_);
+  if (frame.stream_id == 0) {
+    // RFC9113 : A sender MUST NOT allow a flow-control window to exceed
+    // 2^31-1 octets. If a sender receives a WINDOW_UPDATE that causes a
+    // flow-control window to exceed this maximum, it MUST terminate either the
+    // stream or the connection, as appropriate.
+    if (flow_control_.remote_window() + frame.increment >
+        RFC9113::kMaxStreamId31Bit) {
+      return Http2Status::Http2ConnectionError(
+          Http2ErrorCode::kFlowControlError,
+          "WINDOW_UPDATE overflows the connection window");
+    }
+    chttp2::TransportFlowControl::OutgoingUpdateContext update(&flow_control_);
+    update.RecvUpdate(frame.increment);
+  } else {
+    auto it = stream_list_.find(frame.stream_id);
+    if (it == stream_list_.end()) {
+      // WINDOW_UPDATE frames for streams that were just closed are expected.
+      return Http2Status::Ok();
+    }
+    chttp2::StreamFlowControl& stream_flow_control = it->second->flow_control;
+    if (settings_.peer().initial_window_size() +
+            stream_flow_control.remote_window_delta() + frame.increment >
+        RFC9113::kMaxStreamId31Bit) {
+      return Http2Status::Http2StreamError(
+          Http2ErrorCode::kFlowControlError,
+          "WINDOW_UPDATE overflows the stream window");
+    }
+    chttp2::StreamFlowControl::OutgoingUpdateContext update(
+        &stream_flow_control);
+    update.RecvUpdate(frame.increment);
+  }
+  WakeStalledWriters();
   return Http2Status::Ok();
 }
 
-Http2Status ProcessHttp2ContinuationFrame(Http2ContinuationFrame frame) {
+Http2Status Http2ServerTransport::ProcessHttp2ContinuationFrame(
+    Http2ContinuationFrame frame) {
   // https://www.rfc-editor.org/rfc/rfc9113.html#name-continuation
   GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2ContinuationFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2ContinuationFrame Promise { "
-         "stream_id="
+      << "Http2ServerTransport ProcessHttp2ContinuationFrame { stream_id="
       << frame.stream_id << ", end_headers=" << frame.end_headers
-      << ", payload=" << frame.payload.JoinIntoString() << " }";
-  return Http2Status::Ok();
+      << ", length=" << frame.payload.Length() << " }";
+  incoming_header_in_progress_ = !frame.end_headers;
+  if (discarded_headers_ != nullptr) {
+    Http2Status result =
+        discarded_headers_->AppendContinuationFrame(std::move(frame));
+    if (!result.IsOk()) return result;
+    return DiscardHeaders(incoming_header_stream_id_);
+  }
+  // ValidateFrameHeader makes sure that a CONTINUATION frame follows the
+  // HEADERS of the same stream. The stream may have been closed in between, in
+  // which case the header block is still decoded, but dropped.
+  RefCountedPtr<Stream> stream = incoming_header_stream_;
+  if (frame.end_headers) incoming_header_stream_.reset();
+  if (stream == nullptr) {
+    return Http2Status::Http2ConnectionError(
+        Http2ErrorCode::kProtocolError,
+        "CONTINUATION frame without a header block in progress");
+  }
+  Http2Status result =
+      stream->header_assembler.AppendContinuationFrame(std::move(frame));
+  if (!result.IsOk()) {
+    return result;
+  }
+  return ProcessMetadata(std::move(stream));
 }
 
-Http2Status ProcessHttp2SecurityFrame(Http2SecurityFrame frame) {
+Http2Status Http2ServerTransport::ProcessHttp2SecurityFrame(
+    Http2SecurityFrame frame) {
   GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2SecurityFrame Factory";
-  // TODO(tjagtap) : [PH2][P2] : Implement this.
-  GRPC_HTTP2_SERVER_DLOG
-      << "Http2ServerTransport ProcessHttp2SecurityFrame Promise { payload="
+      << "Http2ServerTransport ProcessHttp2SecurityFrame { payload="
       << frame.payload.JoinIntoString() << " }";
+  // This transport never advertises allow_security_frame, so a client has no
+  // reason to send one. As CHTTP2 does in that case, the frame is ignored.
   return Http2Status::Ok();
 }
 
@@ -205,30 +693,48 @@ auto Http2ServerTransport::ProcessOneFrame(Http2Frame frame) {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ProcessOneFrame Factory";
   return AssertResultType<Http2Status>(MatchPromise(
       std::move(frame),
-      [](Http2DataFrame frame) {
-        return ProcessHttp2DataFrame(std::move(frame));
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2DataFrame frame) {
+        Http2Status status = self->ProcessHttp2DataFrame(std::move(frame));
+        // Write the WINDOW_UPDATE frames that the data made due.
+        const bool send_window_updates =
+            status.IsOk() && !self->pending_window_updates_.empty();
+        return If(
+            send_window_updates,
+            [self]() {
+              return Map(self->TriggerWriteCycle(), [](absl::Status status) {
+                return AbslStatusToHttp2Status(status);
+              });
+            },
+            [status = std::move(status)]() mutable {
+              return Immediate(std::move(status));
+            });
       },
-      [](Http2HeaderFrame frame) {
-        return ProcessHttp2HeaderFrame(std::move(frame));
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2HeaderFrame frame) {
+        return self->ProcessHttp2HeaderFrame(std::move(frame));
       },
-      [](Http2RstStreamFrame frame) {
-        return ProcessHttp2RstStreamFrame(frame);
+      [self =
+           RefAsSubclass<Http2ServerTransport>()](Http2RstStreamFrame frame) {
+        return self->ProcessHttp2RstStreamFrame(frame);
       },
-      [](Http2SettingsFrame frame) {
-        return ProcessHttp2SettingsFrame(std::move(frame));
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2SettingsFrame frame) {
+        return self->ProcessHttp2SettingsFrame(std::move(frame));
       },
-      [](Http2PingFrame frame) { return ProcessHttp2PingFrame(frame); },
-      [](Http2GoawayFrame frame) {
-        return ProcessHttp2GoawayFrame(std::move(frame));
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2PingFrame frame) {
+        return self->ProcessHttp2PingFrame(frame);
       },
-      [](Http2WindowUpdateFrame frame) {
-        return ProcessHttp2WindowUpdateFrame(frame);
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2GoawayFrame frame) {
+        return self->ProcessHttp2GoawayFrame(std::move(frame));
       },
-      [](Http2ContinuationFrame frame) {
-        return ProcessHttp2ContinuationFrame(std::move(frame));
+      [self = RefAsSubclass<Http2ServerTransport>()](
+          Http2WindowUpdateFrame frame) {
+        return self->ProcessHttp2WindowUpdateFrame(frame);
       },
-      [](Http2SecurityFrame frame) {
-        return ProcessHttp2SecurityFrame(std::move(frame));
+      [self = RefAsSubclass<Http2ServerTransport>()](
+          Http2ContinuationFrame frame) {
+        return self->ProcessHttp2ContinuationFrame(std::move(frame));
+      },
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2SecurityFrame frame) {
+        return self->ProcessHttp2SecurityFrame(std::move(frame));
       },
       [](GRPC_UNUSED Http2UnknownFrame frame) {
         // As per HTTP2 RFC, implementations MUST ignore and discard frames of
@@ -242,138 +748,844 @@ auto Http2ServerTransport::ProcessOneFrame(Http2Frame frame) {
       }));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Read Related Promises and Promise Factories
+
+auto Http2ServerTransport::ReadConnectionPreface() {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ReadConnectionPreface";
+  return AssertResultType<absl::Status>(TrySeq(
+      EndpointReadSlice(GRPC_CHTTP2_CLIENT_CONNECT_STRLEN),
+      [self = RefAsSubclass<Http2ServerTransport>()](Slice preface) {
+        // RFC9113 : Clients and servers MUST treat an invalid connection
+        // preface as a connection error (Section 5.4.1) of type
+        // PROTOCOL_ERROR.
+        if (preface.as_string_view() !=
+            absl::string_view(GRPC_CHTTP2_CLIENT_CONNECT_STRING,
+                              GRPC_CHTTP2_CLIENT_CONNECT_STRLEN)) {
+          return self->HandleError(Http2Status::Http2ConnectionError(
+              Http2ErrorCode::kProtocolError, "Invalid connection preface"));
+        }
+        return absl::OkStatus();
+      }));
+}
+
 auto Http2ServerTransport::ReadAndProcessOneFrame() {
   GRPC_HTTP2_SERVER_DLOG
       << "Http2ServerTransport ReadAndProcessOneFrame Factory";
   return AssertResultType<absl::Status>(TrySeq(
       // Fetch the first kFrameHeaderSize bytes of the Frame, these contain
       // the frame header.
-      endpoint_.ReadSlice(kFrameHeaderSize),
+      EndpointReadSlice(kFrameHeaderSize),
       // Parse the frame header.
       [](Slice header_bytes) -> Http2FrameHeader {
-        GRPC_HTTP2_SERVER_DLOG
-            << "Http2ServerTransport ReadAndProcessOneFrame Parse "
-            << header_bytes.as_string_view();
         return Http2FrameHeader::Parse(header_bytes.begin());
       },
+      // Validate the incoming frame as per the current state of the transport
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2FrameHeader header) {
+        Http2Status status = ValidateFrameHeader(
+            /*max_frame_size_setting*/ self->settings_.acked().max_frame_size(),
+            /*incoming_header_in_progress*/ self->incoming_header_in_progress_,
+            /*incoming_header_stream_id*/ self->incoming_header_stream_id_,
+            /*current_frame_header*/ header);
+        if (!status.IsOk()) {
+          return self->HandleError(std::move(status));
+        }
+        GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ReadAndProcessOneFrame "
+                                  "Validated Frame Header:"
+                               << header.ToString();
+        self->current_frame_header_ = header;
+        return absl::OkStatus();
+      },
       // Read the payload of the frame.
-      [this](Http2FrameHeader header) {
-        GRPC_HTTP2_SERVER_DLOG
-            << "Http2ServerTransport ReadAndProcessOneFrame Read";
-        current_frame_header_ = header;
+      [self = RefAsSubclass<Http2ServerTransport>()]() {
         return AssertResultType<absl::StatusOr<SliceBuffer>>(
-            endpoint_.Read(header.length));
+            self->EndpointRead(self->current_frame_header_.length));
       },
       // Parse the payload of the frame based on frame type.
-      [this](SliceBuffer payload) -> absl::StatusOr<Http2Frame> {
-        GRPC_HTTP2_SERVER_DLOG
-            << "Http2ServerTransport ReadAndProcessOneFrame ParseFramePayload "
-            << payload.JoinIntoString();
+      [self = RefAsSubclass<Http2ServerTransport>()](
+          SliceBuffer payload) -> absl::StatusOr<Http2Frame> {
         ValueOrHttp2Status<Http2Frame> frame =
-            ParseFramePayload(current_frame_header_, std::move(payload));
-        if (frame.IsOk()) {
-          return TakeValue(std::move(frame));
+            ParseFramePayload(self->current_frame_header_, std::move(payload));
+        if (!frame.IsOk()) {
+          return self->HandleError(
+              ValueOrHttp2Status<Http2Frame>::TakeStatus(std::move(frame)));
         }
-
-        return HandleError(
-            ValueOrHttp2Status<Http2Frame>::TakeStatus(std::move(frame)));
+        return TakeValue(std::move(frame));
       },
-      [this](GRPC_UNUSED Http2Frame frame) {
+      [self = RefAsSubclass<Http2ServerTransport>()](Http2Frame frame) {
         GRPC_HTTP2_SERVER_DLOG
             << "Http2ServerTransport ReadAndProcessOneFrame ProcessOneFrame";
-        return Map(
-            ProcessOneFrame(std::move(frame)),
-            [self = RefAsSubclass<Http2ServerTransport>()](Http2Status status) {
-              if (status.IsOk()) {
-                return absl::OkStatus();
-              }
-              return self->HandleError(std::move(status));
-            });
+        return AssertResultType<absl::Status>(
+            Map(self->ProcessOneFrame(std::move(frame)),
+                [self](Http2Status status) {
+                  if (!status.IsOk()) {
+                    return self->HandleError(std::move(status));
+                  }
+                  return absl::OkStatus();
+                }));
       }));
 }
 
 auto Http2ServerTransport::ReadLoop() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ReadLoop Factory";
-  return AssertResultType<absl::Status>(Loop([this]() {
-    return TrySeq(ReadAndProcessOneFrame(), []() -> LoopCtl<absl::Status> {
-      GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport ReadLoop Continue";
-      return Continue();
-    });
-  }));
+  return AssertResultType<absl::Status>(TrySeq(
+      ReadConnectionPreface(),
+      [self = RefAsSubclass<Http2ServerTransport>()]() {
+        return Loop([self]() {
+          return TrySeq(self->ReadAndProcessOneFrame(),
+                        []() -> LoopCtl<absl::Status> {
+                          GRPC_HTTP2_SERVER_DLOG
+                              << "Http2ServerTransport ReadLoop Continue";
+                          return Continue();
+                        });
+        });
+      }));
 }
 
 auto Http2ServerTransport::OnReadLoopEnded() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport OnReadLoopEnded Factory";
   return
       [self = RefAsSubclass<Http2ServerTransport>()](absl::Status status) {
-        // TODO(tjagtap) : [PH2][P2] : Implement this.
         GRPC_HTTP2_SERVER_DLOG
             << "Http2ServerTransport OnReadLoopEnded Promise Status=" << status;
-        GRPC_UNUSED absl::Status error_status =
-            self->HandleError(Http2Status::AbslConnectionError(
-                status.code(), std::string(status.message())));
+        // If the read loop ended on a protocol error the transport is already
+        // closing, with a GOAWAY. Otherwise the endpoint failed, and there is
+        // no point in writing a GOAWAY to it.
+        self->MaybeSpawnCloseTransport(
+            Http2Status::AbslConnectionError(status.code(),
+                                             std::string(status.message())),
+            /*goaway_error_code=*/std::nullopt);
       };
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Write Related Promises and Promise Factories
+
 auto Http2ServerTransport::WriteFromQueue() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport WriteFromQueue Factory";
-  return []() -> Poll<absl::Status> {
-    // TODO(tjagtap) : [PH2][P2] : Implement this.
-    // Read from the mpsc queue and write it to endpoint
-    GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport WriteFromQueue Promise";
-    return Pending{};
-  };
+  return TrySeq(
+      outgoing_frames_.NextBatch(128),
+      [self = RefAsSubclass<Http2ServerTransport>()](
+          std::vector<Http2Frame> frames) {
+        self->AppendWindowUpdates(frames);
+        self->goaway_in_last_write_ = false;
+        for (const Http2Frame& frame : frames) {
+          if (std::holds_alternative<Http2GoawayFrame>(frame)) {
+            self->goaway_in_last_write_ = true;
+          } else if (std::holds_alternative<Http2DataFrame>(frame) ||
+                     std::holds_alternative<Http2HeaderFrame>(frame) ||
+                     std::holds_alternative<Http2WindowUpdateFrame>(frame)) {
+            // Only these frames reset the ping clock, see WriteLoop.
+            self->data_sent_in_last_write_ = true;
+          }
+        }
+        SliceBuffer output_buf;
+        Serialize(absl::Span<Http2Frame>(frames), output_buf);
+        uint64_t buffer_length = output_buf.Length();
+        GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport WriteFromQueue Promise";
+        return If(
+            buffer_length > 0,
+            [self, output_buffer = std::move(output_buf)]() mutable {
+              return Map(self->endpoint_.Write(std::move(output_buffer),
+                                               PromiseEndpoint::WriteArgs{}),
+                         [self](absl::Status status) {
+                           if (status.ok() && self->goaway_in_last_write_) {
+                             self->goaway_written_.Set();
+                           }
+                           return status;
+                         });
+            },
+            [] { return absl::OkStatus(); });
+      });
+}
+
+void Http2ServerTransport::AppendWindowUpdates(
+    std::vector<Http2Frame>& frames) {
+  // Window updates made due by the read loop ride along with the batch.
+  for (Http2Frame& frame : pending_window_updates_) {
+    frames.push_back(std::move(frame));
+  }
+  pending_window_updates_.clear();
+  if (frames.empty()) return;
+  // The read loop only queues the updates that are not urgent. As chttp2
+  // does, send them now that there is a write anyway: the windows of the
+  // streams that have data in this write and still receive, and the window
+  // of the transport.
+  MutexLock lock(&transport_mutex_);
+  const size_t num_frames = frames.size();
+  for (size_t i = 0; i < num_frames; ++i) {
+    const auto* data_frame = std::get_if<Http2DataFrame>(&frames[i]);
+    if (data_frame == nullptr) continue;
+    const uint32_t stream_id = data_frame->stream_id;
+    auto it = stream_list_.find(stream_id);
+    if (it == stream_list_.end()) continue;
+    Stream& stream = *it->second;
+    if (stream.GetStreamState() == HttpStreamState::kHalfClosedRemote ||
+        stream.IsClosed()) {
+      continue;
+    }
+    const uint32_t increment = stream.flow_control.MaybeSendUpdate();
+    if (increment > 0) {
+      frames.emplace_back(Http2WindowUpdateFrame{stream_id, increment});
+    }
+  }
+  const uint32_t increment =
+      flow_control_.MaybeSendUpdate(/*writing_anyway=*/true);
+  if (increment > 0) {
+    frames.emplace_back(Http2WindowUpdateFrame{/*stream_id=*/0, increment});
+  }
 }
 
 auto Http2ServerTransport::WriteLoop() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport WriteLoop Factory";
-  return AssertResultType<absl::Status>(Loop([this]() {
-    return TrySeq(WriteFromQueue(), []() -> LoopCtl<absl::Status> {
-      GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport WriteLoop Continue";
-      return Continue();
-    });
-  }));
+  return AssertResultType<absl::Status>(
+      Loop([self = RefAsSubclass<Http2ServerTransport>()]() {
+        self->data_sent_in_last_write_ = false;
+        return TrySeq(
+            self->WriteFromQueue(), [self] { return self->MaybeSendPing(); },
+            [self] { return self->MaybeSendPingAcks(); },
+            [self]() -> LoopCtl<absl::Status> {
+              // If any Header/Data/WindowUpdate frame was sent in the last
+              // write, reset the ping clock. For a server this also forgives
+              // the ping strikes of the client.
+              if (self->data_sent_in_last_write_) {
+                self->ping_manager_.ResetPingClock(/*is_client=*/false);
+              }
+              GRPC_HTTP2_SERVER_DLOG
+                  << "Http2ServerTransport WriteLoop Continue";
+              return Continue();
+            });
+      }));
 }
 
 auto Http2ServerTransport::OnWriteLoopEnded() {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport OnWriteLoopEnded Factory";
   return
       [self = RefAsSubclass<Http2ServerTransport>()](absl::Status status) {
-        // TODO(tjagtap) : [PH2][P2] : Implement this.
         GRPC_HTTP2_SERVER_DLOG
             << "Http2ServerTransport OnWriteLoopEnded Promise Status="
             << status;
-        GRPC_UNUSED absl::Status error_status =
-            self->HandleError(Http2Status::AbslConnectionError(
-                status.code(), std::string(status.message())));
+        // The write loop only ends when the endpoint fails or the transport
+        // is already closing, so a GOAWAY could not be written anyway.
+        self->MaybeSpawnCloseTransport(
+            Http2Status::AbslConnectionError(status.code(),
+                                             std::string(status.message())),
+            /*goaway_error_code=*/std::nullopt);
       };
 }
 
-Http2ServerTransport::Http2ServerTransport(
-    PromiseEndpoint endpoint, GRPC_UNUSED const ChannelArgs& channel_args,
-    std::shared_ptr<EventEngine> event_engine)
-    : endpoint_(std::move(endpoint)), outgoing_frames_(kMpscSize) {
-  // TODO(tjagtap) : [PH2][P2] : Save and apply channel_args.
-  // TODO(tjagtap) : [PH2][P2] : Initialize settings_ to appropriate values.
+///////////////////////////////////////////////////////////////////////////////
+// Constructor Destructor
 
+Http2ServerTransport::Http2ServerTransport(
+    PromiseEndpoint endpoint, const ChannelArgs& channel_args,
+    std::shared_ptr<EventEngine> event_engine,
+    grpc_closure* on_receive_settings, grpc_closure* on_close)
+    : endpoint_(std::move(endpoint)),
+      call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
+          channel_args.GetObject<ResourceQuota>()
+              ->memory_quota()
+              ->CreateMemoryAllocator("http2_server"),
+          1024)),
+      event_engine_(event_engine),
+      outgoing_frames_(kMpscSize),
+      encoder_mutex_(&encoder_),
+      memory_owner_(channel_args.GetObject<ResourceQuota>()
+                        ->memory_quota()
+                        ->CreateMemoryOwner()),
+      // BDP probing stays off, as this transport does not send BDP pings. The
+      // stream windows are sized from the settings alone.
+      flow_control_("http2_server", /*enable_bdp_probe=*/false,
+                    &memory_owner_),
+      goaway_in_last_write_(false),
+      data_sent_in_last_write_(false),
+      incoming_header_in_progress_(false),
+      incoming_header_end_stream_(false),
+      incoming_header_stream_id_(0),
+      on_receive_settings_(on_receive_settings),
+      on_close_(on_close),
+      // Same defaults as CHTTP2 servers.
+      keepalive_time_(std::max(
+          Duration::Milliseconds(1),
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
+              .value_or(Duration::Hours(2)))),
+      // Keepalive timeout is only passed to the keepalive manager if it is less
+      // than the ping timeout. As keepalives use pings for health checks, if
+      // keepalive timeout is greater than ping timeout, we would always hit the
+      // ping timeout first.
+      keepalive_timeout_(std::max(
+          Duration::Zero(),
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIMEOUT_MS)
+              .value_or(Duration::Seconds(20)))),
+      ping_timeout_(std::max(
+          Duration::Zero(),
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_PING_TIMEOUT_MS)
+              .value_or(Duration::Minutes(1)))),
+      // Same default as Http2ClientTransport.
+      settings_timeout_(
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_SETTINGS_TIMEOUT)
+              .value_or(std::max(keepalive_timeout_ * 2,
+                                 Duration::Minutes(1)))),
+      ping_manager_(channel_args, PingSystemInterfaceImpl::Make(this),
+                    event_engine, /*is_client=*/false),
+      keepalive_manager_(
+          KeepAliveInterfaceImpl::Make(this),
+          ((keepalive_timeout_ < ping_timeout_) ? keepalive_timeout_
+                                                : Duration::Infinity()),
+          keepalive_time_),
+      keepalive_permit_without_calls_(
+          channel_args.GetBool(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS)
+              .value_or(false)) {
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport Constructor Begin";
 
-  // Initialize the general party and write party.
+  InitLocalSettings(settings_.mutable_local(), /*is_client=*/false);
+  ReadSettingsFromChannelArgs(channel_args, settings_.mutable_local(),
+                              /*is_client=*/false);
+
+  const int max_hpack_table_size =
+      channel_args.GetInt(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER).value_or(-1);
+  if (max_hpack_table_size >= 0) {
+    encoder_.SetMaxUsableSize(max_hpack_table_size);
+  }
+
+  std::optional<Http2SettingsFrame> settings_frame;
+  {
+    MutexLock lock(&transport_mutex_);
+    flow_control_.set_target_initial_window_size(
+        settings_.local().initial_window_size());
+    settings_frame = settings_.MaybeSendUpdate();
+    flow_control_.FlushedSettings();
+  }
+
+  // Initialize the general party.
   auto general_party_arena = SimpleArenaAllocator(0)->MakeArena();
   general_party_arena->SetContext<EventEngine>(event_engine.get());
   general_party_ = Party::Make(std::move(general_party_arena));
 
   general_party_->Spawn("ReadLoop", ReadLoop(), OnReadLoopEnded());
   general_party_->Spawn("WriteLoop", WriteLoop(), OnWriteLoopEnded());
+
+  // The keepalive loop is only spawned if the keepalive time is not infinity.
+  keepalive_manager_.Spawn(general_party_.get());
+
+  // RFC9113 : The server connection preface consists of a potentially empty
+  // SETTINGS frame that MUST be the first frame the server sends in the
+  // HTTP/2 connection.
+  general_party_->Spawn(
+      "SendFirstSettingsFrame",
+      [self = RefAsSubclass<Http2ServerTransport>(),
+       frame = settings_frame.has_value()
+                   ? std::move(*settings_frame)
+                   : Http2SettingsFrame{false, {}}]() mutable {
+        return self->EnqueueOutgoingFrame(std::move(frame));
+      },
+      [](GRPC_UNUSED absl::Status status) {});
+
+  // RFC9113 : If the sender of a SETTINGS frame does not receive an
+  // acknowledgment within a reasonable amount of time, it MAY issue a
+  // connection error of type SETTINGS_TIMEOUT.
+  general_party_->Spawn(
+      "SettingsTimeout",
+      [self = RefAsSubclass<Http2ServerTransport>()]() {
+        return Race(Map(self->settings_acked_.Wait(),
+                        [](Empty) { return absl::OkStatus(); }),
+                    Map(Sleep(self->settings_timeout_), [](absl::Status) {
+                      return absl::DeadlineExceededError(
+                          "SETTINGS ACK not received");
+                    }));
+      },
+      [self = RefAsSubclass<Http2ServerTransport>()](absl::Status status) {
+        if (!status.ok()) {
+          self->MaybeSpawnCloseTransport(
+              Http2Status::Http2ConnectionError(
+                  Http2ErrorCode::kSettingsTimeout,
+                  std::string(status.message())),
+              Http2ErrorCode::kSettingsTimeout);
+        }
+      });
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport Constructor End";
 }
 
+// This function MUST be idempotent.
+void Http2ServerTransport::CloseStream(uint32_t stream_id, absl::Status status,
+                                       CloseStreamArgs args,
+                                       DebugLocation whence) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::CloseStream for stream id: "
+                         << stream_id << " status=" << status
+                         << " location=" << whence.file() << ":"
+                         << whence.line();
+  bool close_transport = false;
+  std::optional<CallInitiator> call_to_cancel;
+  {
+    MutexLock lock(&transport_mutex_);
+    auto pair = stream_list_.find(stream_id);
+    if (pair == stream_list_.end()) {
+      GRPC_HTTP2_SERVER_DLOG
+          << "Http2ServerTransport::CloseStream for stream id: " << stream_id
+          << " stream not found";
+      return;
+    }
+    RefCountedPtr<Stream> stream = pair->second;
+
+    if (args.close_reads) {
+      stream->MarkHalfClosedRemote();
+    }
+    if (args.close_writes) {
+      stream->MarkHalfClosedLocal();
+    }
+    if (!stream->IsClosed()) return;
+
+    GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::CloseStream for stream "
+                              "id: "
+                           << stream_id << " closing stream.";
+    if (args.send_rst_stream) {
+      EnqueueOutgoingFrameImmediately(Http2RstStreamFrame{
+          stream_id,
+          static_cast<uint32_t>(AbslStatusCodeToErrorCode(status.code()))});
+    }
+    if (args.cancel_call) call_to_cancel = std::move(stream->call);
+    stream_list_.erase(pair);
+    // An outbound loop waiting on the window of this stream must learn that
+    // the stream is gone.
+    WakeStalledWriters();
+    close_transport = goaway_sent_ && stream_list_.empty();
+  }
+  // Cancelling may run the call party inline, which may call back into
+  // CloseStream, so the transport lock must not be held.
+  if (call_to_cancel.has_value()) {
+    call_to_cancel->SpawnCancel(status.ok() ? absl::CancelledError()
+                                            : std::move(status));
+  }
+  if (close_transport) {
+    MaybeSpawnCloseTransport(
+        Http2Status::AbslConnectionError(absl::StatusCode::kUnavailable,
+                                         "GOAWAY sent and all streams done"),
+        /*goaway_error_code=*/std::nullopt);
+  }
+}
+
+void Http2ServerTransport::CloseTransport() {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::CloseTransport";
+  ping_manager_.CancelCallbacks();
+  incoming_header_stream_.reset();
+  // The listener holds a ref until one of these two closures runs, so both
+  // must run exactly once even if the client never sent its SETTINGS.
+  if (on_receive_settings_ != nullptr) {
+    ExecCtx::Run(DEBUG_LOCATION, std::exchange(on_receive_settings_, nullptr),
+                 absl::UnavailableError("Transport closed"));
+  }
+  if (on_close_ != nullptr) {
+    ExecCtx::Run(DEBUG_LOCATION, std::exchange(on_close_, nullptr),
+                 absl::OkStatus());
+  }
+  // This is the only place where the general_party_ is
+  // reset.
+  general_party_.reset();
+}
+
+void Http2ServerTransport::SendGracefulGoaway(Http2ErrorCode error_code,
+                                              absl::string_view reason) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::SendGracefulGoaway reason="
+                         << reason;
+  {
+    MutexLock lock(&transport_mutex_);
+    if (is_transport_closed_ || goaway_sent_ || graceful_goaway_started_) {
+      return;
+    }
+    graceful_goaway_started_ = true;
+  }
+  // As in CHTTP2, the first GOAWAY carries the maximum stream id, so that the
+  // streams that the client opens while it is in flight are still served. The
+  // ack of the ping that follows it tells that the client has seen it, and
+  // the final GOAWAY then carries the last stream id that was really seen.
+  general_party_->Spawn(
+      "GracefulGoaway",
+      [self = RefAsSubclass<Http2ServerTransport>(), error_code,
+       reason = std::string(reason)]() mutable {
+        auto ping_acked =
+            self->ping_manager_.RequestPing([]() {}, /*important=*/true);
+        return TrySeq(
+            self->EnqueueOutgoingFrame(Http2GoawayFrame{
+                RFC9113::kMaxStreamId31Bit,
+                static_cast<uint32_t>(Http2ErrorCode::kNoError),
+                Slice::FromCopiedString(reason)}),
+            [ping_acked = std::move(ping_acked)]() mutable {
+              return Race(std::move(ping_acked),
+                          Map(Sleep(kGracefulGoawayPingTimeout),
+                              [](absl::Status) { return absl::OkStatus(); }));
+            },
+            [self, error_code, reason = std::move(reason)]() {
+              self->SendFinalGoaway(error_code, reason);
+              return absl::OkStatus();
+            });
+      },
+      [](GRPC_UNUSED absl::Status status) {});
+}
+
+void Http2ServerTransport::SendFinalGoaway(Http2ErrorCode error_code,
+                                           absl::string_view reason) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::SendFinalGoaway reason="
+                         << reason;
+  bool close_transport = false;
+  {
+    MutexLock lock(&transport_mutex_);
+    if (is_transport_closed_ || goaway_sent_) return;
+    goaway_sent_ = true;
+    EnqueueOutgoingFrameImmediately(Http2GoawayFrame{
+        last_seen_new_stream_id_, static_cast<uint32_t>(error_code),
+        Slice::FromCopiedString(reason)});
+    close_transport = stream_list_.empty();
+  }
+  if (close_transport) {
+    MaybeSpawnCloseTransport(
+        Http2Status::AbslConnectionError(absl::StatusCode::kUnavailable,
+                                         std::string(reason)),
+        /*goaway_error_code=*/std::nullopt);
+  }
+}
+
+void Http2ServerTransport::MaybeSpawnCloseTransport(
+    Http2Status http2_status, std::optional<Http2ErrorCode> goaway_error_code,
+    DebugLocation whence) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::MaybeSpawnCloseTransport "
+                            "status="
+                         << http2_status << " location=" << whence.file() << ":"
+                         << whence.line();
+
+  // Free up the stream_list at this point. This would still allow the frames
+  // in the MPSC to be drained and block any additional frames from being
+  // enqueued. Additionally this also prevents additional frames with non-zero
+  // stream_ids from being processed by the read loop.
+  ReleasableMutexLock lock(&transport_mutex_);
+  if (is_transport_closed_) {
+    lock.Release();
+    return;
+  }
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::MaybeSpawnCloseTransport "
+                            "Initiating transport close";
+  is_transport_closed_ = true;
+  absl::flat_hash_map<uint32_t, RefCountedPtr<Stream>> stream_list =
+      std::move(stream_list_);
+  stream_list_.clear();
+  state_tracker_.SetState(GRPC_CHANNEL_SHUTDOWN,
+                          http2_status.GetAbslConnectionError(),
+                          "transport closed");
+  // A graceful GOAWAY has already told the client everything it needs to
+  // know.
+  const bool send_goaway = goaway_error_code.has_value() && !goaway_sent_;
+  goaway_sent_ = true;
+  const uint32_t last_stream_id = last_seen_new_stream_id_;
+  // Outbound loops waiting for flow control window must see that their
+  // streams are gone.
+  WakeStalledWriters();
+  lock.Release();
+
+  Http2Frame goaway_frame = Http2EmptyFrame{};
+  if (send_goaway) {
+    goaway_frame = Http2GoawayFrame{
+        last_stream_id, static_cast<uint32_t>(*goaway_error_code),
+        Slice::FromCopiedString(
+            http2_status.GetAbslConnectionError().message())};
+  }
+
+  general_party_->Spawn(
+      "CloseTransport",
+      [self = RefAsSubclass<Http2ServerTransport>(),
+       stream_list = std::move(stream_list),
+       http2_status = std::move(http2_status), send_goaway,
+       goaway_frame = std::move(goaway_frame)]() mutable {
+        GRPC_HTTP2_SERVER_DLOG
+            << "Http2ServerTransport::CloseTransport Cleaning up call stacks";
+        // Cancel the calls of all active streams.
+        for (const auto& pair : stream_list) {
+          auto& stream = pair.second;
+          if (stream->call.has_value()) {
+            stream->call->SpawnCancel(http2_status.GetAbslConnectionError());
+          }
+        }
+        // RFC9113 : An endpoint that encounters a connection error SHOULD
+        // first send a GOAWAY frame with the stream identifier of the last
+        // stream that it successfully received from its peer.
+        // The GOAWAY is given a bounded time to be written, so that a peer
+        // that stopped reading cannot hold the transport open.
+        return Map(
+            If(
+                send_goaway,
+                [self, goaway_frame = std::move(goaway_frame)]() mutable {
+                  return Race(
+                      TrySeq(
+                          self->EnqueueOutgoingFrame(std::move(goaway_frame)),
+                          [self]() {
+                            return Map(self->goaway_written_.Wait(), [](Empty) {
+                              return absl::OkStatus();
+                            });
+                          }),
+                      Map(Sleep(kGoawayWriteTimeout), [](absl::Status) {
+                        return absl::DeadlineExceededError(
+                            "Timed out writing GOAWAY");
+                      }));
+                },
+                []() { return absl::OkStatus(); }),
+            [self](GRPC_UNUSED absl::Status status) mutable {
+              self->CloseTransport();
+              return Empty{};
+            });
+      },
+      [](Empty) {});
+}
+
 Http2ServerTransport::~Http2ServerTransport() {
-  // TODO(tjagtap) : [PH2][P2] : Implement the needed cleanup
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport Destructor Begin";
-  general_party_.reset();
+  MutexLock lock(&transport_mutex_);
+  DCHECK(stream_list_.empty());
   GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport Destructor End";
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Stream Related Operations
+
+RefCountedPtr<Http2ServerTransport::Stream> Http2ServerTransport::LookupStream(
+    uint32_t stream_id) {
+  MutexLock lock(&transport_mutex_);
+  auto it = stream_list_.find(stream_id);
+  if (it == stream_list_.end()) {
+    GRPC_HTTP2_SERVER_DLOG
+        << "Http2ServerTransport::LookupStream Stream not found stream_id="
+        << stream_id;
+    return nullptr;
+  }
+  return it->second;
+}
+
+Poll<absl::StatusOr<uint32_t>> Http2ServerTransport::PollSendWindow(
+    const uint32_t stream_id, const size_t max_bytes) {
+  MutexLock lock(&transport_mutex_);
+  auto it = stream_list_.find(stream_id);
+  if (it == stream_list_.end()) {
+    return absl::CancelledError("Stream closed while sending a message");
+  }
+  chttp2::StreamFlowControl& stream_flow_control = it->second->flow_control;
+  // RFC9113 : The sender MUST NOT send a flow-controlled frame with a length
+  // that exceeds the space available in either of the flow-control windows
+  // advertised by the receiver.
+  const int64_t window = std::min(
+      {static_cast<int64_t>(settings_.peer().initial_window_size()) +
+           stream_flow_control.remote_window_delta(),
+       flow_control_.remote_window(),
+       static_cast<int64_t>(settings_.peer().max_frame_size()),
+       static_cast<int64_t>(max_bytes)});
+  if (window <= 0) {
+    GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport::PollSendWindow stream_id="
+                           << stream_id << " stalled on flow control";
+    return stalled_writers_.AddPending(
+        GetContext<Activity>()->MakeNonOwningWaker());
+  }
+  chttp2::StreamFlowControl::OutgoingUpdateContext update(
+      &stream_flow_control);
+  update.SentData(window);
+  return static_cast<uint32_t>(window);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Call Spine related operations
+
+auto Http2ServerTransport::SendHeaders(const uint32_t stream_id,
+                                       ServerMetadataHandle metadata,
+                                       const bool end_stream) {
+  return TrySeq(
+      encoder_mutex_.Acquire(),
+      [self = RefAsSubclass<Http2ServerTransport>(), stream_id, end_stream,
+       metadata = std::move(metadata)](
+          InterActivityMutex<HPackCompressor*>::Lock lock) mutable {
+        std::optional<uint32_t> table_size;
+        {
+          MutexLock transport_lock(&self->transport_mutex_);
+          table_size = std::exchange(self->pending_encoder_table_size_,
+                                     std::nullopt);
+        }
+        HPackCompressor* encoder = *lock;
+        if (table_size.has_value()) encoder->SetMaxTableSize(*table_size);
+        SliceBuffer buf;
+        encoder->EncodeRawHeaders(*metadata, buf);
+        Http2Frame frame = Http2HeaderFrame{stream_id, /*end_headers*/ true,
+                                            end_stream, std::move(buf)};
+        // The lock is held until the frame is enqueued.
+        return Map(self->EnqueueOutgoingFrame(std::move(frame)),
+                   [lock = std::move(lock)](absl::Status status) {
+                     return status;
+                   });
+      });
+}
+
+auto Http2ServerTransport::SendMessage(const uint32_t stream_id,
+                                       MessageHandle message) {
+  GrpcMessageDisassembler disassembler;
+  disassembler.PrepareSingleMessageForSending(std::move(message));
+  return Loop([self = RefAsSubclass<Http2ServerTransport>(), stream_id,
+               disassembler = std::move(disassembler)]() mutable {
+    return TrySeq(
+        self->WaitForSendWindow(stream_id, disassembler.GetBufferedLength()),
+        [self, stream_id, &disassembler](uint32_t window) {
+          // The window never exceeds the buffered length, so every byte of it
+          // is sent.
+          return self->EnqueueOutgoingFrame(
+              disassembler.GenerateNextFrame(stream_id, window));
+        },
+        [&disassembler]() -> LoopCtl<absl::Status> {
+          if (disassembler.GetBufferedLength() == 0) return absl::OkStatus();
+          return Continue();
+        });
+  });
+}
+
+auto Http2ServerTransport::CallOutboundLoop(CallInitiator call_initiator,
+                                            const uint32_t stream_id) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport CallOutboundLoop";
+  return GRPC_LATENT_SEE_PROMISE(
+      "Ph2ServerCallOutboundLoop",
+      TrySeq(
+          call_initiator.PullServerInitialMetadata(),
+          [self = RefAsSubclass<Http2ServerTransport>(), stream_id,
+           call_initiator](
+              std::optional<ServerMetadataHandle> metadata) mutable {
+            const bool has_initial_metadata = metadata.has_value();
+            return Staple(
+                If(
+                    has_initial_metadata,
+                    [self, stream_id, call_initiator,
+                     metadata = std::move(metadata)]() mutable {
+                      return TrySeq(
+                          self->SendHeaders(stream_id, std::move(*metadata),
+                                            /*end_stream=*/false),
+                          ForEach(MessagesFrom(call_initiator),
+                                  [self, stream_id](MessageHandle message) {
+                                    return self->SendMessage(
+                                        stream_id, std::move(message));
+                                  }));
+                    },
+                    []() { return absl::OkStatus(); }),
+                has_initial_metadata);
+          },
+          [call_initiator](auto args) mutable {
+            return Staple(call_initiator.PullServerTrailingMetadata(),
+                          std::get<1>(args));
+          },
+          [self = RefAsSubclass<Http2ServerTransport>(),
+           stream_id](auto args) mutable {
+            ServerMetadataHandle trailers = std::move(std::get<0>(args));
+            const bool sent_initial_metadata = std::get<1>(args);
+            if (!sent_initial_metadata) {
+              // A trailers-only response is a single HEADERS frame, which
+              // must carry the response headers too.
+              trailers->Set(HttpStatusMetadata(), 200);
+              trailers->Set(ContentTypeMetadata(),
+                            ContentTypeMetadata::kApplicationGrpc);
+            }
+            return self->SendHeaders(stream_id, std::move(trailers),
+                                     /*end_stream=*/true);
+          },
+          [self = RefAsSubclass<Http2ServerTransport>(), stream_id]() {
+            // RFC9113 : A server can send a complete response prior to the
+            // client sending an entire request if the response does not depend
+            // on any portion of the request that has not been sent and
+            // received. When this is true, a server MAY request that the
+            // client abort transmission of a request without error by sending
+            // a RST_STREAM with an error code of NO_ERROR.
+            RefCountedPtr<Stream> stream = self->LookupStream(stream_id);
+            const bool reads_open =
+                stream != nullptr &&
+                stream->GetStreamState() != HttpStreamState::kHalfClosedRemote;
+            self->CloseStream(stream_id, absl::OkStatus(),
+                              CloseStreamArgs{
+                                  /*close_reads=*/true,
+                                  /*close_writes=*/true,
+                                  /*send_rst_stream=*/reads_open,
+                                  /*cancel_call=*/false,
+                              });
+            return absl::OkStatus();
+          }));
+}
+
+Http2Status Http2ServerTransport::StartCall(const uint32_t stream_id,
+                                            ClientMetadataHandle metadata) {
+  GRPC_HTTP2_SERVER_DLOG << "Http2ServerTransport StartCall stream_id="
+                         << stream_id;
+  RefCountedPtr<Stream> stream;
+  absl::string_view refusal;
+  {
+    MutexLock lock(&transport_mutex_);
+    auto it = stream_list_.find(stream_id);
+    if (it == stream_list_.end()) return Http2Status::Ok();
+    stream = it->second;
+    if (goaway_sent_) {
+      refusal = "GOAWAY sent";
+    } else if (stream_list_.size() >
+               settings_.acked().max_concurrent_streams()) {
+      // RFC9113 : An endpoint that receives a HEADERS frame that causes its
+      // advertised concurrent stream limit to be exceeded MUST treat this as a
+      // stream error (Section 5.4.2) of type PROTOCOL_ERROR or REFUSED_STREAM.
+      refusal = "Too many concurrent streams";
+    }
+  }
+  if (!refusal.empty()) {
+    // The RST_STREAM carries REFUSED_STREAM, which tells the client that the
+    // request was not processed and may be retried.
+    CloseStream(stream_id, absl::UnavailableError(refusal),
+                CloseStreamArgs{
+                    /*close_reads=*/true,
+                    /*close_writes=*/true,
+                    /*send_rst_stream=*/true,
+                    /*cancel_call=*/false,
+                });
+    return Http2Status::Ok();
+  }
+
+  RefCountedPtr<Arena> arena(call_arena_allocator_->MakeArena());
+  arena->SetContext<EventEngine>(event_engine_.get());
+  CallInitiatorAndHandler call =
+      MakeCallPair(std::move(metadata), std::move(arena));
+  {
+    MutexLock lock(&transport_mutex_);
+    stream->call = call.initiator;
+  }
+  const bool on_done_added = call.initiator.OnDone(
+      [self = RefAsSubclass<Http2ServerTransport>(),
+       stream_id](bool cancelled) {
+        GRPC_HTTP2_SERVER_DLOG << "PH2: Server call " << self.get()
+                               << " id=" << stream_id
+                               << " done: cancelled=" << cancelled;
+        if (cancelled) {
+          self->CloseStream(stream_id, absl::CancelledError(),
+                            CloseStreamArgs{
+                                /*close_reads=*/true,
+                                /*close_writes=*/true,
+                                /*send_rst_stream=*/true,
+                                /*cancel_call=*/false,
+                            });
+        }
+      });
+  if (!on_done_added) {
+    return Http2Status::Http2StreamError(Http2ErrorCode::kInternalError,
+                                         "Failed to start call");
+  }
+  call.initiator.SpawnGuarded(
+      "http2-server-call",
+      [self = RefAsSubclass<Http2ServerTransport>(), stream_id,
+       call_initiator = call.initiator,
+       call_handler = std::move(call.handler)]() mutable {
+        return TrySeq(
+            // Streams may arrive before the server has set the call
+            // destination.
+            self->got_call_destination_.Wait(),
+            [self, stream_id, call_initiator = std::move(call_initiator),
+             call_handler = std::move(call_handler)](Empty) mutable {
+              self->call_destination_->StartCall(std::move(call_handler));
+              return self->CallOutboundLoop(std::move(call_initiator),
+                                            stream_id);
+            });
+      });
+  return Http2Status::Ok();
+}
+
 }  // namespace http2
 }  // namespace grpc_core
@@ -20,20 +20,37 @@
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_HTTP2_SERVER_TRANSPORT_H
 
 #include <cstdint>
-#include <type_traits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "src/core/call/call_arena_allocator.h"
 #include "src/core/call/call_destination.h"
 #include "src/core/call/call_spine.h"
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/header_assembler.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings_manager.h"
+#include "src/core/ext/transport/chttp2/transport/http2_status.h"
+#include "src/core/ext/transport/chttp2/transport/http2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/keepalive.h"
+#include "src/core/ext/transport/chttp2/transport/message_assembler.h"
+#include "src/core/ext/transport/chttp2/transport/ping_promise.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
+#include "src/core/lib/promise/inter_activity_mutex.h"
 #include "src/core/lib/promise/mpsc.h"
 #include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/wait_set.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
@@ -41,6 +58,23 @@
 namespace grpc_core {
 namespace http2 {
 
+// Http2 Server Transport Spawns Overview
+
+// | Promise Spawn       | Max Duration | Promise Resolution    | Max Spawns |
+// |                     | for Spawn    |                       |            |
+// |---------------------|--------------|-----------------------|------------|
+// | Endpoint Read Loop  | Infinite     | On transport close    | One        |
+// | Endpoint Write Loop | Infinite     | On transport close    | One        |
+// | Keepalive Loop      | Infinite     | On transport close    | One        |
+// | Close Transport     | GoawayTimeout| On transport close    | One        |
+// | Settings Timeout    | Settings     | On SETTINGS ACK or    | One        |
+// |                     | Timeout      | timeout               |            |
+// | Graceful GOAWAY     | Ping Timeout | On final GOAWAY       | One        |
+
+// Each accepted stream additionally spawns one outbound loop on its own call
+// party. That loop sends the response HEADERS, DATA and trailers of the
+// stream.
+
 // Experimental : This is just the initial skeleton of class
 // and it is functions. The code will be written iteratively.
 // Do not use or edit any of these functions unless you are
@@ -52,10 +86,20 @@ class Http2ServerTransport final : public ServerTransport {
   // inlining. For now definitions are in the cc file to
   // reduce cognitive load in the header.
  public:
+  // on_receive_settings is run when the first SETTINGS frame is received from
+  // the client, and on_close is run once the transport has closed. Either may
+  // be null.
   Http2ServerTransport(
-      PromiseEndpoint endpoint, GRPC_UNUSED const ChannelArgs& channel_args,
+      PromiseEndpoint endpoint, const ChannelArgs& channel_args,
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-          event_engine);
+          event_engine,
+      grpc_closure* on_receive_settings = nullptr,
+      grpc_closure* on_close = nullptr);
+
+  Http2ServerTransport(const Http2ServerTransport&) = delete;
+  Http2ServerTransport& operator=(const Http2ServerTransport&) = delete;
+  Http2ServerTransport(Http2ServerTransport&&) = delete;
+  Http2ServerTransport& operator=(Http2ServerTransport&&) = delete;
   ~Http2ServerTransport() override;
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
@@ -72,6 +116,10 @@ class Http2ServerTransport final : public ServerTransport {
       RefCountedPtr<UnstartedCallDestination> call_destination) override;
 
   void PerformOp(grpc_transport_op*) override;
+  void StartConnectivityWatch(
+      grpc_connectivity_state state,
+      OrphanablePtr<ConnectivityStateWatcherInterface> watcher);
+  void StopConnectivityWatch(ConnectivityStateWatcherInterface* watcher);
 
   void Orphan() override;
   void AbortWithError();
@@ -81,8 +129,26 @@ class Http2ServerTransport final : public ServerTransport {
   }
 
  private:
+  struct Stream;
+
+  // Promise factory for processing each type of frame
+  Http2Status ProcessHttp2DataFrame(Http2DataFrame frame);
+  Http2Status ProcessHttp2HeaderFrame(Http2HeaderFrame frame);
+  Http2Status ProcessHttp2RstStreamFrame(Http2RstStreamFrame frame);
+  auto ProcessHttp2SettingsFrame(Http2SettingsFrame frame);
+  auto ProcessHttp2PingFrame(Http2PingFrame frame);
+  Http2Status ProcessHttp2GoawayFrame(Http2GoawayFrame frame);
+  Http2Status ProcessHttp2WindowUpdateFrame(Http2WindowUpdateFrame frame);
+  Http2Status ProcessHttp2ContinuationFrame(Http2ContinuationFrame frame);
+  Http2Status ProcessHttp2SecurityFrame(Http2SecurityFrame frame);
+  Http2Status ProcessMetadata(RefCountedPtr<Stream> stream);
+
   // Reading from the endpoint.
 
+  // Returns a promise that reads and validates the connection preface that
+  // every client sends before its first frame.
+  auto ReadConnectionPreface();
+
   // Returns a promise to keep reading in a Loop till a fail/close is received.
   auto ReadLoop();
 
@@ -103,88 +169,457 @@ class Http2ServerTransport final : public ServerTransport {
   // Returns a promise to keep writing in a Loop till a fail/close is received.
   auto WriteLoop();
 
+  // Appends the WINDOW_UPDATE frames to send with a batch of frames.
+  void AppendWindowUpdates(std::vector<Http2Frame>& frames);
+
   // Returns a promise that will do the cleanup after the WriteLoop ends.
   auto OnWriteLoopEnded();
 
+  // Returns a promise to enqueue a frame to MPSC
+  auto EnqueueOutgoingFrame(Http2Frame frame) {
+    return AssertResultType<absl::Status>(Map(
+        outgoing_frames_.MakeSender().Send(std::move(frame), 1),
+        [self = RefAsSubclass<Http2ServerTransport>()](StatusFlag status) {
+          GRPC_HTTP2_SERVER_DLOG
+              << "Http2ServerTransport::EnqueueOutgoingFrame status=" << status;
+          return (status.ok())
+                     ? absl::OkStatus()
+                     : self->HandleError(Http2Status::AbslConnectionError(
+                           absl::StatusCode::kInternal,
+                           "Failed to enqueue frame"));
+        }));
+  }
+
+  // Enqueues a frame from code that cannot wait, such as the OnDone callback
+  // of a call. Only used for small control frames.
+  void EnqueueOutgoingFrameImmediately(Http2Frame frame) {
+    StatusFlag status =
+        outgoing_frames_.MakeSender().UnbufferedImmediateSend(std::move(frame),
+                                                              1);
+    GRPC_HTTP2_SERVER_DLOG
+        << "Http2ServerTransport::EnqueueOutgoingFrameImmediately status="
+        << status;
+  }
+
+  // Force triggers a transport write cycle
+  auto TriggerWriteCycle() { return EnqueueOutgoingFrame(Http2EmptyFrame{}); }
+
+  // Call Spine related operations
+
+  // Creates the call for a stream once its initial metadata has been read,
+  // and spawns the loop that sends the response.
+  Http2Status StartCall(uint32_t stream_id, ClientMetadataHandle metadata);
+
+  // Returns a promise to fetch the response from the call initiator and pass
+  // it further down towards the endpoint.
+  auto CallOutboundLoop(CallInitiator call_initiator, uint32_t stream_id);
+
+  // Returns a promise that encodes metadata and enqueues it as a HEADERS frame.
+  // Encoding and enqueueing happen under one lock so that the frames reach the
+  // peer in the order in which their header blocks were compressed.
+  auto SendHeaders(uint32_t stream_id, ServerMetadataHandle metadata,
+                   bool end_stream);
+
+  // Returns a promise that sends one message as DATA frames, respecting the
+  // flow control windows of the stream and the transport.
+  auto SendMessage(uint32_t stream_id, MessageHandle message);
+
+  // Returns a promise that resolves with the number of DATA bytes, at most
+  // max_bytes, that the stream may send now. The window is reserved before the
+  // promise resolves.
+  auto WaitForSendWindow(uint32_t stream_id, size_t max_bytes) {
+    return [self = RefAsSubclass<Http2ServerTransport>(), stream_id,
+            max_bytes]() { return self->PollSendWindow(stream_id, max_bytes); };
+  }
+  Poll<absl::StatusOr<uint32_t>> PollSendWindow(uint32_t stream_id,
+                                                size_t max_bytes);
+
   RefCountedPtr<Party> general_party_;
 
   PromiseEndpoint endpoint_;
+  // Only modified on the transport party, with transport_mutex_ held, since
+  // the outbound loops of calls read the peer settings.
   Http2SettingsManager settings_;
 
   Http2FrameHeader current_frame_header_;
 
+  // Managing the streams
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallInitiator call) : call(std::move(call)) {}
-    // Transport holds one CallHandler object for each Stream.
-    CallInitiator call;
-    // TODO(tjagtap) : [PH2][P2] : Add more members as necessary
-    // TODO(tjagtap) : [PH2][P2] : May be add state of Stream - Idle , Open etc
-    // https://datatracker.ietf.org/doc/html/rfc9113#name-stream-identifiers
+    Stream(const uint32_t stream_id1,
+           chttp2::TransportFlowControl* transport_flow_control)
+        : stream_state(HttpStreamState::kOpen),
+          stream_id(stream_id1),
+          header_assembler(stream_id1),
+          flow_control(transport_flow_control),
+          did_receive_initial_metadata(false),
+          did_receive_trailing_metadata(false) {}
+
+    // Modify the stream state
+    // A server stream is opened by the HEADERS frame of the client, so it
+    // never passes through kIdle. The possible stream transitions are:
+    // kOpen -> kClosed/kHalfClosedLocal/kHalfClosedRemote
+    // kHalfClosedLocal/kHalfClosedRemote -> kClosed
+    // kClosed -> kClosed
+    void MarkHalfClosedLocal() {
+      switch (stream_state) {
+        case HttpStreamState::kOpen:
+          stream_state = HttpStreamState::kHalfClosedLocal;
+          break;
+        case HttpStreamState::kHalfClosedRemote:
+          stream_state = HttpStreamState::kClosed;
+          break;
+        case HttpStreamState::kIdle:
+        case HttpStreamState::kHalfClosedLocal:
+        case HttpStreamState::kClosed:
+          break;
+      }
+    }
+
+    void MarkHalfClosedRemote() {
+      switch (stream_state) {
+        case HttpStreamState::kOpen:
+          stream_state = HttpStreamState::kHalfClosedRemote;
+          break;
+        case HttpStreamState::kHalfClosedLocal:
+          stream_state = HttpStreamState::kClosed;
+          break;
+        case HttpStreamState::kIdle:
+        case HttpStreamState::kHalfClosedRemote:
+        case HttpStreamState::kClosed:
+          break;
+      }
+    }
+
+    HttpStreamState GetStreamState() const { return stream_state; }
+
+    inline bool IsClosed() const {
+      return stream_state == HttpStreamState::kClosed;
+    }
+
+    // Empty until the initial metadata of the client has been read.
+    std::optional<CallInitiator> call;
+    HttpStreamState stream_state;
+    const uint32_t stream_id;
+    GrpcMessageAssembler assembler;
+    HeaderAssembler header_assembler;
+    // Guarded by transport_mutex_. The stream window is read by the outbound
+    // loop of the call and updated by the read loop of the transport.
+    chttp2::StreamFlowControl flow_control;
+    bool did_receive_initial_metadata;
+    bool did_receive_trailing_metadata;
   };
+
   RefCountedPtr<UnstartedCallDestination> call_destination_;
+  // Set once the call destination is known. Calls started before that wait
+  // for it.
+  InterActivityLatch<void> got_call_destination_;
+  RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
 
   MpscReceiver<Http2Frame> outgoing_frames_;
 
   Mutex transport_mutex_;
-  // TODO(tjagtap) : [PH2][P2] : Add to map in SetCallDestination and clean this
-  // mapping up in the on_done of the CallInitiator or CallHandler
   absl::flat_hash_map<uint32_t, RefCountedPtr<Stream>> stream_list_
       ABSL_GUARDED_BY(transport_mutex_);
+  // RFC9113 : The identifier of a newly established stream MUST be numerically
+  // greater than all streams that the initiating endpoint has opened.
+  uint32_t last_seen_new_stream_id_ ABSL_GUARDED_BY(transport_mutex_) = 0;
+  bool is_transport_closed_ ABSL_GUARDED_BY(transport_mutex_) = false;
+  // Once a GOAWAY has been sent, new streams are refused and the transport
+  // closes when the last stream closes.
+  bool goaway_sent_ ABSL_GUARDED_BY(transport_mutex_) = false;
+  // Set once the first GOAWAY of a graceful shutdown is on its way. New
+  // streams are still accepted until the final GOAWAY is sent.
+  bool graceful_goaway_started_ ABSL_GUARDED_BY(transport_mutex_) = false;
+
+  ConnectivityStateTracker state_tracker_ ABSL_GUARDED_BY(transport_mutex_){
+      "http2_server", GRPC_CHANNEL_READY};
+
+  // Serialises the compression of header blocks across calls. See
+  // SendHeaders.
+  HPackCompressor encoder_;
+  InterActivityMutex<HPackCompressor*> encoder_mutex_;
+  // A HEADER_TABLE_SIZE received from the peer, to be applied by the next
+  // header block that is compressed.
+  std::optional<uint32_t> pending_encoder_table_size_
+      ABSL_GUARDED_BY(transport_mutex_);
+  HPackParser parser_;
+  // Decodes the header blocks of streams that are already closed, which keeps
+  // the HPACK state in sync with the peer. The result is dropped. Only
+  // accessed on the transport party.
+  std::unique_ptr<HeaderAssembler> discarded_headers_;
+  Http2Status StartDiscardingHeaders(Http2HeaderFrame frame);
+  Http2Status DiscardHeaders(uint32_t stream_id);
+
+  // Flow control. The outbound loops of calls that have used up their send
+  // window wait here for a WINDOW_UPDATE or a SETTINGS frame from the peer.
+  MemoryOwner memory_owner_;
+  chttp2::TransportFlowControl flow_control_ ABSL_GUARDED_BY(transport_mutex_);
+  WaitSet stalled_writers_ ABSL_GUARDED_BY(transport_mutex_);
+  // WINDOW_UPDATE frames produced by the read loop, which are written with the
+  // next batch of frames. Only accessed on the transport party.
+  std::vector<Http2Frame> pending_window_updates_;
+
+  void WakeStalledWriters() ABSL_EXCLUSIVE_LOCKS_REQUIRED(transport_mutex_) {
+    stalled_writers_.WakeupAsync();
+  }
+
+  // Closing the transport. Set once the GOAWAY sent while closing the
+  // transport has been written to the endpoint.
+  InterActivityLatch<void> goaway_written_;
+  bool goaway_in_last_write_;
+
+  struct CloseStreamArgs {
+    bool close_reads;
+    bool close_writes;
+    bool send_rst_stream;
+    bool cancel_call;
+  };
 
   // This function MUST be idempotent.
+  // If a RST_STREAM frame is sent, its error code is derived from status.
   void CloseStream(uint32_t stream_id, absl::Status status,
-                   DebugLocation whence = {}) {
-    LOG(INFO) << "Http2ServerTransport::CloseStream for stream id=" << stream_id
-              << " status=" << status << " location=" << whence.file() << ":"
-              << whence.line();
-    // TODO(akshitpatel) : [PH2][P2] : Implement this.
+                   CloseStreamArgs args, DebugLocation whence = {});
+
+  RefCountedPtr<Http2ServerTransport::Stream> LookupStream(uint32_t stream_id);
+
+  auto EndpointReadSlice(const size_t num_bytes) {
+    return Map(endpoint_.ReadSlice(num_bytes),
+               [self = RefAsSubclass<Http2ServerTransport>()](
+                   absl::StatusOr<Slice> status) {
+                 // See Http2ClientTransport::EndpointReadSlice for why
+                 // failed reads also count.
+                 self->keepalive_manager_.GotData();
+                 return status;
+               });
   }
 
-  // This function is supposed to be idempotent.
-  void CloseTransport(const Http2Status& status, DebugLocation whence = {}) {
-    LOG(INFO) << "Http2ClientTransport::CloseTransport status=" << status
-              << " location=" << whence.file() << ":" << whence.line();
-    // TODO(akshitpatel) : [PH2][P2] : Implement this.
+  auto EndpointRead(const size_t num_bytes) {
+    return Map(endpoint_.Read(num_bytes),
+               [self = RefAsSubclass<Http2ServerTransport>()](
+                   absl::StatusOr<SliceBuffer> status) {
+                 self->keepalive_manager_.GotData();
+                 return status;
+               });
   }
 
+  // This function MUST run on the transport party.
+  void CloseTransport();
+
+  // Starts closing the transport. If goaway_error_code is set, a GOAWAY frame
+  // with that error code is written before the endpoint is closed. It is not
+  // set when the endpoint itself has failed.
+  void MaybeSpawnCloseTransport(
+      Http2Status http2_status,
+      std::optional<Http2ErrorCode> goaway_error_code,
+      DebugLocation whence = {});
+
+  // Sends a GOAWAY frame and stops accepting new streams. Streams that are
+  // already open run to completion, after which the transport closes.
+  void SendGracefulGoaway(Http2ErrorCode error_code, absl::string_view reason);
+  // The second phase of SendGracefulGoaway.
+  void SendFinalGoaway(Http2ErrorCode error_code, absl::string_view reason);
+
   // Handles the error status and returns the corresponding absl status. Absl
   // Status is returned so that the error can be gracefully handled
   // by promise primitives.
   // If the error is a stream error, it closes the stream and returns an ok
   // status. Ok status is returned because the calling transport promise loops
   // should not be cancelled in case of stream errors.
-  // If the error is a connection error, it closes the transport and returns the
-  // corresponding (failed) absl status.
+  // If the error is a connection error, it closes the transport, sending a
+  // GOAWAY frame with the error code, and returns the corresponding (failed)
+  // absl status.
   absl::Status HandleError(Http2Status status, DebugLocation whence = {}) {
     auto error_type = status.GetType();
     DCHECK(error_type != Http2Status::Http2ErrorType::kOk);
 
     if (error_type == Http2Status::Http2ErrorType::kStreamError) {
+      LOG(ERROR) << "Stream Error: " << status.DebugString();
       CloseStream(current_frame_header_.stream_id, status.GetAbslStreamError(),
+                  CloseStreamArgs{
+                      /*close_reads=*/true,
+                      /*close_writes=*/true,
+                      /*send_rst_stream=*/true,
+                      /*cancel_call=*/true,
+                  },
                   whence);
       return absl::OkStatus();
     } else if (error_type == Http2Status::Http2ErrorType::kConnectionError) {
-      CloseTransport(status, whence);
-      return status.GetAbslConnectionError();
+      LOG(ERROR) << "Connection Error: " << status.DebugString();
+      absl::Status absl_status = status.GetAbslConnectionError();
+      const Http2ErrorCode goaway_error_code = status.GetConnectionErrorCode();
+      MaybeSpawnCloseTransport(std::move(status), goaway_error_code, whence);
+      return absl_status;
     }
-
     GPR_UNREACHABLE_CODE(return absl::InternalError("Invalid error type"));
   }
 
-  // TODO(tjagtap) : [PH2][P2] : Either use this in code or delete it.
-  // uint32_t next_stream_id_ ABSL_GUARDED_BY(transport_mutex_) = 1;
-  // TODO(tjagtap) : [PH2][P2] : Either use this in code or delete it. This was
-  // copied from Chaotic Good.
-  // uint32_t last_seen_new_stream_id_ = 0;
-
-  // TODO(tjagtap) : [PH2][P2] : Implement if needed.
-  // uint32_t MakeStream(CallHandler call_handler);
-  // TODO(tjagtap) : [PH2][P2] : Implement if needed.
-  // RefCountedPtr<Http2ServerTransport::Stream> LookupStream(uint32_t
-  // stream_id);
+  // Set if the last write had a DATA, HEADERS or WINDOW_UPDATE frame.
+  bool data_sent_in_last_write_;
+  bool incoming_header_in_progress_;
+  bool incoming_header_end_stream_;
+  uint32_t incoming_header_stream_id_;
+  // The stream whose header block is continued by the next CONTINUATION
+  // frame. Only accessed on the transport party.
+  RefCountedPtr<Stream> incoming_header_stream_;
+  // Set when the client acks the SETTINGS frame of the server.
+  InterActivityLatch<void> settings_acked_;
+  grpc_closure* on_receive_settings_;
+  grpc_closure* on_close_;
+
+  // Ping related members
+  // Duration between two consecutive keepalive pings
+  const Duration keepalive_time_;
+  // Duration to wait for a keepalive ping ack before triggering timeout. This
+  // only takes effect if the assigned value is less than the ping timeout.
+  const Duration keepalive_timeout_;
+  // Duration to wait for ping ack before triggering timeout
+  const Duration ping_timeout_;
+  // Duration to wait for the SETTINGS ACK before closing the transport
+  const Duration settings_timeout_;
+  PingManager ping_manager_;
+  std::vector<uint64_t> pending_ping_acks_;
+  KeepaliveManager keepalive_manager_;
+
+  // Flags
+  const bool keepalive_permit_without_calls_;
+
+  auto WaitForPingAck() { return ping_manager_.WaitForPingAck(); }
+
+  // Ping Helper functions
+  // Returns a promise that resolves once a ping frame is written to the
+  // endpoint.
+  auto CreateAndWritePing(bool ack, uint64_t opaque_data) {
+    Http2Frame frame = Http2PingFrame{ack, opaque_data};
+    SliceBuffer output_buf;
+    Serialize(absl::Span<Http2Frame>(&frame, 1), output_buf);
+    return endpoint_.Write(std::move(output_buf), {});
+  }
+
+  Duration NextAllowedPingInterval() {
+    MutexLock lock(&transport_mutex_);
+    return (!keepalive_permit_without_calls_ && stream_list_.empty())
+               ? Duration::Hours(2)
+               : Duration::Seconds(1);
+  }
+
+  auto MaybeSendPing() {
+    return ping_manager_.MaybeSendPing(NextAllowedPingInterval(),
+                                       ping_timeout_);
+  }
+
+  auto MaybeSendPingAcks() {
+    return AssertResultType<absl::Status>(If(
+        pending_ping_acks_.empty(), [] { return absl::OkStatus(); },
+        [this] {
+          std::vector<Http2Frame> frames;
+          frames.reserve(pending_ping_acks_.size());
+          for (auto& opaque_data : pending_ping_acks_) {
+            frames.emplace_back(Http2PingFrame{true, opaque_data});
+          }
+          pending_ping_acks_.clear();
+          SliceBuffer output_buf;
+          Serialize(absl::Span<Http2Frame>(frames), output_buf);
+          return endpoint_.Write(std::move(output_buf), {});
+        }));
+  }
+
+  auto AckPing(uint64_t opaque_data) {
+    bool valid_ping_ack_received = true;
+
+    if (!ping_manager_.AckPing(opaque_data)) {
+      GRPC_HTTP2_SERVER_DLOG << "Unknown ping response received for ping id="
+                             << opaque_data;
+      valid_ping_ack_received = false;
+    }
+
+    return If(
+        // See Http2ClientTransport::AckPing.
+        valid_ping_ack_received && ping_manager_.ImportantPingRequested(),
+        [self = RefAsSubclass<Http2ServerTransport>()] {
+          return Map(self->TriggerWriteCycle(), [](const absl::Status status) {
+            return (status.ok())
+                       ? Http2Status::Ok()
+                       : Http2Status::AbslConnectionError(
+                             status.code(), std::string(status.message()));
+          });
+        },
+        [] { return Immediate(Http2Status::Ok()); });
+  }
+
+  class PingSystemInterfaceImpl : public PingInterface {
+   public:
+    static std::unique_ptr<PingInterface> Make(
+        Http2ServerTransport* transport) {
+      return std::make_unique<PingSystemInterfaceImpl>(
+          PingSystemInterfaceImpl(transport));
+    }
+
+    // Returns a promise that resolves once a ping frame is written to the
+    // endpoint.
+    Promise<absl::Status> SendPing(SendPingArgs args) override {
+      return transport_->CreateAndWritePing(args.ack, args.opaque_data);
+    }
+
+    Promise<absl::Status> TriggerWrite() override {
+      return transport_->TriggerWriteCycle();
+    }
+
+    Promise<absl::Status> PingTimeout() override {
+      LOG(INFO) << "Ping timeout at time: " << Timestamp::Now();
+      // Same error code as
+      // Http2ClientTransport::PingSystemInterfaceImpl::PingTimeout.
+      return Immediate(
+          transport_->HandleError(Http2Status::Http2ConnectionError(
+              Http2ErrorCode::kRefusedStream, "Ping timeout")));
+    }
+
+   private:
+    Http2ServerTransport* transport_;
+    explicit PingSystemInterfaceImpl(Http2ServerTransport* transport)
+        : transport_(transport) {}
+  };
+
+  class KeepAliveInterfaceImpl : public KeepAliveInterface {
+   public:
+    static std::unique_ptr<KeepAliveInterface> Make(
+        Http2ServerTransport* transport) {
+      return std::make_unique<KeepAliveInterfaceImpl>(
+          KeepAliveInterfaceImpl(transport));
+    }
+
+   private:
+    explicit KeepAliveInterfaceImpl(Http2ServerTransport* transport)
+        : transport_(transport) {}
+    Promise<absl::Status> SendPingAndWaitForAck() override {
+      return TrySeq(transport_->TriggerWriteCycle(), [transport = transport_] {
+        return transport->WaitForPingAck();
+      });
+    }
+    Promise<absl::Status> OnKeepAliveTimeout() override {
+      LOG(INFO) << "Keepalive timeout triggered";
+      // Same error code as
+      // Http2ClientTransport::KeepAliveInterfaceImpl::OnKeepAliveTimeout.
+      return Immediate(
+          transport_->HandleError(Http2Status::Http2ConnectionError(
+              Http2ErrorCode::kRefusedStream, "Keepalive timeout")));
+    }
+
+    bool NeedToSendKeepAlivePing() override {
+      MutexLock lock(&transport_->transport_mutex_);
+      return transport_->keepalive_permit_without_calls_ ||
+             !transport_->stream_list_.empty();
+    }
+
+    Http2ServerTransport* transport_;
+  };
 };
 
-GRPC_CHECK_CLASS_SIZE(Http2ServerTransport, 240);
+// Since the corresponding class in CHTTP2 is about 3.9KB, our goal is to
+// remain within that range. When this check fails, please update it to size
+// (current size + 32) to make sure that it does not fail each time we add a
+// small variable to the class.
+GRPC_CHECK_CLASS_SIZE(Http2ServerTransport, 1000);
 
 }  // namespace http2
 }  // namespace grpc_core
@@ -54,10 +54,12 @@
 #include "src/core/ext/transport/chttp2/transport/http2_ztrace_collector.h"
 #include "src/core/ext/transport/chttp2/transport/internal_channel_arg_names.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/ext/transport/chttp2/transport/phase_accounting.h"
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
 #include "src/core/ext/transport/chttp2/transport/ping_rate_policy.h"
 #include "src/core/ext/transport/chttp2/transport/transport_common.h"
+#include "src/core/ext/transport/chttp2/transport/write_deficit.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -590,6 +592,7 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   std::shared_ptr<grpc_core::Http2StatsCollector> http2_stats;
   grpc_core::Http2ZTraceCollector http2_ztrace_collector;
+  grpc_core::Chttp2PhaseAccounting phase_accounting;
 
   GPR_NO_UNIQUE_ADDRESS grpc_core::latent_see::Flow write_flow;
 };
@@ -700,6 +703,9 @@ struct grpc_chttp2_stream {
   /// Number of times written
   int64_t write_counter = 0;
 
+  /// Share of connection writes, when writes are scheduled fairly
+  grpc_core::Chttp2WriteDeficit write_deficit;
+
   grpc_core::Chttp2CallTracerWrapper call_tracer_wrapper;
   // null by default, set by the transport data source upon first query
   grpc_core::RefCountedPtr<grpc_core::channelz::CallNode> channelz_call_node;
@@ -751,6 +757,10 @@ struct grpc_chttp2_stream {
 #define GRPC_ARG_MAX_CONCURRENT_STREAMS_REJECT_ON_CLIENT \
   "grpc.http.max_concurrent_streams_reject_on_client"
 
+// EXPERIMENTAL: size flow control windows from the measured bandwidth and ping
+// round trip time (grpc_core::chttp2::FlowControlStrategy::kModel).
+#define GRPC_ARG_HTTP2_MODEL_FLOW_CONTROL "grpc.http2.model_flow_control"
+
 /// Transport writing call flow:
 /// grpc_chttp2_initiate_write() is called anywhere that we know bytes need to
 /// go out on the wire.
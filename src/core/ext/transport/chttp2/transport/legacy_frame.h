@@ -25,6 +25,8 @@
 typedef struct grpc_chttp2_stream grpc_chttp2_stream;
 typedef struct grpc_chttp2_transport grpc_chttp2_transport;
 
+#define GRPC_CHTTP2_FRAME_HEADER_SIZE 9
+
 #define GRPC_CHTTP2_FRAME_DATA 0
 #define GRPC_CHTTP2_FRAME_HEADER 1
 #define GRPC_CHTTP2_FRAME_CONTINUATION 9
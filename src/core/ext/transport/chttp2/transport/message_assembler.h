@@ -20,12 +20,14 @@
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_MESSAGE_ASSEMBLER_H
 
 #include <cstdint>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
 #include "src/core/call/message.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/http2_status.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
@@ -88,10 +90,11 @@ class GrpcMessageAssembler {
       }
     }
     if (GPR_LIKELY(current_len - kGrpcHeaderSizeInBytes >= header.length)) {
-      SliceBuffer discard;
-      message_buffer_.MoveFirstNBytesIntoSliceBuffer(kGrpcHeaderSizeInBytes,
-                                                     discard);
-      discard.Clear();
+      // Drop the header without a temporary SliceBuffer: many small messages
+      // may arrive in one frame, and this runs once per message.
+      uint8_t discard[kGrpcHeaderSizeInBytes];
+      message_buffer_.MoveFirstNBytesIntoBuffer(kGrpcHeaderSizeInBytes,
+                                                discard);
       // If gRPC header has length 0, we return an empty message.
       // Bounds: Max len of a valid gRPC message is 4 GB in gRPC C++. 2GB for
       // other stacks. Since 4 bytes can hold length of 4GB, we dont check
@@ -121,6 +124,11 @@ class GrpcMessageAssembler {
 
 constexpr uint32_t kMaxMessageBatchSize = (16 * 1024u);
 
+// Messages up to this size are copied, with their headers, into one buffer
+// when batched, so that a run of small messages becomes one slice rather than
+// two per message.
+constexpr uint32_t kMaxPackedMessageSize = 256u;
+
 // This class is meant to convert gRPC Messages into Http2DataFrame ensuring
 // that the payload size of the data frame is configurable.
 // This class is not responsible for queueing or backpressure. That will be done
@@ -146,7 +154,9 @@ class GrpcMessageDisassembler {
         << "Avoid batches larger than " << kMaxMessageBatchSize << "bytes";
   }
 
-  size_t GetBufferedLength() const { return message_.Length(); }
+  size_t GetBufferedLength() const {
+    return message_.Length() + packed_.size();
+  }
 
   // Gets the next Http2DataFrame with a payload of size max_length or lesser.
   Http2DataFrame GenerateNextFrame(const uint32_t stream_id,
@@ -154,6 +164,7 @@ class GrpcMessageDisassembler {
                                    const bool is_end_stream = false) {
     DCHECK_GT(max_length, 0u);
     DCHECK_GT(GetBufferedLength(), 0u);
+    FlushPacked();
     SliceBuffer temp;
     const uint32_t current_length =
         message_.Length() >= max_length ? max_length : message_.Length();
@@ -171,12 +182,34 @@ class GrpcMessageDisassembler {
 
  private:
   void PrepareMessageForSending(MessageHandle message) {
-    AppendGrpcHeaderToSliceBuffer(message_, message->flags(),
-                                  message->payload()->Length());
+    const size_t length = message->payload()->Length();
+    if (IsChttp2PackSmallMessagesEnabled() && length <= kMaxPackedMessageSize) {
+      const size_t offset = packed_.size();
+      packed_.resize(offset + kGrpcHeaderSizeInBytes + length);
+      uint8_t* out = reinterpret_cast<uint8_t*>(packed_.data() + offset);
+      out[0] = static_cast<uint8_t>(message->flags());
+      out[1] = static_cast<uint8_t>(length >> 24);
+      out[2] = static_cast<uint8_t>(length >> 16);
+      out[3] = static_cast<uint8_t>(length >> 8);
+      out[4] = static_cast<uint8_t>(length);
+      message->payload()->CopyToBuffer(out + kGrpcHeaderSizeInBytes);
+      return;
+    }
+    FlushPacked();
+    AppendGrpcHeaderToSliceBuffer(message_, message->flags(), length);
     message_.Append(*(message->payload()));
   }
 
+  // Move packed small messages to the end of message_.
+  void FlushPacked() {
+    if (packed_.empty()) return;
+    message_.Append(Slice::FromCopiedString(std::move(packed_)));
+    packed_.clear();
+  }
+
   SliceBuffer message_;
+  // Small messages not yet moved to message_.
+  std::string packed_;
 };
 
 }  // namespace http2
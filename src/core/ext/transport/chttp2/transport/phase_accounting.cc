@@ -0,0 +1,87 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/phase_accounting.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace grpc_core {
+
+std::atomic<bool> Chttp2PhaseAccounting::enabled_{false};
+
+absl::string_view Chttp2PhaseAccounting::PhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::kReadParsing:
+      return "read_parsing";
+    case Phase::kHeaderDecode:
+      return "header_decode";
+    case Phase::kWriteAssembly:
+      return "write_assembly";
+    case Phase::kEndpointWrite:
+      return "endpoint_write";
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+void Chttp2PhaseAccounting::Record(Phase phase, gpr_cycle_counter cycles) {
+  const gpr_timespec elapsed = gpr_cycle_counter_sub(cycles, 0);
+  RecordNanos(phase, elapsed.tv_sec * GPR_NS_PER_SEC + elapsed.tv_nsec);
+}
+
+void Chttp2PhaseAccounting::RecordNanos(Phase phase, int64_t nanos) {
+  // The cycle counter may step backwards when the thread migrates between
+  // cores.
+  nanos = std::max<int64_t>(nanos, 0);
+  Totals& totals = totals_[static_cast<size_t>(phase)];
+  ++totals.runs;
+  totals.nanos += nanos;
+  totals.max_nanos = std::max(totals.max_nanos, nanos);
+  if (http2_stats_collector_ == nullptr) return;
+  const int micros = static_cast<int>(std::min<int64_t>(
+      nanos / GPR_NS_PER_US, std::numeric_limits<int>::max()));
+  switch (phase) {
+    case Phase::kReadParsing:
+      http2_stats_collector_->IncrementHttp2ReadParsingTime(micros);
+      break;
+    case Phase::kHeaderDecode:
+      http2_stats_collector_->IncrementHttp2HeaderDecodeTime(micros);
+      break;
+    case Phase::kWriteAssembly:
+      http2_stats_collector_->IncrementHttp2WriteAssemblyTime(micros);
+      break;
+    case Phase::kEndpointWrite:
+      http2_stats_collector_->IncrementHttp2EndpointWriteTime(micros);
+      break;
+  }
+}
+
+channelz::PropertyGrid Chttp2PhaseAccounting::ChannelzProperties() const {
+  channelz::PropertyGrid grid;
+  for (size_t i = 0; i < kNumPhases; ++i) {
+    const Phase phase = static_cast<Phase>(i);
+    const Totals& t = totals(phase);
+    grid.SetRow(PhaseName(phase),
+                channelz::PropertyList()
+                    .Set("runs", t.runs)
+                    .Set("total_us", t.nanos / GPR_NS_PER_US)
+                    .Set("max_us", t.max_nanos / GPR_NS_PER_US));
+  }
+  return grid;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,125 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_PHASE_ACCOUNTING_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_PHASE_ACCOUNTING_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "src/core/channelz/property_list.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+// Per transport account of the time spent in each phase of the work that a
+// chttp2 transport does in its combiner, so that the connections that are
+// CPU hot can be found in production without a profiler.
+//
+// Accounting is off by default. It is switched on for the whole process by the
+// chttp2_phase_accounting config var when the core configuration is built, and
+// can be switched on and off at runtime with SetEnabled(). While it is off a
+// Timer costs a single relaxed load.
+//
+// Phases may nest: time spent decoding headers is also counted as time spent
+// parsing the read that carried them.
+class Chttp2PhaseAccounting {
+ public:
+  enum class Phase : uint8_t {
+    // Parsing a read from the endpoint into frames, and acting on them.
+    kReadParsing,
+    // Decoding an HPACK header block fragment.
+    kHeaderDecode,
+    // Gathering frames from streams and the transport into a write.
+    kWriteAssembly,
+    // Handing a write to the endpoint.
+    kEndpointWrite,
+  };
+  static constexpr size_t kNumPhases = 4;
+
+  static absl::string_view PhaseName(Phase phase);
+
+  static void SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+  static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  // Times one run of a phase, from construction to destruction, if accounting
+  // was enabled when it was constructed.
+  class Timer {
+   public:
+    Timer(Chttp2PhaseAccounting* accounting, Phase phase)
+        : accounting_(Enabled() ? accounting : nullptr), phase_(phase) {
+      if (accounting_ != nullptr) start_ = gpr_get_cycle_counter();
+    }
+    ~Timer() {
+      if (accounting_ != nullptr) {
+        accounting_->Record(phase_, gpr_get_cycle_counter() - start_);
+      }
+    }
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+   private:
+    Chttp2PhaseAccounting* const accounting_;
+    const Phase phase_;
+    gpr_cycle_counter start_{};
+  };
+
+  // Runs of each phase are also recorded in the per transport histograms of
+  // this collector.
+  void SetHttp2StatsCollector(
+      std::shared_ptr<Http2StatsCollector> http2_stats_collector) {
+    http2_stats_collector_ = std::move(http2_stats_collector);
+  }
+
+  // Record one run of phase that took the given number of cycles.
+  void Record(Phase phase, gpr_cycle_counter cycles);
+  // Record one run of phase that took the given number of nanoseconds.
+  void RecordNanos(Phase phase, int64_t nanos);
+
+  uint64_t runs(Phase phase) const { return totals(phase).runs; }
+  int64_t total_nanos(Phase phase) const { return totals(phase).nanos; }
+  int64_t max_nanos(Phase phase) const { return totals(phase).max_nanos; }
+
+  channelz::PropertyGrid ChannelzProperties() const;
+
+ private:
+  struct Totals {
+    uint64_t runs = 0;
+    int64_t nanos = 0;
+    int64_t max_nanos = 0;
+  };
+
+  const Totals& totals(Phase phase) const {
+    return totals_[static_cast<size_t>(phase)];
+  }
+
+  static std::atomic<bool> enabled_;
+
+  Totals totals_[kNumPhases];
+  std::shared_ptr<Http2StatsCollector> http2_stats_collector_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_PHASE_ACCOUNTING_H
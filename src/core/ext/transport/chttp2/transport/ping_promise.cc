@@ -58,10 +58,11 @@ Promise<absl::Status> PingManager::PingPromiseCallbacks::WaitForPingAck() {
 // Ping System implementation
 PingManager::PingManager(const ChannelArgs& channel_args,
                          std::unique_ptr<PingInterface> ping_interface,
-                         std::shared_ptr<EventEngine> event_engine)
+                         std::shared_ptr<EventEngine> event_engine,
+                         bool is_client)
     : ping_callbacks_(event_engine),
       ping_abuse_policy_(channel_args),
-      ping_rate_policy_(channel_args, /*is_client=*/true),
+      ping_rate_policy_(channel_args, is_client),
       ping_interface_(std::move(ping_interface)) {}
 
 void PingManager::TriggerDelayedPing(Duration wait) {
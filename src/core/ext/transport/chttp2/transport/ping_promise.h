@@ -82,7 +82,8 @@ class PingManager {
   PingManager(const ChannelArgs& channel_args,
               std::unique_ptr<PingInterface> ping_interface,
               std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-                  event_engine);
+                  event_engine,
+              bool is_client = true);
 
   // Returns a promise that determines if a ping frame should be sent to the
   // peer. If a ping frame is sent, it also spawns a timeout promise that
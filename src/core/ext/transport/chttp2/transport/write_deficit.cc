@@ -0,0 +1,43 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_deficit.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+namespace grpc_core {
+
+void Chttp2WriteDeficit::SetWeight(uint32_t weight) {
+  weight_ = std::clamp<uint32_t>(weight, 1, MaxWeight());
+}
+
+size_t Chttp2WriteDeficit::BeginTurn(size_t pending_bytes) {
+  // Fast lane turns write everything right away, and pay for it later.
+  if (InFastLane(pending_bytes)) return pending_bytes;
+  const int64_t quantum = static_cast<int64_t>(Quantum() * weight_);
+  // A stream held back by flow control or by the write size may carry over at
+  // most one unspent quantum, so that it cannot later burst past the others.
+  deficit_ = std::min(deficit_ + quantum, 2 * quantum);
+  return static_cast<size_t>(std::max<int64_t>(deficit_, 0));
+}
+
+void Chttp2WriteDeficit::EndTurn(size_t written, size_t remaining) {
+  deficit_ -= static_cast<int64_t>(written);
+  // A drained stream forfeits its credit, but not its debt.
+  if (remaining == 0) deficit_ = std::min<int64_t>(deficit_, 0);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,75 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_DEFICIT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_DEFICIT_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace grpc_core {
+
+// Per stream state for deficit round robin scheduling of connection writes.
+//
+// Writable streams take turns writing. On each turn a stream earns Quantum()
+// bytes per unit of weight and may write up to what it has earned; whatever it
+// does not spend carries over only while it still has data waiting. A bulk
+// stream therefore no longer fills a whole write while small calls queue
+// behind it, and over time streams share the connection in proportion to
+// their weights.
+//
+// Small writes, such as most unary requests and responses, are served ahead
+// of other streams. They are charged against the deficit like any other write,
+// and may run it into debt; a stream in debt waits for its turn like the
+// others until the debt is paid back, so a bulk stream cannot skip the queue
+// by writing in small pieces.
+class Chttp2WriteDeficit {
+ public:
+  // Bytes earned per turn per unit of weight: the default HTTP/2 frame size.
+  static constexpr size_t Quantum() { return 16 * 1024; }
+  // Largest possible weight.
+  static constexpr uint32_t MaxWeight() { return 64; }
+  // Largest write served in the fast lane.
+  static constexpr size_t SmallWrite() { return 4 * 1024; }
+
+  // Whether a stream with pending_bytes waiting may be served ahead of the
+  // others.
+  bool InFastLane(size_t pending_bytes) const {
+    return pending_bytes <= SmallWrite() && deficit_ >= 0;
+  }
+
+  // Set the weight, clamped to 1..MaxWeight().
+  void SetWeight(uint32_t weight);
+  uint32_t weight() const { return weight_; }
+
+  // Begin a turn for a stream with pending_bytes waiting to be written.
+  // Returns how many of them may be written this turn.
+  // EndTurn must be called when the turn completes.
+  size_t BeginTurn(size_t pending_bytes);
+  // End the current turn: written bytes were written, and remaining bytes
+  // are still waiting.
+  void EndTurn(size_t written, size_t remaining);
+
+  // Bytes earned and not spent yet, negative while in debt.
+  int64_t deficit() const { return deficit_; }
+
+ private:
+  uint32_t weight_ = 1;
+  int64_t deficit_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_DEFICIT_H
@@ -19,10 +19,62 @@
 #include <algorithm>
 
 #include "absl/log/check.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 
-size_t Chttp2WriteSizePolicy::WriteTargetSize() { return current_target_; }
+size_t Chttp2WriteSizePolicy::WriteTargetSize() {
+  last_limit_ = Limit::kWriteLatency;
+  const auto bytes_per_rtt = BytesPerRoundTrip();
+  if (!bytes_per_rtt.has_value()) return current_target_;
+  // Anything the kernel has not sent yet is already queued ahead of this
+  // write, and bigger bursts only bloat the send buffer.
+  const uint64_t notsent = endpoint_metrics_->notsent_bytes.value_or(0);
+  const uint64_t burst = 2 * *bytes_per_rtt > notsent
+                             ? 2 * *bytes_per_rtt - notsent
+                             : 0;
+  const size_t max_target = Clamp<uint64_t>(burst, MinTarget(), MaxTarget());
+  const size_t min_target =
+      std::min<uint64_t>(*bytes_per_rtt / 4, max_target);
+  if (current_target_ > max_target) {
+    last_limit_ = Limit::kBurst;
+    return max_target;
+  }
+  if (current_target_ < min_target) {
+    last_limit_ = Limit::kPacing;
+    return min_target;
+  }
+  return current_target_;
+}
+
+std::optional<uint64_t> Chttp2WriteSizePolicy::BytesPerRoundTrip() const {
+  if (!endpoint_metrics_.has_value() ||
+      Timestamp::Now() - endpoint_metrics_time_ > EndpointSampleLifetime()) {
+    return std::nullopt;
+  }
+  if (endpoint_metrics_->pacing_rate.has_value() &&
+      endpoint_metrics_->min_rtt_us.has_value()) {
+    return *endpoint_metrics_->pacing_rate * *endpoint_metrics_->min_rtt_us /
+           1000000;
+  }
+  if (endpoint_metrics_->congestion_window.has_value()) {
+    return *endpoint_metrics_->congestion_window * AssumedSegmentSize();
+  }
+  return std::nullopt;
+}
+
+std::shared_ptr<Chttp2WriteSizePolicy::EndpointSample>
+Chttp2WriteSizePolicy::MaybeSampleEndpoint() {
+  CHECK(experiment_start_time_ == Timestamp::InfFuture());
+  if (pending_sample_ != nullptr) return nullptr;
+  const Timestamp now = Timestamp::Now();
+  if (now - last_sample_request_time_ < EndpointSampleInterval()) {
+    return nullptr;
+  }
+  last_sample_request_time_ = now;
+  pending_sample_ = std::make_shared<EndpointSample>();
+  return pending_sample_;
+}
 
 void Chttp2WriteSizePolicy::BeginWrite(size_t size) {
   CHECK(experiment_start_time_ == Timestamp::InfFuture());
@@ -36,6 +88,14 @@ void Chttp2WriteSizePolicy::BeginWrite(size_t size) {
 }
 
 void Chttp2WriteSizePolicy::EndWrite(bool success) {
+  if (pending_sample_ != nullptr) {
+    auto metrics = pending_sample_->Take();
+    pending_sample_.reset();
+    if (metrics.has_value()) {
+      endpoint_metrics_ = std::move(metrics);
+      endpoint_metrics_time_ = Timestamp::Now();
+    }
+  }
   if (experiment_start_time_ == Timestamp::InfFuture()) return;
   const auto elapsed = Timestamp::Now() - experiment_start_time_;
   experiment_start_time_ = Timestamp::InfFuture();
@@ -19,6 +19,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -38,9 +44,68 @@ class Chttp2WriteSizePolicy {
   static constexpr Duration TargetWriteTime() {
     return Duration::Milliseconds(300);
   }
+  // How often to sample endpoint metrics
+  static constexpr Duration EndpointSampleInterval() {
+    return Duration::Milliseconds(100);
+  }
+  // How long an endpoint sample remains usable
+  static constexpr Duration EndpointSampleLifetime() {
+    return Duration::Seconds(1);
+  }
+  // Segment size assumed when only the congestion window is known
+  static constexpr uint64_t AssumedSegmentSize() { return 1448; }
+
+  // Connection state sampled by the endpoint as a write was sent: on posix,
+  // from TCP_INFO.
+  struct EndpointMetrics {
+    // Rate the kernel paces the connection at, in bytes per second.
+    std::optional<uint64_t> pacing_rate;
+    // Smallest round trip time the kernel has seen, in microseconds.
+    std::optional<uint64_t> min_rtt_us;
+    // Congestion window, in segments.
+    std::optional<uint64_t> congestion_window;
+    // Bytes written to the socket that the kernel has not sent yet.
+    std::optional<uint64_t> notsent_bytes;
+  };
+
+  // Collects an endpoint sample. The endpoint may report it from any thread,
+  // but does so before the write it was requested for completes.
+  class EndpointSample {
+   public:
+    void Set(EndpointMetrics metrics) {
+      MutexLock lock(&mu_);
+      metrics_ = metrics;
+    }
+
+   private:
+    friend class Chttp2WriteSizePolicy;
+    std::optional<EndpointMetrics> Take() {
+      MutexLock lock(&mu_);
+      return std::move(metrics_);
+    }
+
+    Mutex mu_;
+    std::optional<EndpointMetrics> metrics_ ABSL_GUARDED_BY(mu_);
+  };
+
+  // What decided the last WriteTargetSize().
+  enum class Limit {
+    // Write latency alone.
+    kWriteLatency,
+    // Lowered so as not to queue more than the connection sends in two round
+    // trips, given what the kernel has not sent yet.
+    kBurst,
+    // Raised to a quarter of what the connection sends per round trip, to
+    // avoid many small writes to a fast connection.
+    kPacing,
+  };
 
   // What size should be targeted for the next write.
   size_t WriteTargetSize();
+  Limit last_limit() const { return last_limit_; }
+  // If an endpoint sample is due, returns where the endpoint should report it
+  // for the next write. Must be called before BeginWrite.
+  std::shared_ptr<EndpointSample> MaybeSampleEndpoint();
   // Notify the policy that a write of some size has begun.
   // EndWrite must be called when the write completes.
   void BeginWrite(size_t size);
@@ -48,8 +113,17 @@ class Chttp2WriteSizePolicy {
   void EndWrite(bool success);
 
  private:
+  // Bytes the connection sends per round trip according to the last endpoint
+  // sample, if it is recent enough.
+  std::optional<uint64_t> BytesPerRoundTrip() const;
+
   size_t current_target_ = 128 * 1024;
+  Limit last_limit_ = Limit::kWriteLatency;
   Timestamp experiment_start_time_ = Timestamp::InfFuture();
+  std::shared_ptr<EndpointSample> pending_sample_;
+  Timestamp last_sample_request_time_ = Timestamp::InfPast();
+  std::optional<EndpointMetrics> endpoint_metrics_;
+  Timestamp endpoint_metrics_time_ = Timestamp::InfPast();
   // State varies from -2...2
   // Every time we do a write faster than kFastWrite, we decrement
   // Every time we do a write slower than kSlowWrite, we increment
@@ -262,6 +262,16 @@ class WriteContext {
   explicit WriteContext(grpc_chttp2_transport* t) : t_(t) {
     t->http2_stats->IncrementHttp2WritesBegun();
     t->http2_stats->IncrementHttp2WriteTargetSize(target_write_size_);
+    switch (t->write_size_policy.last_limit()) {
+      case grpc_core::Chttp2WriteSizePolicy::Limit::kWriteLatency:
+        break;
+      case grpc_core::Chttp2WriteSizePolicy::Limit::kBurst:
+        t->http2_stats->IncrementHttp2WriteTargetBurstLimited();
+        break;
+      case grpc_core::Chttp2WriteSizePolicy::Limit::kPacing:
+        t->http2_stats->IncrementHttp2WriteTargetPacingRaised();
+        break;
+    }
   }
 
   void FlushSettings() {
@@ -420,7 +430,7 @@ class DataSendContext {
     return grpc_core::Clamp<int64_t>(
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
-             t_->flow_control.remote_window(),
+             t_->flow_control.remote_window(), byte_budget_,
              static_cast<int64_t>(write_context_->target_write_size()) -
                  (grpc_core::IsChttp2BoundWriteSizeEnabled()
                       ? static_cast<int64_t>(t_->outbuf.Length())
@@ -430,6 +440,12 @@ class DataSendContext {
 
   bool AnyOutgoing() const { return max_outgoing() > 0; }
 
+  // Limit the bytes sent from here on.
+  void LimitBytes(size_t max_bytes) {
+    byte_budget_ = static_cast<int64_t>(
+        std::min<size_t>(max_bytes, std::numeric_limits<int64_t>::max()));
+  }
+
   void FlushBytes() {
     uint32_t send_bytes =
         static_cast<uint32_t>(std::min(static_cast<size_t>(max_outgoing()),
@@ -443,6 +459,7 @@ class DataSendContext {
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    byte_budget_ -= send_bytes;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -463,6 +480,7 @@ class DataSendContext {
   grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext sfc_upd_{
       &s_->flow_control};
   const size_t sending_bytes_before_;
+  int64_t byte_budget_ = std::numeric_limits<int64_t>::max();
   bool is_last_frame_ = false;
 };
 
@@ -572,10 +590,22 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
+    // With fair writes the stream may only send what it has earned this turn,
+    // and then goes to the back of the writable list.
+    const bool fair = grpc_core::IsChttp2WeightedFairWritesEnabled();
+    const size_t pending_bytes = s_->flow_controlled_buffer.length;
+    if (fair) {
+      data_send_context.LimitBytes(s_->write_deficit.BeginTurn(pending_bytes));
+    }
     while (s_->flow_controlled_buffer.length > 0 &&
            data_send_context.max_outgoing() > 0) {
       data_send_context.FlushBytes();
     }
+    if (fair) {
+      s_->write_deficit.EndTurn(
+          pending_bytes - s_->flow_controlled_buffer.length,
+          s_->flow_controlled_buffer.length);
+    }
     grpc_chttp2_reset_ping_clock(t_);
     if (data_send_context.is_last_frame()) {
       SentLastFrame();
@@ -0,0 +1,57 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_PRIORITY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_PRIORITY_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+/// The class of a closure scheduled with
+/// EventEngineSupportsRunPriorityExtension::RunWithPriority.
+enum class RunPriority {
+  /// Work on the critical path of RPCs, e.g. completion callbacks. Runs
+  /// before closures of the other classes.
+  kLatencySensitive,
+  /// The class of closures scheduled with EventEngine::Run.
+  kDefault,
+  /// Work that may wait, e.g. control plane updates or channelz dumps. Runs
+  /// when there is nothing else to do, but the EventEngine bounds how long
+  /// these closures can be starved.
+  kBackground,
+};
+
+/// An EventEngine extension to schedule closures with a priority class.
+class EventEngineSupportsRunPriorityExtension {
+ public:
+  virtual ~EventEngineSupportsRunPriorityExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.run_priority";
+  }
+
+  /// Like EventEngine::Run, with the given priority class.
+  virtual void RunWithPriority(RunPriority priority,
+                               EventEngine::Closure* closure) = 0;
+  virtual void RunWithPriority(RunPriority priority,
+                               absl::AnyInvocable<void()> closure) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_PRIORITY_H
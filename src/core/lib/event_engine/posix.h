@@ -21,7 +21,9 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/event_engine/extensions/can_track_errors.h"
+#include "src/core/lib/event_engine/extensions/channelz.h"
 #include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
+#include "src/core/lib/event_engine/extensions/run_priority.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 
@@ -35,10 +37,12 @@ class PosixEndpointWithChaoticGoodSupport
                           EndpointCanTrackErrorsExtension> {};
 
 /// This defines an interface that posix specific EventEngines endpoints
-/// may implement to support additional file descriptor related functionality.
+/// may implement to support additional file descriptor related functionality,
+/// and to report endpoint state through channelz.
 class PosixEndpointWithFdSupport
     : public ExtendedType<EventEngine::Endpoint, EndpointSupportsFdExtension,
-                          EndpointCanTrackErrorsExtension> {};
+                          EndpointCanTrackErrorsExtension, ChannelzExtension> {
+};
 
 /// Defines an interface that posix EventEngine listeners may implement to
 /// support additional file descriptor related functionality.
@@ -47,9 +51,11 @@ class PosixListenerWithFdSupport
 };
 
 /// Defines an interface that posix EventEngines may implement to
-/// support additional file descriptor related functionality.
+/// support additional file descriptor related functionality, and closure
+/// priorities.
 class PosixEventEngineWithFdSupport
-    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension> {};
+    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension,
+                          EventEngineSupportsRunPriorityExtension> {};
 
 }  // namespace grpc_event_engine::experimental
 
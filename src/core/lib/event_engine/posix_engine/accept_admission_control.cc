@@ -0,0 +1,71 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/accept_admission_control.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/log/log.h"
+#include "src/core/lib/debug/trace.h"
+
+namespace grpc_event_engine::experimental {
+
+AcceptAdmissionControl::AcceptAdmissionControl(
+    grpc_core::MemoryQuotaRefPtr memory_quota, int max_connections)
+    : memory_quota_(std::move(memory_quota)),
+      max_connections_(max_connections),
+      // Resume once a tenth of the connections have gone away.
+      resume_connections_(std::min(max_connections - max_connections / 10,
+                                   max_connections - 1)) {}
+
+bool AcceptAdmissionControl::ShouldAccept() {
+  return ShouldAcceptAt(memory_quota_ == nullptr
+                            ? 0.0
+                            : memory_quota_->GetPressureInfo()
+                                  .pressure_control_value);
+}
+
+bool AcceptAdmissionControl::ShouldAcceptAt(double memory_pressure) {
+  const int live = live_connections();
+  const bool limited = max_connections_ > 0;
+  if (paused_.load(std::memory_order_relaxed)) {
+    if (memory_pressure >= kResumeMemoryPressure ||
+        (limited && live > resume_connections_)) {
+      return false;
+    }
+    if (paused_.exchange(false, std::memory_order_relaxed)) {
+      GRPC_TRACE_LOG(event_engine, INFO)
+          << "AcceptAdmissionControl[" << this
+          << "]: resuming accepts: memory pressure " << memory_pressure
+          << ", " << live << " connections";
+    }
+    return true;
+  }
+  if (memory_pressure <= kPauseMemoryPressure &&
+      (!limited || live < max_connections_)) {
+    return true;
+  }
+  if (!paused_.exchange(true, std::memory_order_relaxed)) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "AcceptAdmissionControl[" << this
+        << "]: pausing accepts: memory pressure " << memory_pressure << ", "
+        << live << " connections";
+  }
+  return false;
+}
+
+}  // namespace grpc_event_engine::experimental
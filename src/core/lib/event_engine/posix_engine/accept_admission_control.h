@@ -0,0 +1,74 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_ACCEPT_ADMISSION_CONTROL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_ACCEPT_ADMISSION_CONTROL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+namespace grpc_event_engine::experimental {
+
+// Decides whether a listener should accept more connections. While the memory
+// quota is under high pressure or the listener already holds its maximum
+// number of connections, accepting is paused and new connections wait in the
+// kernel accept queue, where they cost no memory and no setup work. Accepting
+// resumes only once both have dropped well below the limits that paused it, so
+// that the listener does not flap around them.
+class AcceptAdmissionControl {
+ public:
+  // Memory pressure above which accepting pauses.
+  static constexpr double kPauseMemoryPressure = 0.99;
+  // Memory pressure below which a paused listener may resume accepting.
+  static constexpr double kResumeMemoryPressure = 0.9;
+
+  // memory_quota may be null, in which case memory pressure is ignored. If
+  // max_connections is not positive, the number of connections is unlimited.
+  AcceptAdmissionControl(grpc_core::MemoryQuotaRefPtr memory_quota,
+                         int max_connections);
+
+  // Returns true if the listener should accept the next connection.
+  bool ShouldAccept();
+  // As above, given the current memory pressure.
+  bool ShouldAcceptAt(double memory_pressure);
+
+  // Called for every connection the listener accepts, and again once the
+  // connection is closed.
+  void OnConnectionAccepted() {
+    live_connections_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void OnConnectionClosed() {
+    live_connections_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  int live_connections() const {
+    return live_connections_.load(std::memory_order_relaxed);
+  }
+  bool paused() const { return paused_.load(std::memory_order_relaxed); }
+
+ private:
+  const grpc_core::MemoryQuotaRefPtr memory_quota_;
+  const int max_connections_;
+  // Number of connections at or below which a paused listener may resume.
+  const int resume_connections_;
+  std::atomic<int> live_connections_{0};
+  std::atomic<bool> paused_{false};
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_ACCEPT_ADMISSION_CONTROL_H
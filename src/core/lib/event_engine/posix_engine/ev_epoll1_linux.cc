@@ -19,14 +19,18 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <utility>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
 #include "src/core/lib/event_engine/time_util.h"
@@ -47,6 +51,8 @@
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
@@ -244,7 +250,11 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+    : scheduler_(scheduler),
+      was_kicked_(false),
+      busy_poll_duration_(std::chrono::microseconds(
+          std::max(0, grpc_core::ConfigVars::Get().PosixPollerBusyPollUs()))),
+      closed_(false) {
   g_epoll_set_.epfd = posix_interface().EpollCreateAndCloexec().value();
   wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
   CHECK(wakeup_fd_ != nullptr);
@@ -377,6 +387,43 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
   return r;
 }
 
+int Epoll1Poller::BusyPollEpollWait(EventEngine::Duration timeout,
+                                    bool& kicked) {
+  const auto start = std::chrono::steady_clock::now();
+  const auto spin_deadline = start + std::min(timeout, busy_poll_duration_);
+  {
+    grpc_core::MutexLock lock(&mu_);
+    spinning_ = true;
+  }
+  int r;
+  auto now = start;
+  do {
+    r = DoEpollWait(EventEngine::Duration::zero());
+    now = std::chrono::steady_clock::now();
+  } while (r == 0 &&
+           !kicked_while_spinning_.load(std::memory_order_relaxed) &&
+           now < spin_deadline);
+  {
+    // A Kick() that finds spinning_ false from here on goes through the
+    // wakeup fd and wakes up the blocking epoll_wait below.
+    grpc_core::MutexLock lock(&mu_);
+    spinning_ = false;
+    kicked = kicked_while_spinning_.exchange(false, std::memory_order_relaxed);
+  }
+  grpc_core::global_stats().IncrementPosixPollerSpinTimeUs(
+      std::chrono::duration_cast<std::chrono::microseconds>(now - start)
+          .count());
+  if (r > 0 || kicked) return r;
+  const auto remaining = timeout - (now - start);
+  if (remaining <= EventEngine::Duration::zero()) return 0;
+  r = DoEpollWait(remaining);
+  grpc_core::global_stats().IncrementPosixPollerBlockedTimeMs(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - now)
+          .count());
+  return r;
+}
+
 // Might be called multiple times
 void Epoll1EventHandle::ShutdownHandle(absl::Status why) {
   // A mutex is required here because, the SetShutdown method of the
@@ -421,16 +468,28 @@ Poller::WorkResult Epoll1Poller::Work(
   Events pending_events;
   bool was_kicked_ext = false;
   if (g_epoll_set_.cursor == g_epoll_set_.num_events) {
-    if (DoEpollWait(timeout) == 0) {
-      return Poller::WorkResult::kDeadlineExceeded;
+    bool kicked_while_spinning = false;
+    int r = busy_poll_duration_ > EventEngine::Duration::zero() &&
+                    timeout > EventEngine::Duration::zero()
+                ? BusyPollEpollWait(timeout, kicked_while_spinning)
+                : DoEpollWait(timeout);
+    if (r == 0) {
+      if (!kicked_while_spinning) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
+      grpc_core::MutexLock lock(&mu_);
+      was_kicked_ = false;
+      return Poller::WorkResult::kKicked;
     }
+    was_kicked_ext = kicked_while_spinning;
   }
   {
     grpc_core::MutexLock lock(&mu_);
     // If was_kicked_ is true, collect all pending events in this iteration.
     if (ProcessEpollEvents(
             was_kicked_ ? INT_MAX : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
-            pending_events)) {
+            pending_events) ||
+        was_kicked_ext) {
       was_kicked_ = false;
       was_kicked_ext = true;
     }
@@ -453,6 +512,12 @@ void Epoll1Poller::Kick() {
     return;
   }
   was_kicked_ = true;
+  if (spinning_) {
+    // The spinning thread checks this flag between its epoll_wait calls, so
+    // there is no need for a wakeup fd round-trip.
+    kicked_while_spinning_.store(true, std::memory_order_relaxed);
+    return;
+  }
   CHECK(wakeup_fd_->Wakeup().ok());
 }
 
@@ -491,6 +556,7 @@ void Epoll1Poller::ResetKickState() {
   CHECK(status.ok()) << status.StrError();
   grpc_core::MutexLock lock(&mu_);
   was_kicked_ = false;
+  kicked_while_spinning_.store(false, std::memory_order_relaxed);
 }
 
 std::shared_ptr<Epoll1Poller> MakeEpoll1Poller(Scheduler* scheduler) {
@@ -511,7 +577,8 @@ namespace grpc_event_engine::experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */)
+    : busy_poll_duration_(EventEngine::Duration::zero()) {
   grpc_core::Crash("unimplemented");
 }
 
@@ -532,6 +599,11 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration /*timeout*/) {
   grpc_core::Crash("unimplemented");
 }
 
+int Epoll1Poller::BusyPollEpollWait(EventEngine::Duration /*timeout*/,
+                                    bool& /*kicked*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 Poller::WorkResult Epoll1Poller::Work(
     EventEngine::Duration /*timeout*/,
     absl::FunctionRef<void()> /*schedule_poll_again*/) {
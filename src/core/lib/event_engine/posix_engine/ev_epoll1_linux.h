@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
@@ -44,6 +45,11 @@ namespace grpc_event_engine::experimental {
 class Epoll1EventHandle;
 
 // Definition of epoll1 based poller.
+//
+// When GRPC_POSIX_POLLER_BUSY_POLL_US is set, Work() first spins on a
+// non-blocking epoll_wait for up to that many microseconds and only blocks
+// once the spin budget is used up. This trades CPU for wakeup latency. Kicks
+// that arrive while the poller spins do not go through the wakeup fd.
 class Epoll1Poller : public PosixEventPoller {
  public:
   explicit Epoll1Poller(Scheduler* scheduler);
@@ -90,6 +96,13 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+
+  // Like DoEpollWait(), but spins with a zero timeout for up to
+  // busy_poll_duration_ before blocking for the rest of the timeout. Sets
+  // kicked to true and returns early if the poller was kicked while spinning.
+  int BusyPollEpollWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      bool& kicked);
   friend class Epoll1EventHandle;
 #ifdef GRPC_LINUX_EPOLL
   struct EpollSet {
@@ -113,6 +126,14 @@ class Epoll1Poller : public PosixEventPoller {
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // How long Work() spins before blocking in epoll_wait. Zero disables busy
+  // polling.
+  const EventEngine::Duration busy_poll_duration_;
+  // True while a Work() call is spinning in BusyPollEpollWait().
+  bool spinning_ ABSL_GUARDED_BY(mu_) = false;
+  // Set by Kick() instead of writing to the wakeup fd while spinning_ is true.
+  // Only written with mu_ held, but read without it by the spinning thread.
+  std::atomic<bool> kicked_while_spinning_{false};
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
 #if GRPC_ENABLE_FORK_SUPPORT
   absl::flat_hash_set<EventHandle*> fork_handles_set_ ABSL_GUARDED_BY(mu_);
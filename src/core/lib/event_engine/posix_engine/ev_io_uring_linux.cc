@@ -0,0 +1,715 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+// This polling engine is only relevant on linux kernels supporting io_uring.
+#ifdef GRPC_LINUX_IO_URING
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Completions tagged with this value carry no information (e.g. the result of
+// a poll remove request) and are skipped.
+constexpr uint64_t kIgnoredUserData = 0;
+// Bit 0 of the user data of a handle's poll request stores track_err. Bit 1
+// tags the poll request of the wakeup fd, in which case the remaining bits
+// carry the wakeup fd generation.
+constexpr uint64_t kTrackErrBit = 1;
+constexpr uint64_t kWakeupBit = 2;
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+uint32_t PollMask(uint32_t events) {
+#if __BYTE_ORDER == __BIG_ENDIAN
+  // The kernel reads poll32_events as two swapped 16 bit halves on big endian
+  // architectures.
+  events = (events << 16) | (events >> 16);
+#endif
+  return events;
+}
+
+// It is possible that the kernel headers provide io_uring but the running
+// kernel doesn't, or that io_uring is disabled (e.g. by seccomp or the
+// kernel.io_uring_disabled sysctl). Create a ring to make sure the features
+// this poller depends on are available. Multishot poll requests are available
+// since 5.13 and are implied by IORING_FEAT_CQE_SKIP (5.17). Waiting with a
+// timeout requires IORING_FEAT_EXT_ARG (5.11).
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = IoUringSetup(8, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  close(fd);
+  constexpr uint32_t kRequiredFeatures =
+      IORING_FEAT_SINGLE_MMAP | IORING_FEAT_EXT_ARG | IORING_FEAT_CQE_SKIP;
+  return (params.features & kRequiredFeatures) == kRequiredFeatures;
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(const FileDescriptor& fd, IoUringPoller* poller)
+      : fd_(fd),
+        poller_(poller),
+        read_closure_(poller->GetScheduler()),
+        write_closure_(poller->GetScheduler()),
+        error_closure_(poller->GetScheduler()) {
+    read_closure_.InitEvent();
+    write_closure_.InitEvent();
+    error_closure_.InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(FileDescriptor fd) {
+    fd_ = fd;
+    poll_fd_ = -1;
+    orphaned_ = false;
+    read_closure_.InitEvent();
+    write_closure_.InitEvent();
+    error_closure_.InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why atomics are needed.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  FileDescriptor WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, FileDescriptor* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_.SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_.SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_.SetReady();
+    }
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  friend class IoUringPoller;
+  void HandleShutdownInternal(absl::Status why);
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required.
+  grpc_core::Mutex mu_;
+  FileDescriptor fd_;
+  // The raw file descriptor and user data the poll request was submitted
+  // with. Used to re-arm the request when the kernel terminates it.
+  // Guarded by poller_->mu_.
+  int poll_fd_ = -1;
+  uint64_t poll_user_data_ = kIgnoredUserData;
+  uint32_t poll_events_ = 0;
+  // Set once the handle is orphaned. Completions of an orphaned handle are
+  // dropped, and the handle is recycled once the kernel reports that its poll
+  // request terminated. Guarded by poller_->mu_.
+  bool orphaned_ = false;
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  LockfreeEvent read_closure_;
+  LockfreeEvent write_closure_;
+  LockfreeEvent error_closure_;
+};
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      FileDescriptor* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_.IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  auto& posix_interface = poller_->posix_interface();
+  // The poll request holds its own reference to the file, so it is fine to
+  // release or close the file descriptor before the request is removed below.
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    posix_interface.Shutdown(fd_, SHUT_RDWR);
+    posix_interface.Close(fd_);
+  }
+
+  {
+    // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_.DestroyEvent();
+    write_closure_.DestroyEvent();
+    error_closure_.DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  {
+    grpc_core::MutexLock lock(&poller_->mu_);
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    poller_->fork_handles_set_.erase(this);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+    orphaned_ = true;
+    poller_->orphaned_handles_.insert(this);
+    poller_->SubmitPollRemove(poll_user_data_);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(
+      &why, grpc_core::StatusIntProperty::kRpcStatus,
+      absl::IsCancelled(why) ? GRPC_STATUS_CANCELLED : GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_.SetShutdown(why)) {
+    write_closure_.SetShutdown(why);
+    error_closure_.SetShutdown(why);
+  }
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_.IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_.NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_.NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_.NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_.SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_.SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_.SetReady(); }
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler, unsigned sq_entries)
+    : scheduler_(scheduler),
+      sq_entries_(sq_entries),
+      was_kicked_(false),
+      closed_(false) {
+  wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
+  CHECK(wakeup_fd_ != nullptr);
+  grpc_core::MutexLock lock(&mu_);
+  grpc_core::MutexLock ring_lock(&ring_mu_);
+  CHECK(InitRing());
+  GRPC_TRACE_LOG(event_engine_poller, INFO) << "grpc io_uring fd: "
+                                            << ring_.fd;
+}
+
+bool IoUringPoller::InitRing() {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  // Readiness notifications for every registered fd may be outstanding at the
+  // same time, so size the completion queue well beyond the submission queue.
+  params.flags = IORING_SETUP_CQSIZE;
+  params.cq_entries = sq_entries_ * 16;
+  int fd = IoUringSetup(sq_entries_, &params);
+  if (fd < 0) {
+    LOG(ERROR) << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  ring_.fd = fd;
+  ring_.sq_entries = params.sq_entries;
+  // IORING_FEAT_SINGLE_MMAP is checked for in InitIoUringPollerLinux, so the
+  // submission and completion rings share a single mapping.
+  size_t ring_size = std::max<size_t>(
+      params.sq_off.array + params.sq_entries * sizeof(unsigned),
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+  void* ring_ptr = mmap(nullptr, ring_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring_ptr == MAP_FAILED) {
+    LOG(ERROR) << "io_uring ring mmap failed: " << grpc_core::StrError(errno);
+    close(fd);
+    ring_ = Ring();
+    return false;
+  }
+  ring_.sq_ptr = ring_ptr;
+  ring_.sq_ptr_size = ring_size;
+  ring_.cq_ptr = ring_ptr;
+  ring_.cq_ptr_size = ring_size;
+  ring_.sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  void* sqes_ptr = mmap(nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (sqes_ptr == MAP_FAILED) {
+    LOG(ERROR) << "io_uring sqes mmap failed: " << grpc_core::StrError(errno);
+    munmap(ring_ptr, ring_size);
+    close(fd);
+    ring_ = Ring();
+    return false;
+  }
+  ring_.sqes = static_cast<struct io_uring_sqe*>(sqes_ptr);
+  char* sq = static_cast<char*>(ring_.sq_ptr);
+  ring_.sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring_.sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring_.sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  char* cq = static_cast<char*>(ring_.cq_ptr);
+  ring_.cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring_.cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring_.cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+  ArmWakeupFd();
+  return true;
+}
+
+void IoUringPoller::DestroyRing() {
+  if (ring_.fd < 0) return;
+  munmap(ring_.sqes, ring_.sqes_size);
+  if (ring_.cq_ptr != ring_.sq_ptr) {
+    munmap(ring_.cq_ptr, ring_.cq_ptr_size);
+  }
+  munmap(ring_.sq_ptr, ring_.sq_ptr_size);
+  close(ring_.fd);
+  ring_ = Ring();
+  // Requests that never made it to the kernel belong to the old ring.
+  overflow_sqes_.clear();
+}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  {
+    grpc_core::MutexLock ring_lock(&ring_mu_);
+    DestroyRing();
+  }
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  // The ring is gone, so no completion will ever be reported for these.
+  for (IoUringEventHandle* handle : orphaned_handles_) {
+    delete handle;
+  }
+  orphaned_handles_.clear();
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+void IoUringPoller::SubmitSqe(
+    absl::FunctionRef<void(struct io_uring_sqe*)> fill) {
+  if (ring_.fd < 0) return;
+  struct io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  fill(&sqe);
+  // Entries waiting in overflow_sqes_ go first: a poll remove request must
+  // never overtake the poll add request it refers to.
+  if (overflow_sqes_.empty() && PushSqe(sqe)) {
+    FlushSubmissions();
+    return;
+  }
+  // Dropping the entry would lose a poll registration and leave its fd hanging
+  // forever. Keep it, and make sure Work() runs to reap the completions the
+  // kernel is waiting on before it accepts more submissions.
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "io_uring submission queue is full, deferring submission";
+  overflow_sqes_.push_back(sqe);
+  KickLocked();
+}
+
+bool IoUringPoller::PushSqe(const struct io_uring_sqe& sqe) {
+  unsigned tail = *ring_.sq_tail;
+  unsigned head = __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  if (tail - head == ring_.sq_entries) {
+    FlushSubmissions();
+    head = __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+    if (tail - head == ring_.sq_entries) return false;
+  }
+  unsigned index = tail & *ring_.sq_mask;
+  ring_.sqes[index] = sqe;
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool IoUringPoller::FlushSubmissions() {
+  unsigned tail = *ring_.sq_tail;
+  unsigned head = __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  if (tail == head) return true;
+  // Entries left over by a previous failed submission are flushed as well.
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, tail - head, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    // EBUSY and EAGAIN are transient: the entries stay queued and are
+    // submitted again once completions have been reaped.
+    if (errno != EBUSY && errno != EAGAIN) {
+      LOG(ERROR) << "io_uring_enter submission failed: "
+                 << grpc_core::StrError(errno);
+    }
+    return false;
+  }
+  return static_cast<unsigned>(r) == tail - head;
+}
+
+void IoUringPoller::RetryOverflowSqes() {
+  if (ring_.fd < 0) return;
+  size_t pushed = 0;
+  while (pushed < overflow_sqes_.size() && PushSqe(overflow_sqes_[pushed])) {
+    ++pushed;
+  }
+  overflow_sqes_.erase(overflow_sqes_.begin(),
+                       overflow_sqes_.begin() + pushed);
+  if (!FlushSubmissions() || !overflow_sqes_.empty()) {
+    // Still backed up: come back after the next batch of completions.
+    KickLocked();
+  }
+}
+
+void IoUringPoller::SubmitPollAdd(int fd, uint64_t user_data,
+                                  uint32_t events) {
+  SubmitSqe([fd, user_data, events](struct io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = PollMask(events);
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->user_data = user_data;
+  });
+}
+
+void IoUringPoller::SubmitPollRemove(uint64_t user_data) {
+  SubmitSqe([user_data](struct io_uring_sqe* sqe) {
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = user_data;
+    sqe->user_data = kIgnoredUserData;
+  });
+}
+
+void IoUringPoller::ArmWakeupFd() {
+  auto fd = posix_interface().GetFd(wakeup_fd_->ReadFd());
+  CHECK(fd.ok()) << fd.StrError();
+  SubmitPollAdd(*fd, (wakeup_generation_ << 2) | kWakeupBit, POLLIN);
+}
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor fd,
+                                         absl::string_view /*name*/,
+                                         bool track_err) {
+  grpc_core::MutexLock lock(&mu_);
+  IoUringEventHandle* new_handle = nullptr;
+  if (free_io_uring_handles_list_.empty()) {
+    new_handle = new IoUringEventHandle(fd, this);
+  } else {
+    new_handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    new_handle->ReInit(fd);
+  }
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+  fork_handles_set_.emplace(new_handle);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  // As with epoll1, the least significant bit of the user data stores
+  // track_err so that it does not need to be read from the handle when a
+  // completion is processed.
+  new_handle->poll_user_data_ =
+      reinterpret_cast<intptr_t>(new_handle) | (track_err ? kTrackErrBit : 0);
+  new_handle->poll_events_ = POLLIN | POLLOUT;
+  auto raw_fd = posix_interface().GetFd(fd);
+  if (!raw_fd.ok()) {
+    LOG(ERROR) << "io_uring poll add failed: " << raw_fd.StrError();
+    return new_handle;
+  }
+  new_handle->poll_fd_ = *raw_fd;
+  SubmitPollAdd(new_handle->poll_fd_, new_handle->poll_user_data_,
+                new_handle->poll_events_);
+  return new_handle;
+}
+
+bool IoUringPoller::WaitForCompletions(EventEngine::Duration timeout) {
+  grpc_core::MutexLock lock(&ring_mu_);
+  if (*ring_.cq_head != __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE)) {
+    return true;
+  }
+  auto nanos = std::max<int64_t>(
+      0,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count());
+  struct __kernel_timespec ts;
+  ts.tv_sec = nanos / GPR_NS_PER_SEC;
+  ts.tv_nsec = nanos % GPR_NS_PER_SEC;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.ts = reinterpret_cast<uint64_t>(&ts);
+  int r;
+  do {
+    r = IoUringEnter(ring_.fd, 0, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != ETIME) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  return *ring_.cq_head != __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+}
+
+bool IoUringPoller::ProcessCompletions(Events& pending_events) {
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  bool was_kicked = false;
+  for (int processed = 0; head != tail && processed < MAX_IO_URING_EVENTS;
+       ++head, ++processed) {
+    struct io_uring_cqe* cqe = &ring_.cqes[head & *ring_.cq_mask];
+    uint64_t user_data = cqe->user_data;
+    int32_t res = cqe->res;
+    // Without IORING_CQE_F_MORE, this is the last completion of a multishot
+    // poll request: it was removed, or terminated by the kernel (for instance
+    // because the completion queue overflowed) and must be re-armed.
+    bool terminated = (cqe->flags & IORING_CQE_F_MORE) == 0;
+    if (user_data == kIgnoredUserData) continue;
+    if (user_data & kWakeupBit) {
+      // Skip completions for the poll request of a previous wakeup fd.
+      if ((user_data >> 2) != wakeup_generation_) continue;
+      if (res > 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      if (terminated) ArmWakeupFd();
+      continue;
+    }
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<intptr_t>(user_data & ~kTrackErrBit));
+    if (handle->orphaned_) {
+      if (terminated) {
+        orphaned_handles_.erase(handle);
+        free_io_uring_handles_list_.push_back(handle);
+      }
+      continue;
+    }
+    if (terminated) {
+      SubmitPollAdd(handle->poll_fd_, handle->poll_user_data_,
+                    handle->poll_events_);
+    }
+    if (res == -ECANCELED) continue;
+    bool track_err = (user_data & kTrackErrBit) != 0;
+    uint32_t events = res < 0 ? POLLERR : static_cast<uint32_t>(res);
+    bool cancel = (events & POLLHUP) != 0;
+    bool error = (events & POLLERR) != 0;
+    bool read_ev = (events & (POLLIN | POLLPRI)) != 0;
+    bool write_ev = (events & POLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  // Completion queue space was freed, so the kernel may take the submissions
+  // it refused before.
+  if (!overflow_sqes_.empty() ||
+      *ring_.sq_tail != __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE)) {
+    RetryOverflowSqes();
+  }
+  return was_kicked;
+}
+
+// Waits for completions until timeout is reached or there is a Kick(), and
+// processes every completion that is available in one batch. Unlike epoll1,
+// which processes a single event per call, all the ready handles are handed
+// to the scheduler at once. If there is a Kick() and no handle became ready,
+// it returns Poller::WorkResult::Kicked{}.
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  if (!WaitForCompletions(timeout)) {
+    return Poller::WorkResult::kDeadlineExceeded;
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (ProcessCompletions(pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+    if (pending_events.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  KickLocked();
+}
+
+void IoUringPoller::KickLocked() {
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::HandleForkInChild() {
+  if (grpc_core::IsEventEngineForkEnabled()) {
+    posix_interface().AdvanceGeneration();
+  }
+  grpc_core::MutexLock lock(&mu_);
+  for (EventHandle* handle : fork_handles_set_) {
+    handle->ShutdownHandle(absl::CancelledError("Closed on fork"));
+  }
+  // The ring is shared with the parent process. Tear it down and start over
+  // with a new one; the poll requests of orphaned handles go away with it.
+  // Polling threads are stopped before fork, so nobody waits on the ring.
+  grpc_core::MutexLock ring_lock(&ring_mu_);
+  DestroyRing();
+  for (IoUringEventHandle* handle : orphaned_handles_) {
+    free_io_uring_handles_list_.push_back(handle);
+  }
+  orphaned_handles_.clear();
+  CHECK(InitRing());
+  GRPC_TRACE_LOG(event_engine_poller, INFO) << "Post-fork grpc io_uring fd: "
+                                            << ring_.fd;
+}
+
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() {
+  // Wakeup fd is always recreated to ensure FD state is reset
+  grpc_core::MutexLock lock(&mu_);
+  SubmitPollRemove((wakeup_generation_ << 2) | kWakeupBit);
+  wakeup_fd_ = *CreateWakeupFd(&posix_interface());
+  ++wakeup_generation_;
+  ArmWakeupFd();
+  was_kicked_ = false;
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler,
+                                                 unsigned sq_entries) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(scheduler, sq_entries);
+  }
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_LINUX_IO_URING)
+
+namespace grpc_event_engine::experimental {
+
+// If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+// Return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/,
+                                                 unsigned /*sq_entries*/) {
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // !defined(GRPC_LINUX_IO_URING)
@@ -0,0 +1,195 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+#define MAX_IO_URING_EVENTS 256
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Every registered file descriptor is watched with a single multishot
+// IORING_OP_POLL_ADD request, which gives the same edge-triggered readiness
+// semantics as epoll1 with EPOLLET. Readiness notifications are reaped from
+// the completion queue in batches: a single Work() call drains every
+// completion that is available (up to MAX_IO_URING_EVENTS) with one
+// io_uring_enter() call, instead of handling one event per iteration.
+//
+// Only readiness is delivered through the ring: endpoints still perform their
+// reads and writes with recvmsg/sendmsg once notified, so registered buffers
+// and completion based I/O are not used.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  // Number of submission queue entries of the ring. The poller only submits
+  // poll add/remove requests and flushes them immediately, so this only needs
+  // to be large enough to absorb a burst of submissions that the kernel
+  // momentarily refuses with EBUSY. Submissions that don't fit are kept and
+  // retried once completions have been reaped.
+  static constexpr unsigned kDefaultSqEntries = 256;
+
+  explicit IoUringPoller(Scheduler* scheduler,
+                         unsigned sq_entries = kDefaultSqEntries);
+  EventHandle* CreateHandle(FileDescriptor fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  void Close();
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+  void HandleForkInChild() override;
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  void ResetKickState() override;
+
+ private:
+  friend class IoUringEventHandle;
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 16>;
+
+#ifdef GRPC_LINUX_IO_URING
+  // Memory mapped submission and completion queues of one io_uring instance.
+  struct Ring {
+    int fd = -1;
+    unsigned sq_entries = 0;
+    void* sq_ptr = nullptr;
+    size_t sq_ptr_size = 0;
+    void* cq_ptr = nullptr;
+    size_t cq_ptr_size = 0;
+    struct io_uring_sqe* sqes = nullptr;
+    size_t sqes_size = 0;
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    struct io_uring_cqe* cqes = nullptr;
+  };
+#else
+  struct Ring {};
+#endif
+
+  // Sets up ring_ and arms the wakeup fd. Returns false on failure.
+  bool InitRing() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_, ring_mu_);
+  void DestroyRing() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_, ring_mu_);
+  // Queues a multishot poll request for events on fd tagged with user_data, or
+  // a request to remove the poll request tagged with user_data, and submits it
+  // to the kernel right away.
+  void SubmitPollAdd(int fd, uint64_t user_data, uint32_t events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void SubmitPollRemove(uint64_t user_data) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+#ifdef GRPC_LINUX_IO_URING
+  void SubmitSqe(absl::FunctionRef<void(struct io_uring_sqe*)> fill)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Copies sqe into the submission queue, flushing the queue first if it is
+  // full. Returns false if the kernel doesn't accept submissions right now.
+  bool PushSqe(const struct io_uring_sqe& sqe)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+#endif
+  // Hands the queued submission queue entries to the kernel. Returns false if
+  // some of them could not be submitted yet.
+  bool FlushSubmissions() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Moves overflow_sqes_ into the submission queue as space allows.
+  void RetryOverflowSqes() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void KickLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ArmWakeupFd() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Blocks for at most timeout until at least one completion is available.
+  // Returns false if the deadline was reached without any completion.
+  bool WaitForCompletions(EventEngine::Duration timeout)
+      ABSL_LOCKS_EXCLUDED(ring_mu_);
+  // Reaps all the available completions. Handles that became ready are
+  // appended to pending_events. Returns true if the poller was kicked.
+  bool ProcessCompletions(Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  grpc_core::Mutex mu_;
+  // Held while blocking on the ring for completions, so that the ring can't be
+  // torn down underneath a waiter. Acquired after mu_.
+  grpc_core::Mutex ring_mu_ ABSL_ACQUIRED_AFTER(mu_);
+  Scheduler* scheduler_;
+  const unsigned sq_entries_;
+  // Set up and torn down with both mu_ and ring_mu_ held, so it may be read
+  // with either of them held.
+  Ring ring_;
+#ifdef GRPC_LINUX_IO_URING
+  // Entries that didn't fit into the submission queue, in submission order.
+  std::vector<struct io_uring_sqe> overflow_sqes_ ABSL_GUARDED_BY(mu_);
+#endif
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  // Incremented every time the wakeup fd is re-created so that completions of
+  // the poll request of a stale wakeup fd can be told apart.
+  uint64_t wakeup_generation_ ABSL_GUARDED_BY(mu_) = 0;
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Handles that were orphaned but whose poll request has not been reported
+  // as terminated by the kernel yet. They cannot be re-used until then.
+  absl::flat_hash_set<IoUringEventHandle*> orphaned_handles_
+      ABSL_GUARDED_BY(mu_);
+#if GRPC_ENABLE_FORK_SUPPORT
+  absl::flat_hash_set<EventHandle*> fork_handles_set_ ABSL_GUARDED_BY(mu_);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  bool closed_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified event
+// engine, or nullptr if the running kernel does not provide the io_uring
+// features this poller depends on.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(
+    Scheduler* scheduler,
+    unsigned sq_entries = IoUringPoller::kDefaultSqEntries);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
@@ -20,6 +20,7 @@
 #include "absl/strings/string_view.h"
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/iomgr/port.h"
@@ -40,7 +41,15 @@ std::shared_ptr<PosixEventPoller> MakeDefaultPoller(Scheduler* scheduler) {
       absl::StrSplit(grpc_core::ConfigVars::Get().PollStrategy(), ',');
   for (auto it = strings.begin(); it != strings.end() && poller == nullptr;
        it++) {
-    if (PollStrategyMatches(*it, "epoll1")) {
+    // The io_uring poller is opt-in: it is only used when explicitly
+    // requested, and falls back to epoll1 when the kernel lacks support.
+    if (*it == "io_uring") {
+      poller = MakeIoUringPoller(scheduler);
+      if (poller == nullptr) {
+        poller = MakeEpoll1Poller(scheduler);
+      }
+    }
+    if (poller == nullptr && PollStrategyMatches(*it, "epoll1")) {
       poller = MakeEpoll1Poller(scheduler);
     }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
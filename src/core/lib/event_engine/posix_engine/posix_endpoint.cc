@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -40,6 +41,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -51,6 +53,7 @@
 #include "src/core/util/status_helper.h"
 #include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -62,6 +65,12 @@
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
 #include <netinet/in.h>  // IWYU pragma: keep
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+#include <grpc/slice.h>
+#include <netinet/tcp.h>  // IWYU pragma: keep
+#include <sys/mman.h>     // IWYU pragma: keep
+#include <unistd.h>       // IWYU pragma: keep
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
 
 #ifndef SOL_TCP
 #define SOL_TCP IPPROTO_TCP
@@ -288,6 +297,151 @@ absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
   return src_error;
 }
 
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+// A region of address space mapped on a socket for TCP_ZEROCOPY_RECEIVE. It
+// is the refcount of the slices of the pages mapped into it, and is unmapped
+// once the last of them and the TcpZerocopyReceiveCtx are done with it.
+class ZerocopyReceiveRegion final : public grpc_slice_refcount {
+ public:
+  ZerocopyReceiveRegion(void* address, size_t length,
+                        MemoryAllocator::Reservation reservation)
+      : grpc_slice_refcount(Destroy),
+        address_(address),
+        length_(length),
+        reservation_(std::move(reservation)) {}
+
+  void* address() const { return address_; }
+  size_t length() const { return length_; }
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* region = static_cast<ZerocopyReceiveRegion*>(p);
+    munmap(region->address_, region->length_);
+    delete region;
+  }
+
+  void* const address_;
+  const size_t length_;
+  MemoryAllocator::Reservation reservation_;
+};
+
+void TcpZerocopyReceiveCtx::Disable() {
+  enabled_ = false;
+  ReleaseRegion();
+}
+
+void TcpZerocopyReceiveCtx::ReleaseRegion() {
+  if (region_ == nullptr) return;
+  region_->Unref(DEBUG_LOCATION);
+  region_ = nullptr;
+}
+
+void* TcpZerocopyReceiveCtx::PrepareRegion(int fd, size_t length,
+                                           MemoryAllocator& allocator) {
+  if (region_ != nullptr) {
+    if (region_->IsUnique() && region_->length() >= length) {
+      // The slices of the previous receive are gone: the next receive
+      // replaces their pages. Pairs with their release of the region.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return region_->address();
+    }
+    length = std::max(length, region_->length());
+    ReleaseRegion();
+  }
+  void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  if (address == MAP_FAILED) {
+    VLOG(2) << "Disabling TCP RX zerocopy, mmap failed: "
+            << grpc_core::StrError(errno);
+    Disable();
+    return nullptr;
+  }
+  region_ = new ZerocopyReceiveRegion(address, length,
+                                      allocator.MakeReservation(length));
+  return address;
+}
+
+Slice TcpZerocopyReceiveCtx::OnReceived(size_t mapped) {
+  if (mapped == 0) return Slice();
+  consecutive_misses_ = 0;
+  DCHECK_NE(region_, nullptr);
+  DCHECK_LE(mapped, region_->length());
+  region_->Ref(DEBUG_LOCATION);
+  grpc_slice slice;
+  slice.refcount = region_;
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(region_->address());
+  slice.data.refcounted.length = mapped;
+  return Slice(slice);
+}
+
+void TcpZerocopyReceiveCtx::OnCopied(bool missed) {
+  if (cooldown_reads_ > 0) {
+    if (--cooldown_reads_ == 0 && enabled_) {
+      VLOG(2) << "Resuming TCP RX zerocopy";
+    }
+    return;
+  }
+  if (!missed || ++consecutive_misses_ < kMaxConsecutiveMisses) return;
+  VLOG(2) << "Pausing TCP RX zerocopy after " << consecutive_misses_
+          << " reads had to copy";
+  consecutive_misses_ = 0;
+  cooldown_reads_ = kMissCooldownReads;
+  ReleaseRegion();
+}
+
+size_t PosixEndpointImpl::TcpZerocopyReceive(size_t max_bytes,
+                                             SliceBuffer& buf) {
+  static const size_t kPageSize = sysconf(_SC_PAGESIZE);
+  const size_t length = max_bytes - max_bytes % kPageSize;
+  if (length == 0) return 0;
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  auto fd = posix_interface.GetFd(handle_->WrappedFd());
+  if (!fd.ok()) return 0;
+  void* region =
+      tcp_zerocopy_receive_ctx_->PrepareRegion(*fd, length, memory_owner_);
+  if (region == nullptr) return 0;
+  struct tcp_zerocopy_receive zc;
+  memset(&zc, 0, sizeof(zc));
+  zc.address = reinterpret_cast<uint64_t>(region);
+  zc.length = static_cast<uint32_t>(length);
+  socklen_t zc_len = sizeof(zc);
+  PosixError result;
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    result = posix_interface.GetSockOpt(handle_->WrappedFd(), IPPROTO_TCP,
+                                        TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (result.IsPosixError(EINTR));
+  if (!result.ok() && !result.IsPosixError(EAGAIN)) {
+    VLOG(2) << "Disabling TCP RX zerocopy: " << result.StrError();
+    tcp_zerocopy_receive_ctx_->Disable();
+    return 0;
+  }
+  Slice mapped =
+      tcp_zerocopy_receive_ctx_->OnReceived(result.ok() ? zc.length : 0);
+  const size_t mapped_bytes = mapped.length();
+  if (mapped_bytes > 0) buf.Append(std::move(mapped));
+  return mapped_bytes;
+}
+#else   // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+void TcpZerocopyReceiveCtx::Disable() { enabled_ = false; }
+
+void TcpZerocopyReceiveCtx::ReleaseRegion() {}
+
+void* TcpZerocopyReceiveCtx::PrepareRegion(int /*fd*/, size_t /*length*/,
+                                           MemoryAllocator& /*allocator*/) {
+  Disable();
+  return nullptr;
+}
+
+Slice TcpZerocopyReceiveCtx::OnReceived(size_t /*mapped*/) { return Slice(); }
+
+void TcpZerocopyReceiveCtx::OnCopied(bool /*missed*/) {}
+
+size_t PosixEndpointImpl::TcpZerocopyReceive(size_t /*max_bytes*/,
+                                             SliceBuffer& /*buf*/) {
+  return 0;
+}
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
 // Returns true if data available to read or error other than EAGAIN.
 bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("TcpDoRead");
@@ -313,6 +467,45 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   CHECK_NE(incoming_buffer_->Length(), 0u);
   DCHECK_GT(min_progress_size_, 0);
 
+  bool zerocopy_missed = false;
+  if (tcp_zerocopy_receive_ctx_->enabled() &&
+      incoming_buffer_->Length() >=
+          tcp_zerocopy_receive_ctx_->threshold_bytes()) {
+    SliceBuffer mapped;
+    const size_t mapped_bytes =
+        TcpZerocopyReceive(incoming_buffer_->Length(), mapped);
+    if (mapped_bytes > 0) {
+      grpc_core::global_stats().IncrementTcpReadSize(mapped_bytes);
+      AddToEstimate(mapped_bytes);
+      status = absl::OkStatus();
+      if (!grpc_core::IsTcpFrameSizeTuningEnabled()) {
+        // The mapped slices replace the read slices, which are kept for the
+        // next read. The socket was not drained, so the next read must not
+        // wait for an edge.
+        incoming_buffer_->MoveFirstNBytesIntoSliceBuffer(
+            incoming_buffer_->Length(), last_read_buffer_);
+        mapped.MoveFirstNBytesIntoSliceBuffer(mapped_bytes, *incoming_buffer_);
+        TrimSpareReadSlices();
+        inq_ = 1;
+        return true;
+      }
+      // Stage the mapped bytes like any other bytes read in this round. If
+      // that is not enough to make progress, copy what follows them, most
+      // notably the unaligned tail the kernel could not map.
+      mapped.MoveFirstNBytesIntoSliceBuffer(mapped_bytes, last_read_buffer_);
+      min_progress_size_ -= static_cast<int>(mapped_bytes);
+      if (min_progress_size_ <= 0) {
+        min_progress_size_ = 1;
+        incoming_buffer_->Swap(last_read_buffer_);
+        TrimSpareReadSlices();
+        inq_ = 1;
+        return true;
+      }
+    } else {
+      zerocopy_missed = true;
+    }
+  }
+
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
@@ -362,6 +555,9 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     if (read_bytes <= 0) {
       // 0 read size ==> end of stream
       incoming_buffer_->Clear();
+      // Partially read bytes are of no use anymore. They may also be read-only
+      // zerocopy mappings which must not be reused as read space.
+      last_read_buffer_.Clear();
       if (res.IsWrongGenerationError()) {
         status = absl::CancelledError("Closed on fork");
         grpc_core::StatusSetInt(&status,
@@ -431,6 +627,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   }
 
   DCHECK_GT(total_read_bytes, 0u);
+  tcp_zerocopy_receive_ctx_->OnCopied(zerocopy_missed);
   status = absl::OkStatus();
   if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
     // Update min progress size based on the total number of bytes read in
@@ -455,6 +652,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
       incoming_buffer_->MoveFirstNBytesIntoSliceBuffer(total_read_bytes,
                                                        last_read_buffer_);
       incoming_buffer_->Swap(last_read_buffer_);
+      TrimSpareReadSlices();
       return true;
     }
   }
@@ -462,6 +660,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     incoming_buffer_->MoveLastNBytesIntoSliceBuffer(
         incoming_buffer_->Length() - total_read_bytes, last_read_buffer_);
   }
+  TrimSpareReadSlices();
   return true;
 }
 
@@ -532,38 +731,72 @@ void PosixEndpointImpl::UpdateRcvLowat() {
   }
 }
 
+size_t PosixEndpointImpl::ReadSizeHint() const {
+  size_t read_size = std::max<size_t>(min_progress_size_, 1);
+  // Only read ahead of what the upper layer asked for if memory pressure is
+  // low.
+  if (memory_owner_.GetPressureInfo().pressure_control_value >= 0.8) {
+    return read_size;
+  }
+  // The decayed history of the sizes of previous reads predicts the size of
+  // the next one. The amount of data the kernel reported as still queued
+  // after the last read (TCP_INQ) is a lower bound for it.
+  double predicted = target_length_;
+  if (inq_capable_ && inq_ > 1) {
+    predicted = std::max(predicted, static_cast<double>(inq_));
+  }
+  predicted = grpc_core::Clamp(predicted,
+                               static_cast<double>(min_read_chunk_size_),
+                               static_cast<double>(max_read_chunk_size_));
+  return std::max(read_size, static_cast<size_t>(predicted));
+}
+
 void PosixEndpointImpl::MaybeMakeReadSlices() {
-  static const int kBigAlloc = 64 * 1024;
-  static const int kSmallAlloc = 8 * 1024;
-  if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
-    size_t allocate_length = min_progress_size_;
-    const size_t target_length = static_cast<size_t>(target_length_);
-    // If memory pressure is low and we think there will be more than
-    // min_progress_size bytes to read, allocate a bit more.
-    const bool low_memory_pressure =
-        memory_owner_.GetPressureInfo().pressure_control_value < 0.8;
-    if (low_memory_pressure && target_length > allocate_length) {
-      allocate_length = target_length;
-    }
-    int extra_wanted = std::max<int>(
-        1, allocate_length - static_cast<int>(incoming_buffer_->Length()));
-    if (extra_wanted >=
-        (low_memory_pressure ? kSmallAlloc * 3 / 2 : kBigAlloc)) {
-      while (extra_wanted > 0) {
-        extra_wanted -= kBigAlloc;
-        incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kBigAlloc)));
-        grpc_core::global_stats().IncrementTcpReadAlloc64k();
-      }
-    } else {
-      while (extra_wanted > 0) {
-        extra_wanted -= kSmallAlloc;
-        incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kSmallAlloc)));
-        grpc_core::global_stats().IncrementTcpReadAlloc8k();
-      }
-    }
-    MaybePostReclaimer();
+  static const size_t kBigAlloc = 64 * 1024;
+  static const size_t kSmallAlloc = 8 * 1024;
+  const size_t read_size = ReadSizeHint();
+  if (incoming_buffer_->Length() >= read_size) return;
+  // Fill with big slices while at least most of one is needed, and round up
+  // the remainder with small slices, so that at most one small slice worth of
+  // space is allocated beyond what is needed.
+  size_t extra_wanted = read_size - incoming_buffer_->Length();
+  size_t allocated = 0;
+  while (extra_wanted > kBigAlloc - kSmallAlloc) {
+    Slice slice(memory_owner_.MakeSlice(kBigAlloc));
+    allocated += slice.length();
+    incoming_buffer_->AppendIndexed(std::move(slice));
+    grpc_core::global_stats().IncrementTcpReadAlloc64k();
+    extra_wanted -= std::min(extra_wanted, kBigAlloc);
+  }
+  while (extra_wanted > 0) {
+    Slice slice(memory_owner_.MakeSlice(kSmallAlloc));
+    allocated += slice.length();
+    incoming_buffer_->AppendIndexed(std::move(slice));
+    grpc_core::global_stats().IncrementTcpReadAlloc8k();
+    extra_wanted -= std::min(extra_wanted, kSmallAlloc);
+  }
+  grpc_core::global_stats().IncrementTcpReadAllocSize(
+      static_cast<int>(std::min<size_t>(allocated, INT_MAX)));
+  MaybePostReclaimer();
+}
+
+void PosixEndpointImpl::TrimSpareReadSlices() {
+  const size_t spare = last_read_buffer_.Length();
+  grpc_core::global_stats().IncrementTcpReadUnusedSize(
+      static_cast<int>(std::min<size_t>(spare, INT_MAX)));
+  // Keep about as much space as the next read is predicted to need, so that
+  // idle and low traffic connections do not hold on to large buffers after a
+  // burst.
+  const size_t keep = static_cast<size_t>(
+      std::max<double>(target_length_, min_read_chunk_size_));
+  if (spare > keep) TrimTrailingSlices(last_read_buffer_, keep);
+}
+
+void TrimTrailingSlices(SliceBuffer& buf, size_t keep) {
+  while (buf.Count() > 0) {
+    const size_t last = buf[buf.Count() - 1].length();
+    if (buf.Length() - last < keep) return;
+    buf.RemoveLastNBytes(last);
   }
 }
 
@@ -653,7 +886,7 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
       // Read failed immediately. Schedule the on_read callback to run
       // asynchronously.
       lock.Release();
-      engine_->Run([on_read = std::move(on_read), status, this]() mutable {
+      RunCallback([on_read = std::move(on_read), status, this]() mutable {
         GRPC_TRACE_LOG(event_engine_endpoint, INFO)
             << "Endpoint[" << this << "]: Read failed immediately: " << status;
         on_read(status);
@@ -1184,6 +1417,103 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
   }
 }
 
+namespace {
+
+// Only writes of at most this many bytes are batched: larger writes amortize
+// their syscall well enough on their own.
+constexpr size_t kMaxBatchedWriteBytes = 16 * 1024;
+// Flush the batch early once this many writes joined it.
+constexpr size_t kMaxBatchedWrites = 64;
+
+// The endpoints whose write was deferred to the end of the closure batch
+// running on this thread.
+thread_local std::vector<PosixEndpointImpl*> g_batched_writes;
+// The time by which the oldest deferred write must be flushed.
+thread_local std::chrono::steady_clock::time_point g_batched_writes_deadline;
+// Whether flushing g_batched_writes is scheduled at the end of the batch.
+thread_local bool g_batched_writes_flush_scheduled = false;
+
+}  // namespace
+
+bool PosixEndpointImpl::MaybeDeferWrite() {
+  if (write_batch_max_delay_ == std::chrono::steady_clock::duration::zero() ||
+      outgoing_buffer_->Length() > kMaxBatchedWriteBytes) {
+    return false;
+  }
+  if (!g_batched_writes_flush_scheduled) {
+    // Only thread pool threads end their closure batches.
+    if (!ThreadLocal::RunAtEndOfClosureBatch([]() {
+          g_batched_writes_flush_scheduled = false;
+          FlushBatchedWrites(/*run_cb_inline=*/true);
+        })) {
+      return false;
+    }
+    g_batched_writes_flush_scheduled = true;
+  }
+  auto now = std::chrono::steady_clock::now();
+  if (!g_batched_writes.empty() &&
+      (now >= g_batched_writes_deadline ||
+       g_batched_writes.size() >= kMaxBatchedWrites)) {
+    // A long batch must not hold back the writes that joined it early. The
+    // caller is in the middle of a write, so the callbacks must not run
+    // inline.
+    FlushBatchedWrites(/*run_cb_inline=*/false);
+  }
+  if (g_batched_writes.empty() ||
+      now + write_batch_max_delay_ < g_batched_writes_deadline) {
+    g_batched_writes_deadline = now + write_batch_max_delay_;
+  }
+  // The batch may not wait for this thread to run out of closures for longer
+  // than the delay.
+  ThreadLocal::EndClosureBatchBy(g_batched_writes_deadline);
+  // The batch holds its own ref: MaybeShutdown() may complete the write before
+  // the batch is flushed.
+  Ref().release();
+  g_batched_writes.push_back(this);
+  return true;
+}
+
+void PosixEndpointImpl::FlushBatchedWrites(bool run_cb_inline) {
+  std::vector<PosixEndpointImpl*> endpoints;
+  endpoints.swap(g_batched_writes);
+  for (PosixEndpointImpl* endpoint : endpoints) {
+    if (endpoint->write_deferred_.exchange(false, std::memory_order_acq_rel)) {
+      endpoint->FlushBatchedWrite(run_cb_inline);
+    }
+    endpoint->Unref();
+  }
+}
+
+void PosixEndpointImpl::FlushBatchedWrite(bool run_cb_inline) {
+  absl::Status status = absl::OkStatus();
+  if (!TcpFlush(status)) {
+    // The socket is full: HandleWrite() finishes the write once it is
+    // writable again.
+    DCHECK(status.ok());
+    handle_->NotifyOnWrite(on_write_);
+    return;
+  }
+  GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+      << "Endpoint[" << this << "]: Batched write complete: " << status;
+  absl::AnyInvocable<void(absl::Status)> cb = std::move(write_cb_);
+  write_cb_ = nullptr;
+  if (run_cb_inline) {
+    cb(status);
+  } else {
+    RunCallback([cb = std::move(cb), status]() mutable { cb(status); });
+  }
+  Unref();
+}
+
+void PosixEndpointImpl::RunCallback(absl::AnyInvocable<void()> cb) {
+  if (run_priority_ != nullptr) {
+    run_priority_->RunWithPriority(RunPriority::kLatencySensitive,
+                                   std::move(cb));
+  } else {
+    engine_->Run(std::move(cb));
+  }
+}
+
 bool PosixEndpointImpl::Write(
     absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data,
     EventEngine::Endpoint::WriteArgs args) {
@@ -1202,7 +1532,7 @@ bool PosixEndpointImpl::Write(
         << "Endpoint[" << this << "]: Write skipped";
     if (handle_->IsHandleShutdown()) {
       status = TcpAnnotateError(absl::InternalError("EOF"));
-      engine_->Run(
+      RunCallback(
           [on_writable = std::move(on_writable), status, this]() mutable {
             GRPC_TRACE_LOG(event_engine_endpoint, INFO)
                 << "Endpoint[" << this << "]: Write failed: " << status;
@@ -1221,6 +1551,18 @@ bool PosixEndpointImpl::Write(
   }
   if (args.has_metrics_sink() && poller_->CanTrackErrors()) {
     outgoing_buffer_write_event_sink_ = args.TakeMetricsSink();
+  } else if (write_latency_sampler_ != nullptr && ts_capable_ &&
+             poller_->CanTrackErrors()) {
+    outgoing_buffer_write_event_sink_ = write_latency_sampler_->MaybeSample();
+  }
+
+  if (zerocopy_send_record == nullptr && MaybeDeferWrite()) {
+    GRPC_TRACE_LOG(event_engine_endpoint, INFO)
+        << "Endpoint[" << this << "]: Write deferred to the end of the batch";
+    Ref().release();
+    write_cb_ = std::move(on_writable);
+    write_deferred_.store(true, std::memory_order_release);
+    return false;
   }
 
   bool flush_result = zerocopy_send_record != nullptr
@@ -1236,7 +1578,7 @@ bool PosixEndpointImpl::Write(
   if (!status.ok()) {
     // Write failed immediately. Schedule the on_writable callback to run
     // asynchronously.
-    engine_->Run(
+    RunCallback(
         [on_writable = std::move(on_writable), status, this]() mutable {
           GRPC_TRACE_LOG(event_engine_endpoint, INFO)
               << "Endpoint[" << this << "]: Write failed: " << status;
@@ -1254,6 +1596,12 @@ bool PosixEndpointImpl::Write(
 void PosixEndpointImpl::MaybeShutdown(
     absl::Status why,
     absl::AnyInvocable<void(absl::StatusOr<int>)> on_release_fd) {
+  if (write_deferred_.exchange(false, std::memory_order_acq_rel)) {
+    // Send a write still waiting for the end of a closure batch, possibly on
+    // another thread, before the socket is shut down. The caller may be
+    // destroying the endpoint, so the callback must not run inline.
+    FlushBatchedWrite(/*run_cb_inline=*/false);
+  }
   if (poller_->CanTrackErrors()) {
     ZerocopyDisableAndWaitForRemaining();
     stop_error_notification_.store(true, std::memory_order_release);
@@ -1291,7 +1639,12 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
       traced_buffers_(),
       handle_(handle),
       poller_(handle->Poller()),
-      engine_(engine) {
+      engine_(engine),
+      run_priority_(
+          grpc_core::IsEventEnginePrioritizeIoCallbacksEnabled()
+              ? QueryExtension<EventEngineSupportsRunPriorityExtension>(
+                    engine.get())
+              : nullptr) {
   FileDescriptor fd = handle_->WrappedFd();
   CHECK(options.resource_quota != nullptr);
   auto& posix_interface = poller_->posix_interface();
@@ -1352,6 +1705,20 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #else
   inq_capable_ = false;
 #endif  // GRPC_HAVE_TCP_INQ
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  const bool rx_zerocopy_enabled = options.tcp_rx_zero_copy_enabled;
+#else
+  const bool rx_zerocopy_enabled = false;
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+  tcp_zerocopy_receive_ctx_ = std::make_unique<TcpZerocopyReceiveCtx>(
+      rx_zerocopy_enabled, options.tcp_rx_zerocopy_receive_bytes_threshold);
+  write_batch_max_delay_ =
+      std::chrono::microseconds(options.tcp_write_batch_max_delay_us);
+  if (options.tcp_write_timestamp_sample_interval > 0 &&
+      poller_->CanTrackErrors()) {
+    write_latency_sampler_ = grpc_core::MakeRefCounted<WriteLatencySampler>(
+        options.tcp_write_timestamp_sample_interval);
+  }
 
   on_read_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleRead(std::move(status)); });
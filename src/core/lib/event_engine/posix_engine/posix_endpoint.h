@@ -25,6 +25,7 @@
 #include <grpc/support/alloc.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -41,10 +42,12 @@
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
+#include "src/core/lib/event_engine/posix_engine/write_latency_sampler.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -459,6 +462,72 @@ class TcpZerocopySendCtx {
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
 };
 
+class ZerocopyReceiveRegion;
+
+// Keeps the address space that TCP_ZEROCOPY_RECEIVE maps received pages into.
+// The region is mapped once and reused by every receive, unless slices of the
+// previous receive still reference its pages, in which case a new region is
+// mapped and the old one is unmapped once those slices are released. Regions
+// are charged to the endpoint's memory allocator for as long as they are
+// mapped.
+// Receiving stops being attempted for good when mapping a region fails. It is
+// paused for kMissCooldownReads reads after kMaxConsecutiveMisses reads in a
+// row had to copy data that the receive attempted before them did not map:
+// the payload of that connection is then not page aligned, e.g. because the
+// NIC does not split headers from payload, and every attempt would only add
+// syscalls. Receives that find nothing to read are not misses.
+// Not thread safe: only used under the read lock of the endpoint.
+class TcpZerocopyReceiveCtx {
+ public:
+  static constexpr int kMaxConsecutiveMisses = 8;
+  static constexpr int kMissCooldownReads = 1024;
+
+  TcpZerocopyReceiveCtx(bool enabled, size_t threshold_bytes)
+      : enabled_(enabled), threshold_bytes_(threshold_bytes) {}
+  ~TcpZerocopyReceiveCtx() { ReleaseRegion(); }
+
+  TcpZerocopyReceiveCtx(const TcpZerocopyReceiveCtx&) = delete;
+  TcpZerocopyReceiveCtx& operator=(const TcpZerocopyReceiveCtx&) = delete;
+
+  bool enabled() const { return enabled_ && cooldown_reads_ == 0; }
+  size_t threshold_bytes() const { return threshold_bytes_; }
+
+  // Stops attempting zerocopy receives, and unmaps the region once no slice
+  // references it anymore.
+  void Disable();
+
+  // Returns the address of a region of at least length bytes mapped on fd,
+  // reserving it from allocator if it has to be mapped. Returns nullptr, and
+  // disables zerocopy receives, if the region could not be mapped.
+  void* PrepareRegion(int fd, size_t length, MemoryAllocator& allocator);
+
+  // Records that a receive mapped the first mapped bytes of the region last
+  // returned by PrepareRegion, and returns a slice referencing them. Returns
+  // an empty slice if nothing was mapped.
+  Slice OnReceived(size_t mapped);
+
+  // Records that a read copied data out of the socket. missed tells whether
+  // a receive was attempted right before it and mapped nothing.
+  void OnCopied(bool missed);
+
+ private:
+  void ReleaseRegion();
+
+  bool enabled_;
+  size_t threshold_bytes_;
+  int consecutive_misses_ = 0;
+  // Reads left to copy before receiving is attempted again.
+  int cooldown_reads_ = 0;
+  // Holds one reference to the region, slices of its pages hold the others.
+  ZerocopyReceiveRegion* region_ = nullptr;
+};
+
+// Releases slices from the end of buf for as long as at least keep bytes are
+// left. Only whole slices are released: the memory of a slice stays allocated
+// for as long as any part of it is referenced, so trimming part of one frees
+// nothing.
+void TrimTrailingSlices(SliceBuffer& buf, size_t keep);
+
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
  public:
   PosixEndpointImpl(
@@ -488,6 +557,11 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  const grpc_core::RefCountedPtr<WriteLatencySampler>& write_latency_sampler()
+      const {
+    return write_latency_sampler_;
+  }
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -499,8 +573,19 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   void HandleRead(absl::Status status) ABSL_NO_THREAD_SAFETY_ANALYSIS;
   bool HandleReadLocked(absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Returns the number of bytes of read space the next read should offer.
+  size_t ReadSizeHint() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Releases the spare read space left over by a completed read beyond what
+  // the next read is predicted to need.
+  void TrimSpareReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Maps up to max_bytes of the data queued on the socket into read-only
+  // slices appended to buf with TCP_ZEROCOPY_RECEIVE. Only whole pages are
+  // mapped, the unaligned remainder has to be read with recvmsg. Returns the
+  // number of bytes mapped.
+  size_t TcpZerocopyReceive(size_t max_bytes, SliceBuffer& buf)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -511,6 +596,21 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool DoFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlushZerocopy(TcpZerocopySendRecord* record, absl::Status& status);
   bool TcpFlush(absl::Status& status);
+  // Defers flushing outgoing_buffer_ to the end of the current closure batch
+  // of this thread, so that the transport can coalesce more data into the next
+  // write in the meantime. Returns false if the write should be flushed right
+  // away instead.
+  bool MaybeDeferWrite();
+  // Flushes a write deferred by MaybeDeferWrite() and completes it, or waits
+  // for the socket to become writable. The write callback runs on the engine
+  // unless run_cb_inline is true.
+  void FlushBatchedWrite(bool run_cb_inline);
+  // Flushes all the writes deferred on this thread. Their callbacks run on
+  // the engine unless run_cb_inline is true.
+  static void FlushBatchedWrites(bool run_cb_inline);
+  // Runs a read or write callback on the engine, ahead of its default
+  // closures if run_priority_ is set.
+  void RunCallback(absl::AnyInvocable<void()> cb);
   void TcpShutdownTracedBufferList();
   void UnrefMaybePutZerocopySendRecord(TcpZerocopySendRecord* record);
   void ZerocopyDisableAndWaitForRemaining();
@@ -543,10 +643,18 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // Maps the payload of large reads with TCP_ZEROCOPY_RECEIVE, if enabled.
+  std::unique_ptr<TcpZerocopyReceiveCtx> tcp_zerocopy_receive_ctx_;
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
   size_t outgoing_byte_idx_ = 0;
+  // How long a small write may be deferred to batch it with the writes of
+  // other endpoints. Zero disables write batching.
+  std::chrono::steady_clock::duration write_batch_max_delay_{};
+  // Set while a write waits in the batch of some thread. Whoever resets it,
+  // the batch or MaybeShutdown(), flushes the write.
+  std::atomic<bool> write_deferred_{false};
 
   PosixEngineClosure* on_read_ = nullptr;
   PosixEngineClosure* on_write_ = nullptr;
@@ -588,10 +696,16 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
   TracedBufferList traced_buffers_;
+  // Timestamps a sample of the writes that carry no write event sink. Null
+  // unless GRPC_ARG_TCP_WRITE_TIMESTAMP_SAMPLE_INTERVAL is set.
+  grpc_core::RefCountedPtr<WriteLatencySampler> write_latency_sampler_;
   // The handle is owned by the PosixEndpointImpl object.
   EventHandle* handle_;
   PosixEventPoller* poller_;
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  // The priority extension of engine_, if it has one and the
+  // event_engine_prioritize_io_callbacks experiment is on.
+  EventEngineSupportsRunPriorityExtension* run_priority_ = nullptr;
 };
 
 class PosixEndpoint : public PosixEndpointWithFdSupport {
@@ -602,7 +716,8 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
       grpc_event_engine::experimental::MemoryAllocator&& allocator,
       const PosixTcpOptions& options)
       : impl_(new PosixEndpointImpl(handle, on_shutdown, std::move(engine),
-                                    std::move(allocator), options)) {}
+                                    std::move(allocator), options)),
+        write_latency_sampler_(impl_->write_latency_sampler()) {}
 
   bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
             grpc_event_engine::experimental::SliceBuffer* buffer,
@@ -634,6 +749,11 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  void AddJson(grpc_core::channelz::DataSink& sink) override {
+    if (write_latency_sampler_ == nullptr) return;
+    sink.AddData("write_latency", write_latency_sampler_->ChannelzProperties());
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
@@ -643,6 +763,7 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
   }
 
   ~PosixEndpoint() override {
+    ShutdownChannelzExtension();
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
       impl_->MaybeShutdown(absl::FailedPreconditionError("Endpoint closing"),
                            nullptr);
@@ -651,6 +772,8 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
  private:
   PosixEndpointImpl* impl_;
+  // Shared with impl_, which may be destroyed first.
+  grpc_core::RefCountedPtr<WriteLatencySampler> write_latency_sampler_;
   std::atomic<bool> shutdown_{false};
 };
 
@@ -696,6 +819,10 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
         "PosixEndpoint::CanTrackErrors not supported on this platform");
   }
 
+  void AddJson(grpc_core::channelz::DataSink& /*sink*/) override {
+    grpc_core::Crash("PosixEndpoint::AddJson not supported on this platform");
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     grpc_core::Crash("PosixEndpoint::Shutdown not supported on this platform");
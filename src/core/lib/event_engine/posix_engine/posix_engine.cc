@@ -52,12 +52,15 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/fork.h"
+#include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
 #include "src/core/util/useful.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #include <errno.h>       // IWYU pragma: keep
 #include <pthread.h>     // IWYU pragma: keep
+#include <sched.h>       // IWYU pragma: keep
 #include <stdint.h>      // IWYU pragma: keep
 #include <sys/socket.h>  // IWYU pragma: keep
 #include <unistd.h>      // IWYU pragma: keep
@@ -497,7 +500,12 @@ PosixEnginePollerManager::PosixEnginePollerManager(
 
 void PosixEnginePollerManager::Run(
     experimental::EventEngine::Closure* closure) {
-  if (executor_ != nullptr) {
+  if (executor_ == nullptr) return;
+  // These are the fd readiness closures, which run the read and write
+  // callbacks of endpoints.
+  if (grpc_core::IsEventEnginePrioritizeIoCallbacksEnabled()) {
+    executor_->RunWithPriority(RunPriority::kLatencySensitive, closure);
+  } else {
     executor_->Run(closure);
   }
 }
@@ -508,6 +516,113 @@ void PosixEnginePollerManager::Run(absl::AnyInvocable<void()> cb) {
   }
 }
 
+namespace {
+thread_local PosixEnginePollerShard* g_current_shard = nullptr;
+}  // namespace
+
+PosixEnginePollerShard::PosixEnginePollerShard(
+    std::shared_ptr<ThreadPool> executor)
+    : executor_(std::move(executor)),
+      poller_(grpc_event_engine::experimental::MakeDefaultPoller(this)) {}
+
+std::shared_ptr<PosixEnginePollerShard> PosixEnginePollerShard::Create(
+    int cpu, std::shared_ptr<ThreadPool> executor) {
+  // Can't use make_shared as ctor is private
+  std::shared_ptr<PosixEnginePollerShard> shard(
+      new PosixEnginePollerShard(std::move(executor)));
+  if (shard->poller_ == nullptr) return nullptr;
+  // Detached, as the last ref to the engine, and so the shard, may be dropped
+  // on the shard thread, which can't join itself.
+  grpc_core::Thread(
+      "posix_poller_shard",
+      [shard, cpu]() { shard->PollLoop(cpu); }, nullptr,
+      grpc_core::Thread::Options().set_joinable(false))
+      .Start();
+  return shard;
+}
+
+void PosixEnginePollerShard::Shutdown() {
+  done_.store(true, std::memory_order_release);
+  if (g_current_shard == this) return;
+  poller_->Kick();
+  exited_.WaitForNotification();
+}
+
+void PosixEnginePollerShard::PollLoop(int cpu) {
+#ifdef GPR_LINUX
+  // Pin the thread to the cpu-th CPU the process is allowed to run on.
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0 &&
+      CPU_COUNT(&allowed) > 0) {
+    cpu %= CPU_COUNT(&allowed);
+    for (int i = 0; i < CPU_SETSIZE; ++i) {
+      if (!CPU_ISSET(i, &allowed) || cpu-- > 0) continue;
+      cpu_set_t pinned;
+      CPU_ZERO(&pinned);
+      CPU_SET(i, &pinned);
+      int err = pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned);
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "Poller shard " << this << " pinned to cpu " << i << ": "
+          << (err == 0 ? "ok" : grpc_core::StrError(err));
+      break;
+    }
+  }
+#else
+  (void)cpu;
+#endif  // GPR_LINUX
+  g_current_shard = this;
+  while (!done_.load(std::memory_order_acquire)) {
+    if (RunClosures()) continue;
+    // The thread polls again right away, so there is no need for the poller
+    // to ask for another polling thread.
+    poller_->Work(24h, []() {});
+  }
+  // Closures queued before shutdown still have to run, e.g. the ones that
+  // report the shutdown of handles. Later ones go to the executor.
+  while (RunClosures(/*stop=*/true)) {
+  }
+  g_current_shard = nullptr;
+  exited_.Notify();
+}
+
+bool PosixEnginePollerShard::RunClosures(bool stop) {
+  std::vector<absl::AnyInvocable<void()>> closures;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    closures.swap(closures_);
+    if (stop && closures.empty()) stopped_ = true;
+  }
+  for (auto& closure : closures) closure();
+  return !closures.empty();
+}
+
+PosixEnginePollerShard* PosixEnginePollerShard::Current() {
+  return g_current_shard;
+}
+
+void PosixEnginePollerShard::Run(experimental::EventEngine::Closure* closure) {
+  Run([closure]() { closure->Run(); });
+}
+
+void PosixEnginePollerShard::Run(absl::AnyInvocable<void()> cb) {
+  bool queued = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (!stopped_) {
+      closures_.push_back(std::move(cb));
+      queued = true;
+    }
+  }
+  if (!queued) {
+    // The shard thread has exited.
+    executor_->Run(std::move(cb));
+    return;
+  }
+  // The shard thread runs the queue before it polls again.
+  if (g_current_shard != this) poller_->Kick();
+}
+
 std::shared_ptr<PosixEventEngine> PosixEventEngine::MakePosixEventEngine() {
   // Can't use make_shared as ctor is private
   std::shared_ptr<PosixEventEngine> engine(new PosixEventEngine());
@@ -580,6 +695,14 @@ PosixEventEngine::~PosixEventEngine() {
   }
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   polling_cycle_.reset();
+  {
+    std::vector<std::shared_ptr<PosixEnginePollerShard>> shards;
+    {
+      grpc_core::MutexLock lock(&poller_shards_mu_);
+      shards.swap(poller_shards_);
+    }
+    for (auto& shard : shards) shard->Shutdown();
+  }
 #endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
   timer_manager_->Shutdown();
   executor_->Quiesce();
@@ -613,8 +736,28 @@ void PosixEventEngine::Run(EventEngine::Closure* closure) {
   executor_->Run(closure);
 }
 
+void PosixEventEngine::RunWithPriority(RunPriority priority,
+                                       EventEngine::Closure* closure) {
+  executor_->RunWithPriority(priority, closure);
+}
+
+void PosixEventEngine::RunWithPriority(RunPriority priority,
+                                       absl::AnyInvocable<void()> closure) {
+  executor_->RunWithPriority(priority, std::move(closure));
+}
+
 EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
     Duration when, absl::AnyInvocable<void()> cb) {
+#ifdef GRPC_POSIX_SOCKET_TCP
+  // Timers armed on a poller shard fire on that shard.
+  if (auto* shard = PosixEnginePollerShard::Current(); shard != nullptr) {
+    if (when <= Duration::zero()) {
+      shard->Run(std::move(cb));
+      return TaskHandle::kInvalid;
+    }
+    cb = [shard, cb = std::move(cb)]() mutable { shard->Run(std::move(cb)); };
+  }
+#endif  // GRPC_POSIX_SOCKET_TCP
   if (when <= Duration::zero()) {
     Run(std::move(cb));
     return TaskHandle::kInvalid;
@@ -853,7 +996,9 @@ PosixEventEngine::CreateListener(
   return std::make_unique<PosixEngineListener>(
       std::move(posix_on_accept), std::move(on_shutdown), config,
       std::move(memory_allocator_factory), poller_manager_.Poller(),
-      shared_from_this());
+      shared_from_this(),
+      GetPollerShards(
+          TcpOptionsFromEndpointConfig(config).listener_shard_count));
 }
 
 absl::StatusOr<std::unique_ptr<EventEngine::Listener>>
@@ -865,7 +1010,39 @@ PosixEventEngine::CreatePosixListener(
   return std::make_unique<PosixEngineListener>(
       std::move(on_accept), std::move(on_shutdown), config,
       std::move(memory_allocator_factory), poller_manager_.Poller(),
-      shared_from_this());
+      shared_from_this(),
+      GetPollerShards(
+          TcpOptionsFromEndpointConfig(config).listener_shard_count));
+}
+
+std::vector<PosixEventPoller*> PosixEventEngine::GetPollerShards(int count) {
+  std::vector<PosixEventPoller*> pollers;
+  if (count <= 1) return pollers;
+  // Shard threads are not stopped and restarted around fork.
+  if (grpc_core::Fork::Enabled()) {
+    LOG_FIRST_N(INFO, 1) << "Not sharding listeners across " << count
+                         << " pollers since fork support is enabled";
+    return pollers;
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    // Engines that do not drive their own poller do not shard either.
+    if (!polling_cycle_.has_value()) return pollers;
+  }
+  const size_t num_shards =
+      std::min<size_t>(count, std::max(gpr_cpu_num_cores(), 1u));
+  grpc_core::MutexLock lock(&poller_shards_mu_);
+  while (poller_shards_.size() < num_shards) {
+    auto shard = PosixEnginePollerShard::Create(
+        static_cast<int>(poller_shards_.size()), executor_);
+    if (shard == nullptr) break;
+    poller_shards_.push_back(std::move(shard));
+  }
+  if (poller_shards_.size() < 2) return pollers;
+  for (size_t i = 0; i < std::min(num_shards, poller_shards_.size()); ++i) {
+    pollers.push_back(poller_shards_[i]->Poller());
+  }
+  return pollers;
 }
 
 void PosixEventEngine::SchedulePoller() {
@@ -40,8 +40,10 @@
 #include "src/core/lib/event_engine/ref_counted_dns_resolver_interface.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/iomgr/port.h"
+#include "src/core/util/notification.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
@@ -116,6 +118,55 @@ class PosixEnginePollerManager
   std::shared_ptr<ThreadPool> executor_;
 };
 
+// A poller driven by a dedicated thread, pinned to one CPU where the platform
+// allows it. Listeners created with GRPC_ARG_TCP_LISTENER_SHARD_COUNT spread
+// their sockets and accepted connections across a set of these, so that
+// readiness notifications are not all funneled through the single shared
+// poller. The closures the poller schedules, and timers armed from the shard
+// thread, run on the shard thread between two polls.
+// The shard thread holds a ref to its shard until it exits.
+class PosixEnginePollerShard final
+    : public grpc_event_engine::experimental::Scheduler,
+      public std::enable_shared_from_this<PosixEnginePollerShard> {
+ public:
+  // Returns nullptr if no poller could be created. Closures scheduled once the
+  // shard thread has exited run on executor instead.
+  static std::shared_ptr<PosixEnginePollerShard> Create(
+      int cpu, std::shared_ptr<ThreadPool> executor);
+
+  // Stops the shard thread once it has run the closures queued so far, and
+  // waits for it to exit. If called from the shard thread itself, the thread
+  // exits once the closure being run returns instead.
+  void Shutdown();
+
+  // Returns the shard driven by the calling thread, if any.
+  static PosixEnginePollerShard* Current();
+
+  // Returns nullptr if no poller could be created.
+  grpc_event_engine::experimental::PosixEventPoller* Poller() const {
+    return poller_.get();
+  }
+
+  void Run(experimental::EventEngine::Closure* closure) override;
+  void Run(absl::AnyInvocable<void()>) override;
+
+ private:
+  explicit PosixEnginePollerShard(std::shared_ptr<ThreadPool> executor);
+
+  void PollLoop(int cpu);
+  // Runs the queued closures. Returns false if there were none. If stop is
+  // set and there were none, no more closures are queued afterwards.
+  bool RunClosures(bool stop = false);
+
+  const std::shared_ptr<ThreadPool> executor_;
+  std::shared_ptr<grpc_event_engine::experimental::PosixEventPoller> poller_;
+  std::atomic<bool> done_{false};
+  grpc_core::Mutex mu_;
+  std::vector<absl::AnyInvocable<void()>> closures_ ABSL_GUARDED_BY(mu_);
+  bool stopped_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_core::Notification exited_;
+};
+
 #endif  // GRPC_POSIX_SOCKET_TCP
 
 // An iomgr-based Posix EventEngine implementation.
@@ -179,6 +230,9 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
       GRPC_UNUSED const DNSResolver::ResolverOptions& options) override;
   void Run(Closure* closure) override;
   void Run(absl::AnyInvocable<void()> closure) override;
+  void RunWithPriority(RunPriority priority, Closure* closure) override;
+  void RunWithPriority(RunPriority priority,
+                       absl::AnyInvocable<void()> closure) override;
   // Caution!! The timer implementation cannot create any fds. See #20418.
   TaskHandle RunAfter(Duration when, Closure* closure) override;
   TaskHandle RunAfter(Duration when,
@@ -283,12 +337,22 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
 
   void SchedulePoller();
   void ResetPollCycle();
+  // Returns the pollers of the first count poller shards, starting them if
+  // needed. Returns an empty list if sharding is not available, in which case
+  // everything is polled by poller_manager_.
+  std::vector<PosixEventPoller*> GetPollerShards(int count);
 
   PosixEnginePollerManager poller_manager_;
 
   // Ensures there's ever only one of these.
   std::optional<PollingCycle> polling_cycle_ ABSL_GUARDED_BY(&mu_);
 
+  grpc_core::Mutex poller_shards_mu_;
+  // Created on demand, and only shut down with the engine since endpoints of
+  // any listener may still be registered with them.
+  std::vector<std::shared_ptr<PosixEnginePollerShard>> poller_shards_
+      ABSL_GUARDED_BY(poller_shards_mu_);
+
 #endif  // defined(GRPC_POSIX_SOCKET_TCP) &&
         // !defined(GRPC_DO_NOT_INSTANTIATE_POSIX_POLLER)
 
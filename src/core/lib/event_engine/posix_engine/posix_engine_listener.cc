@@ -23,21 +23,26 @@
 #include <errno.h>  // IWYU pragma: keep
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <sys/socket.h>  // IWYU pragma: keep
 #include <unistd.h>      // IWYU pragma: keep
 
 #include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include "absl/cleanup/cleanup.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/accept_admission_control.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener.h"
@@ -57,14 +62,31 @@ PosixEngineListenerImpl::PosixEngineListenerImpl(
     const grpc_event_engine::experimental::EndpointConfig& config,
     std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
         memory_allocator_factory,
-    PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+    PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+    std::vector<PosixEventPoller*> poller_shards)
     : poller_(poller),
       options_(TcpOptionsFromEndpointConfig(config)),
+      poller_shards_(std::move(poller_shards)),
       engine_(std::move(engine)),
       acceptors_(this),
       on_accept_(std::move(on_accept)),
       on_shutdown_(std::move(on_shutdown)),
-      memory_allocator_factory_(std::move(memory_allocator_factory)) {}
+      memory_allocator_factory_(std::move(memory_allocator_factory)) {
+  // Without SO_REUSEPORT only one socket can be bound to an address.
+  if (poller_shards_.size() > 1 && !options_.allow_reuse_port) {
+    LOG(INFO) << "Ignoring " << GRPC_ARG_TCP_LISTENER_SHARD_COUNT
+              << " since SO_REUSEPORT is disabled";
+    poller_shards_.clear();
+  }
+  if (poller_shards_.empty()) poller_shards_.push_back(poller_);
+  if (options_.listener_admission_control) {
+    admission_control_ = std::make_shared<AcceptAdmissionControl>(
+        options_.resource_quota == nullptr
+            ? nullptr
+            : options_.resource_quota->memory_quota(),
+        options_.max_allowed_incoming_connections);
+  }
+}
 
 absl::StatusOr<int> PosixEngineListenerImpl::Bind(
     const EventEngine::ResolvedAddress& addr,
@@ -100,20 +122,45 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   // Update the callback. Any subsequent new sockets created and added to
   // acceptors_ in this function will invoke the new callback.
   acceptors_.UpdateOnAppendCallback(std::move(on_bind_new_fd));
+  // Every shard binds its own socket to the address, with the port picked by
+  // the first shard. Unix domain sockets cannot be shared with SO_REUSEPORT.
+  const size_t num_shards =
+      addr.address()->sa_family == AF_UNIX ? 1 : poller_shards_.size();
+  // If a shard fails to bind, the sockets of the shards bound before it are
+  // closed again so that a failed Bind leaves no port behind.
+  const int num_acceptors = acceptors_.Size();
+  auto reset_shard = absl::MakeCleanup([this]() {
+    mu_.AssertHeld();
+    acceptors_.SetShard(0);
+  });
   if (used_port.has_value()) {
-    requested_port = *used_port;
-    return ListenerContainerAddWildcardAddresses(&posix_interface, acceptors_,
-                                                 options_, requested_port);
+    absl::StatusOr<int> port = *used_port;
+    for (size_t shard = 0; shard < num_shards && port.ok(); ++shard) {
+      acceptors_.SetShard(shard);
+      port = ListenerContainerAddWildcardAddresses(&posix_interface, acceptors_,
+                                                   options_, *port);
+    }
+    if (!port.ok()) acceptors_.Truncate(num_acceptors);
+    return port;
   }
   if (ResolvedAddressToV4Mapped(res_addr, &addr6_v4mapped)) {
     res_addr = addr6_v4mapped;
   }
 
-  auto result =
-      CreateAndPrepareListenerSocket(&posix_interface, options_, res_addr);
-  GRPC_RETURN_IF_ERROR(result.status());
-  acceptors_.Append(*result);
-  return result->port;
+  int port = 0;
+  for (size_t shard = 0; shard < num_shards; ++shard) {
+    auto result =
+        CreateAndPrepareListenerSocket(&posix_interface, options_, res_addr);
+    if (!result.ok()) {
+      acceptors_.Truncate(num_acceptors);
+      return result.status();
+    }
+    acceptors_.SetShard(shard);
+    acceptors_.Append(*result);
+    port = result->port;
+    ResolvedAddressSetPort(res_addr, port);
+  }
+  return port;
 }
 
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
@@ -121,6 +168,27 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   handle_->NotifyOnRead(notify_on_accept_);
 }
 
+void PosixEngineListenerImpl::AsyncConnectionAcceptor::RetryAcceptLater(
+    grpc_core::Duration delay) {
+  // Do not schedule another timer if one is already armed.
+  if (retry_timer_armed_.exchange(true)) return;
+  // Hold a ref while the retry timer is waiting, to prevent listener
+  // destruction and the races that would ensue.
+  Ref();
+  std::ignore = engine_->RunAfter(delay, [this]() {
+    retry_timer_armed_.store(false);
+    // A paused acceptor is not waiting for readiness events. If the handle was
+    // shut down meanwhile, NotifyOnRead runs the closure with an error.
+    if (accept_paused_.exchange(false)) {
+      handle_->NotifyOnRead(notify_on_accept_);
+    }
+    if (!handle_->IsHandleShutdown()) {
+      handle_->SetReadable();
+    }
+    Unref();
+  });
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     absl::Status status) {
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
@@ -133,6 +201,15 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
   }
   // loop until accept4 returns EAGAIN, and then re-arm notification.
   for (;;) {
+    AcceptAdmissionControl* admission_control =
+        listener_->admission_control_.get();
+    if (admission_control != nullptr && !admission_control->ShouldAccept()) {
+      // Leave the connections in the accept queue, and stop listening for new
+      // ones so that a connection storm does not keep waking the poller up.
+      accept_paused_.store(true);
+      RetryAcceptLater(grpc_core::Duration::Milliseconds(100));
+      return;
+    }
     EventEngine::ResolvedAddress addr;
     memset(const_cast<sockaddr*>(addr.address()), 0, addr.size());
     auto& posix_interface = handle_->Poller()->posix_interface();
@@ -163,19 +240,7 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
           LOG_EVERY_N_SEC(ERROR, 1)
               << "File descriptor limit reached. Retrying.";
           handle_->NotifyOnRead(notify_on_accept_);
-          // Do not schedule another timer if one is already armed.
-          if (retry_timer_armed_.exchange(true)) return;
-          // Hold a ref while the retry timer is waiting, to prevent listener
-          // destruction and the races that would ensue.
-          Ref();
-          std::ignore =
-              engine_->RunAfter(grpc_core::Duration::Seconds(1), [this]() {
-                retry_timer_armed_.store(false);
-                if (!handle_->IsHandleShutdown()) {
-                  handle_->SetReadable();
-                }
-                Unref();
-              });
+          RetryAcceptLater(grpc_core::Duration::Seconds(1));
           return;
         case EAGAIN:
         case ECONNABORTED:
@@ -231,10 +296,22 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       Unref();
       return;
     }
+    PosixEngineClosure* on_shutdown = nullptr;
+    if (admission_control != nullptr) {
+      admission_control->OnConnectionAccepted();
+      // Runs once the endpoint has released its file descriptor, and deletes
+      // itself.
+      on_shutdown = new PosixEngineClosure(
+          [admission_control = listener_->admission_control_](
+              absl::Status /*status*/) {
+            admission_control->OnConnectionClosed();
+          },
+          /*is_permanent=*/false);
+    }
     auto endpoint = CreatePosixEndpoint(
-        /*handle=*/listener_->poller_->CreateHandle(
-            fd.value(), *peer_name, listener_->poller_->CanTrackErrors()),
-        /*on_shutdown=*/nullptr, /*engine=*/listener_->engine_,
+        /*handle=*/handle_->Poller()->CreateHandle(
+            fd.value(), *peer_name, handle_->Poller()->CanTrackErrors()),
+        on_shutdown, /*engine=*/listener_->engine_,
         // allocator=
         listener_->memory_allocator_factory_->CreateMemoryAllocator(
             absl::StrCat("endpoint-tcp-server-connection: ", *peer_name)),
@@ -25,6 +25,7 @@
 #include <list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -34,8 +35,10 @@
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
+#include "src/core/lib/event_engine/posix_engine/accept_admission_control.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h"
@@ -55,7 +58,8 @@ class PosixEngineListenerImpl
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine);
+      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+      std::vector<PosixEventPoller*> poller_shards = {});
   // Binds an address to the listener. This creates a ListenerSocket
   // and sets its fields appropriately.
   absl::StatusOr<int> Bind(
@@ -80,15 +84,17 @@ class PosixEngineListenerImpl
    public:
     AsyncConnectionAcceptor(std::shared_ptr<EventEngine> engine,
                             std::shared_ptr<PosixEngineListenerImpl> listener,
-                            ListenerSocketsContainer::ListenerSocket socket)
+                            ListenerSocketsContainer::ListenerSocket socket,
+                            size_t shard, PosixEventPoller* poller)
         : engine_(std::move(engine)),
           listener_(std::move(listener)),
           socket_(socket),
-          handle_(listener_->poller_->CreateHandle(
+          shard_(shard),
+          handle_(poller->CreateHandle(
               socket_.sock,
               *grpc_event_engine::experimental::
                   ResolvedAddressToNormalizedString(socket_.addr),
-              listener_->poller_->CanTrackErrors())),
+              poller->CanTrackErrors())),
           notify_on_accept_(PosixEngineClosure::ToPermanentClosure(
               [this](absl::Status status) { NotifyOnAccept(status); })) {};
     // Start listening for incoming connections on the socket.
@@ -98,6 +104,9 @@ class PosixEngineListenerImpl
     void NotifyOnAccept(absl::Status status);
     // Shutdown the poller handle associated with this socket.
     void Shutdown();
+    // Makes the acceptor look for incoming connections again after delay, even
+    // if no new connection arrives.
+    void RetryAcceptLater(grpc_core::Duration delay);
     void Ref() { ref_count_.fetch_add(1, std::memory_order_relaxed); }
     void Unref() {
       if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
@@ -105,6 +114,7 @@ class PosixEngineListenerImpl
       }
     }
     ListenerSocketsContainer::ListenerSocket& Socket() { return socket_; }
+    size_t Shard() const { return shard_; }
     FileDescriptor Fd() { return handle_->WrappedFd(); }
     ~AsyncConnectionAcceptor() {
       auto address = handle_->Poller()->posix_interface().LocalAddress(
@@ -122,11 +132,16 @@ class PosixEngineListenerImpl
     std::shared_ptr<EventEngine> engine_;
     std::shared_ptr<PosixEngineListenerImpl> listener_;
     ListenerSocketsContainer::ListenerSocket socket_;
+    // Index of the poller shard the socket is registered with.
+    size_t shard_;
     EventHandle* handle_;
     PosixEngineClosure* notify_on_accept_;
     // Tracks the status of a backup timer to retry accept4 calls after file
-    // descriptor exhaustion.
+    // descriptor exhaustion or while admission control pauses accepting.
     std::atomic<bool> retry_timer_armed_{false};
+    // Set while admission control pauses accepting: notify_on_accept_ is not
+    // registered for read events, and the retry timer registers it again.
+    std::atomic<bool> accept_paused_{false};
   };
   class ListenerAsyncAcceptors : public ListenerSocketsContainer {
    public:
@@ -138,9 +153,14 @@ class PosixEngineListenerImpl
       on_append_ = std::move(on_append);
     }
 
+    // Sockets appended after this call are registered with the poller of the
+    // given shard.
+    void SetShard(size_t shard) { shard_ = shard; }
+
     void Append(ListenerSocket socket) override {
       acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
+          listener_->engine_, listener_->shared_from_this(), socket, shard_,
+          listener_->poller_shards_[shard_]));
       if (on_append_) {
         on_append_(socket.sock.fd());
       }
@@ -150,6 +170,8 @@ class PosixEngineListenerImpl
         const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
             addr) override {
       for (auto* acceptor : acceptors_) {
+        // Every shard holds its own socket for the same address.
+        if (acceptor->Shard() != shard_) continue;
         if (acceptor->Socket().addr.size() == addr.size() &&
             memcmp(acceptor->Socket().addr.address(), addr.address(),
                    addr.size()) == 0) {
@@ -161,6 +183,15 @@ class PosixEngineListenerImpl
 
     int Size() { return static_cast<int>(acceptors_.size()); }
 
+    // Closes the sockets appended after the first size ones. They must not
+    // have been started yet.
+    void Truncate(int size) {
+      while (Size() > size) {
+        acceptors_.back()->Unref();
+        acceptors_.pop_back();
+      }
+    }
+
     std::list<AsyncConnectionAcceptor*>::const_iterator begin() {
       return acceptors_.begin();
     }
@@ -172,6 +203,7 @@ class PosixEngineListenerImpl
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
+    size_t shard_ = 0;
   };
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
@@ -180,6 +212,11 @@ class PosixEngineListenerImpl
   grpc_core::Mutex mu_;
   PosixEventPoller* poller_;
   PosixTcpOptions options_;
+  // Pollers the listening sockets are spread across. Every bound address gets
+  // one SO_REUSEPORT socket per poller, and connections accepted on a socket
+  // are registered with the poller of that socket. Holds just poller_ unless
+  // GRPC_ARG_TCP_LISTENER_SHARD_COUNT is set.
+  std::vector<PosixEventPoller*> poller_shards_;
   std::shared_ptr<EventEngine> engine_;
   // Linked list of sockets. One is created upon each successful bind
   // operation.
@@ -195,6 +232,9 @@ class PosixEngineListenerImpl
   // unique slice allocators for each new incoming connection.
   std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
       memory_allocator_factory_;
+  // Set if GRPC_ARG_TCP_LISTENER_ADMISSION_CONTROL is enabled. Shared with the
+  // accepted endpoints, which report back when they are closed.
+  std::shared_ptr<AcceptAdmissionControl> admission_control_;
 };
 
 class PosixEngineListener : public PosixListenerWithFdSupport {
@@ -205,10 +245,12 @@ class PosixEngineListener : public PosixListenerWithFdSupport {
       const grpc_event_engine::experimental::EndpointConfig& config,
       std::unique_ptr<grpc_event_engine::experimental::MemoryAllocatorFactory>
           memory_allocator_factory,
-      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine)
+      PosixEventPoller* poller, std::shared_ptr<EventEngine> engine,
+      std::vector<PosixEventPoller*> poller_shards = {})
       : impl_(std::make_shared<PosixEngineListenerImpl>(
             std::move(on_accept), std::move(on_shutdown), config,
-            std::move(memory_allocator_factory), poller, std::move(engine))) {}
+            std::move(memory_allocator_factory), poller, std::move(engine),
+            std::move(poller_shards))) {}
   ~PosixEngineListener() override { ShutdownListeningFds(); };
   absl::StatusOr<int> Bind(
       const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr)
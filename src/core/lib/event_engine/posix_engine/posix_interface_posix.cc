@@ -243,10 +243,12 @@ absl::Status SetSocketCloexec(int fd, int close_on_exec) {
   return absl::OkStatus();
 }
 
-// set a socket to reuse old addresses
+// Set an integer socket option. Only checks that the option reads back as
+// enabled or disabled, since the kernel may report a different non-zero value
+// for flags.
 absl::Status SetSocketOption(int fd, int level, int option, int value,
                              absl::string_view debug_label) {
-  int val = (value != 0);
+  int val = value;
   int newval;
   socklen_t intlen = sizeof(newval);
   if (0 != setsockopt(fd, level, option, &val, sizeof(val))) {
@@ -259,7 +261,7 @@ absl::Status SetSocketOption(int fd, int level, int option, int value,
                         absl::StrCat("setsockopt(", debug_label,
                                      "): ", grpc_core::StrError(errno)));
   }
-  if ((newval != 0) != val) {
+  if ((newval != 0) != (val != 0)) {
     return absl::Status(absl::StatusCode::kInternal,
                         absl::StrCat("Failed to set ", debug_label));
   }
@@ -378,6 +380,33 @@ void TrySetSocketTcpUserTimeout(int fd, const PosixTcpOptions& options,
   }
 }
 
+// Set SO_BUSY_POLL, and SO_PREFER_BUSY_POLL where the kernel knows it.
+// Raising SO_BUSY_POLL above net.core.busy_read requires CAP_NET_ADMIN, so
+// failures are not fatal.
+void TrySetSocketBusyPoll(GRPC_UNUSED int fd,
+                          const PosixTcpOptions& options) {
+  if (options.busy_poll_us <= 0) {
+    return;
+  }
+#ifdef SO_BUSY_POLL
+  absl::Status status = SetSocketOption(fd, SOL_SOCKET, SO_BUSY_POLL,
+                                        options.busy_poll_us, "SO_BUSY_POLL");
+  if (!status.ok()) {
+    VLOG(2) << status;
+    return;
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  if (!SetSocketOption(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, 1,
+                       "SO_PREFER_BUSY_POLL")
+           .ok()) {
+    VLOG(2) << "Node does not support SO_PREFER_BUSY_POLL, continuing.";
+  }
+#endif  // SO_PREFER_BUSY_POLL
+#else   // SO_BUSY_POLL
+  VLOG(2) << "SO_BUSY_POLL unavailable on compiling system";
+#endif  // SO_BUSY_POLL
+}
+
 absl::StatusOr<int> InternalCreateDualStackSocket(
     std::function<int(int, int, int)> socket_factory,
     const experimental::EventEngine::ResolvedAddress& addr, int type,
@@ -829,6 +858,7 @@ EventEnginePosixInterface::PrepareListenerSocket(
         SetSocketOption(f, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"));
     GRPC_RETURN_IF_ERROR(SetSocketDscp(f, options.dscp));
     TrySetSocketTcpUserTimeout(f, options, false);
+    TrySetSocketBusyPoll(f, options);
   }
   GRPC_RETURN_IF_ERROR(InternalSetSocketNoSigpipeIfPossible(f));
   GRPC_RETURN_IF_ERROR(InternalApplySocketMutatorInOptions(
@@ -994,6 +1024,7 @@ absl::Status EventEnginePosixInterface::PrepareTcpClientSocket(
         SetSocketOption(fd, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"));
     GRPC_RETURN_IF_ERROR(SetSocketDscp(fd, options.dscp));
     TrySetSocketTcpUserTimeout(fd, options, true);
+    TrySetSocketBusyPoll(fd, options);
   }
   GRPC_RETURN_IF_ERROR(InternalSetSocketNoSigpipeIfPossible(fd));
   GRPC_RETURN_IF_ERROR(InternalApplySocketMutatorInOptions(
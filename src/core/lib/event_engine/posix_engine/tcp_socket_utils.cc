@@ -96,6 +96,12 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zerocopy_receive_bytes_threshold = AdjustValue(
+      PosixTcpOptions::kDefaultReceiveBytesThreshold, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_RECEIVE_BYTES_THRESHOLD));
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(PosixTcpOptions::kZerocpRxEnabledDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) != 0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -112,6 +118,22 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_shard_count =
+      AdjustValue(PosixTcpOptions::kDefaultListenerShardCount, 1, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_LISTENER_SHARD_COUNT));
+  options.busy_poll_us =
+      AdjustValue(PosixTcpOptions::kBusyPollUnset, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_BUSY_POLL_US));
+  options.tcp_write_batch_max_delay_us = AdjustValue(
+      0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_WRITE_BATCH_MAX_DELAY_US));
+  options.tcp_write_timestamp_sample_interval =
+      AdjustValue(0, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_WRITE_TIMESTAMP_SAMPLE_INTERVAL));
+  options.listener_admission_control =
+      AdjustValue(0, 0, 1,
+                  config.GetInt(GRPC_ARG_TCP_LISTENER_ADMISSION_CONTROL)) != 0;
+  options.max_allowed_incoming_connections = AdjustValue(
+      0, 0, INT_MAX, config.GetInt(GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS));
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
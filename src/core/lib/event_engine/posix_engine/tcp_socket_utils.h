@@ -51,9 +51,14 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kZerocpRxEnabledDefault = 0;
+  static constexpr size_t kDefaultReceiveBytesThreshold = 256 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kDefaultListenerShardCount = 1;
+  // Leave SO_BUSY_POLL at the system default.
+  static constexpr int kBusyPollUnset = 0;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
@@ -61,11 +66,19 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  int tcp_rx_zerocopy_receive_bytes_threshold = kDefaultReceiveBytesThreshold;
+  bool tcp_rx_zero_copy_enabled = kZerocpRxEnabledDefault;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   int dscp = kDscpNotSet;
+  int listener_shard_count = kDefaultListenerShardCount;
+  int busy_poll_us = kBusyPollUnset;
+  int tcp_write_batch_max_delay_us = 0;
+  int tcp_write_timestamp_sample_interval = 0;
+  bool listener_admission_control = false;
+  int max_allowed_incoming_connections = 0;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   grpc_event_engine::experimental::MemoryAllocatorFactory*
@@ -132,11 +145,21 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_rx_zerocopy_receive_bytes_threshold =
+        other.tcp_rx_zerocopy_receive_bytes_threshold;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    listener_shard_count = other.listener_shard_count;
+    busy_poll_us = other.busy_poll_us;
+    tcp_write_batch_max_delay_us = other.tcp_write_batch_max_delay_us;
+    tcp_write_timestamp_sample_interval =
+        other.tcp_write_timestamp_sample_interval;
+    listener_admission_control = other.listener_admission_control;
+    max_allowed_incoming_connections = other.max_allowed_incoming_connections;
   }
 };
 
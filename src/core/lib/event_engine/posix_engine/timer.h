@@ -66,26 +66,24 @@ class TimerListHost {
   ~TimerListHost() = default;
 };
 
-class TimerList {
+// The set of pending timers of a TimerManager.
+class TimerListInterface {
  public:
-  explicit TimerList(TimerListHost* host);
-
-  TimerList(const TimerList&) = delete;
-  TimerList& operator=(const TimerList&) = delete;
+  virtual ~TimerListInterface() = default;
 
   // Initialize a Timer.
   // When expired, the closure will be run. If the timer is canceled, the
   // closure will not be run. Behavior is undefined for a deadline of
   // grpc_core::Timestamp::InfFuture().
-  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
-                 experimental::EventEngine::Closure* closure);
+  virtual void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                         experimental::EventEngine::Closure* closure) = 0;
 
   // Cancel a Timer.
   // Returns false if the timer cannot be canceled. This will happen if the
   // timer has already fired, or if its closure is currently running. The
   // closure is guaranteed to run eventually if this method returns false.
   // Otherwise, this returns true, and the closure will not be run.
-  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer);
+  GRPC_MUST_USE_RESULT virtual bool TimerCancel(Timer* timer) = 0;
 
   // Check for timers to be run, and return them.
   // Return nullopt if timers could not be checked due to contention with
@@ -96,8 +94,23 @@ class TimerList {
   // *next is never guaranteed to be updated on any given execution; however,
   // with high probability at least one thread in the system will see an update
   // at any time slice.
+  virtual std::optional<std::vector<experimental::EventEngine::Closure*>>
+  TimerCheck(grpc_core::Timestamp* next) = 0;
+};
+
+// A TimerListInterface implementation based on sharded heaps.
+class TimerList final : public TimerListInterface {
+ public:
+  explicit TimerList(TimerListHost* host);
+
+  TimerList(const TimerList&) = delete;
+  TimerList& operator=(const TimerList&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
   std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
-      grpc_core::Timestamp* next);
+      grpc_core::Timestamp* next) override;
 
  private:
   // A "timer shard". Contains a 'heap' and a 'list' of timers. All timers with
@@ -29,6 +29,8 @@
 #include "absl/log/log.h"
 #include "absl/time/time.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/experiments/experiments.h"
 
 static thread_local bool g_timer_thread;
 
@@ -85,7 +87,12 @@ bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 TimerManager::TimerManager(
     std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  if (grpc_core::IsEventEngineTimerWheelEnabled()) {
+    timer_list_ = std::make_unique<TimerWheel>(
+        &host_, grpc_core::IsEventEngineTimerWheelCoarseEnabled());
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
@@ -0,0 +1,265 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// The level of a deadline relative to now: the index of the group of
+// kSlotBits bits that holds the highest bit in which they differ.
+int LevelOf(int64_t deadline, int64_t now, int slot_bits) {
+  uint64_t diff = static_cast<uint64_t>(deadline ^ now);
+  return (63 - absl::countl_zero(diff)) / slot_bits;
+}
+
+}  // namespace
+
+int64_t TimerWheel::Shard::SlotStart(int level, int slot) const {
+  const int shift = kSlotBits * level;
+  return (now_ms & ~((int64_t{1} << (shift + kSlotBits)) - 1)) |
+         (int64_t{slot} << shift);
+}
+
+int64_t TimerWheel::Shard::Add(Timer* timer) {
+  Timer** head;
+  int64_t event;
+  if (timer->deadline <= now_ms) {
+    head = &due;
+    event = now_ms;
+  } else {
+    int level = LevelOf(timer->deadline, now_ms, kSlotBits);
+    if (level >= kLevels) {
+      head = &overflow;
+      // The overflow list is re-added when the top level wraps around.
+      event = (now_ms | ((int64_t{1} << (kSlotBits * kLevels)) - 1)) + 1;
+    } else {
+      int slot = (timer->deadline >> (kSlotBits * level)) & (kSlots - 1);
+      head = &slots[level][slot];
+      occupied[level] |= uint64_t{1} << slot;
+      event = SlotStart(level, slot);
+    }
+  }
+  timer->prev = nullptr;
+  timer->next = *head;
+  if (*head != nullptr) (*head)->prev = timer;
+  *head = timer;
+  return event;
+}
+
+// A timer stays in the list Add() picked until now_ms reaches the start of its
+// slot, so the list can be found again from its deadline.
+Timer** TimerWheel::Shard::ListFor(const Timer* timer) {
+  if (timer->deadline <= now_ms) return &due;
+  int level = LevelOf(timer->deadline, now_ms, kSlotBits);
+  if (level >= kLevels) return &overflow;
+  return &slots[level][(timer->deadline >> (kSlotBits * level)) & (kSlots - 1)];
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  Timer** head = ListFor(timer);
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    *head = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (*head == nullptr && head != &due && head != &overflow) {
+    size_t index = head - &slots[0][0];
+    occupied[index / kSlots] &= ~(uint64_t{1} << (index % kSlots));
+  }
+}
+
+Timer* TimerWheel::Shard::TakeSlot(int level, int slot) {
+  occupied[level] &= ~(uint64_t{1} << slot);
+  return std::exchange(slots[level][slot], nullptr);
+}
+
+void TimerWheel::Shard::Requeue(
+    Timer* list, std::vector<experimental::EventEngine::Closure*>* out) {
+  while (list != nullptr) {
+    Timer* timer = list;
+    list = timer->next;
+    if (timer->deadline <= now_ms) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    } else {
+      Add(timer);
+    }
+  }
+}
+
+int64_t TimerWheel::Shard::NextEvent() const {
+  if (due != nullptr) return now_ms;
+  // The slots of a level all start before the first later slot of the level
+  // above, so the first level with a later occupied slot has the next event.
+  for (int level = 0; level < kLevels; ++level) {
+    uint64_t digit = (now_ms >> (kSlotBits * level)) & (kSlots - 1);
+    uint64_t later = occupied[level] & ~((uint64_t{2} << digit) - 1);
+    if (later != 0) return SlotStart(level, absl::countr_zero(later));
+  }
+  if (overflow != nullptr) {
+    return (now_ms | ((int64_t{1} << (kSlotBits * kLevels)) - 1)) + 1;
+  }
+  return kNoEvent;
+}
+
+void TimerWheel::Shard::Advance(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  Requeue(std::exchange(due, nullptr), out);
+  for (int64_t event = NextEvent(); event <= now; event = NextEvent()) {
+    now_ms = event;
+    if ((event & ((int64_t{1} << (kSlotBits * kLevels)) - 1)) == 0) {
+      Requeue(std::exchange(overflow, nullptr), out);
+    }
+    // Cascade the slots that start now, top level first so that their timers
+    // can cascade further down within this iteration.
+    for (int level = kLevels - 1; level >= 0; --level) {
+      const int shift = kSlotBits * level;
+      if ((event & ((int64_t{1} << shift) - 1)) != 0) continue;
+      int slot = (event >> shift) & (kSlots - 1);
+      if ((occupied[level] & (uint64_t{1} << slot)) == 0) continue;
+      Requeue(TakeSlot(level, slot), out);
+    }
+  }
+  now_ms = std::max(now_ms, now);
+}
+
+TimerWheel::TimerWheel(TimerListHost* host, bool coarse)
+    : host_(host),
+      coarse_(coarse),
+      num_shards_(grpc_core::Clamp(gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(kNoEvent),
+      shards_(new Shard[num_shards_]) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  for (size_t i = 0; i < num_shards_; ++i) {
+    grpc_core::MutexLock lock(&shards_[i].mu);
+    shards_[i].now_ms = now;
+  }
+}
+
+size_t TimerWheel::ShardForCurrentThread() {
+  static std::atomic<size_t> next_thread_index{0};
+  thread_local size_t thread_index =
+      next_thread_index.fetch_add(1, std::memory_order_relaxed);
+  return thread_index % num_shards_;
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  const size_t shard_index = ShardForCurrentThread();
+  Shard& shard = shards_[shard_index];
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+  // A timer never moves to another shard, so TimerCancel() can find it
+  // without locking.
+  timer->heap_index = shard_index;
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+  int64_t event;
+  {
+    grpc_core::MutexLock lock(&shard.mu);
+    timer->pending = true;
+    const int64_t timeout = timer->deadline - shard.now_ms;
+    if (coarse_ && timeout > 0) {
+      const int level = LevelOf(timer->deadline, shard.now_ms, kSlotBits);
+      if (level >= 2 && level < kLevels &&
+          timeout >= int64_t{1} << (kSlotBits * level)) {
+        const int64_t granularity = int64_t{1} << (kSlotBits * (level - 1));
+        timer->deadline =
+            (timer->deadline + granularity - 1) & ~(granularity - 1);
+      }
+    }
+    event = shard.Add(timer);
+    if (event < shard.next_event.load(std::memory_order_relaxed)) {
+      shard.next_event.store(event);
+    }
+  }
+  // Wake up the timer manager if this timer needs attention before any other.
+  int64_t min_timer = min_timer_.load();
+  while (event < min_timer) {
+    if (min_timer_.compare_exchange_weak(min_timer, event)) {
+      host_->Kick();
+      break;
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard& shard = shards_[timer->heap_index];
+  grpc_core::MutexLock lock(&shard.mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard.Remove(timer);
+  return true;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  const int64_t now = host_->Now().milliseconds_after_process_epoch();
+  int64_t min_timer = min_timer_.load(std::memory_order_relaxed);
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = std::min(
+          *next, grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                     min_timer));
+    }
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> run;
+  min_timer = kNoEvent;
+  for (size_t i = 0; i < num_shards_; ++i) {
+    Shard& shard = shards_[i];
+    if (shard.next_event.load() <= now) {
+      grpc_core::MutexLock lock(&shard.mu);
+      shard.Advance(now, &run);
+      shard.next_event.store(shard.NextEvent());
+    }
+    min_timer = std::min(min_timer, shard.next_event.load());
+  }
+  min_timer_.store(min_timer);
+  // A TimerInit() that raced with the loop above may have compared its timer
+  // against the old min_timer_. Either it sees the store above and lowers
+  // min_timer_ itself, or its shard's next_event is visible here.
+  for (size_t i = 0; i < num_shards_; ++i) {
+    int64_t event = shards_[i].next_event.load();
+    int64_t current = min_timer_.load();
+    while (event < current &&
+           !min_timer_.compare_exchange_weak(current, event)) {
+    }
+  }
+  checker_mu_.Unlock();
+  if (next != nullptr) {
+    *next = std::min(*next,
+                     grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                         min_timer_.load()));
+  }
+  return std::move(run);
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,124 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// A TimerListInterface implementation based on hierarchical timing wheels.
+//
+// Each wheel has kLevels levels of kSlots slots. Level L covers deadlines that
+// differ from the current time of the wheel in bits [6 * L, 6 * L + 6) of
+// their millisecond value, so inserting or cancelling a timer is a constant
+// time list operation. When time reaches the start of a slot above level 0,
+// its timers cascade down to the level that matches their remaining time.
+//
+// Timers are spread over several wheels, each with its own mutex. A thread
+// always adds its timers to the same wheel, so threads rarely contend.
+//
+// In coarse mode, a timer that is at least 64^L milliseconds away, for
+// L >= 2, has its deadline rounded up to a multiple of 64^(L-1) milliseconds.
+// It is then late by at most 1/64 of its timeout, but cascades at most once.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host, bool coarse = false);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kSlotBits = 6;
+  static constexpr int kSlots = 1 << kSlotBits;
+  static constexpr int kLevels = 6;
+  static constexpr int64_t kNoEvent = std::numeric_limits<int64_t>::max();
+
+  struct Shard {
+    // Adds timer to the slot that matches its deadline, or to the due list if
+    // its deadline already passed. Returns the time at which the shard has
+    // to be checked for it.
+    int64_t Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns the head of the list that holds timer.
+    Timer** ListFor(const Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Takes all the timers out of a slot and clears its occupied bit.
+    Timer* TakeSlot(int level, int slot) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Re-adds the timers of list relative to now_ms, and appends the closures
+    // of those that expired to out.
+    void Requeue(Timer* list,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // The start time of a slot of the level relative to now_ms.
+    int64_t SlotStart(int level, int slot) const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // The time of the next slot that has to be processed, or kNoEvent.
+    int64_t NextEvent() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Processes every slot up to now, appending the closures of the expired
+    // timers to out.
+    void Advance(int64_t now,
+                 std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // All timers with deadlines <= now_ms are expired.
+    int64_t now_ms ABSL_GUARDED_BY(mu) = 0;
+    // One bit per non-empty slot of every level.
+    uint64_t occupied[kLevels] ABSL_GUARDED_BY(mu) = {};
+    // Doubly linked lists of timers, nullptr when empty.
+    Timer* slots[kLevels][kSlots] ABSL_GUARDED_BY(mu) = {};
+    // Timers whose deadline passed before they were added.
+    Timer* due ABSL_GUARDED_BY(mu) = nullptr;
+    // Timers beyond the range of the top level.
+    Timer* overflow ABSL_GUARDED_BY(mu) = nullptr;
+    // Cached NextEvent(), read by TimerCheck() without holding mu.
+    std::atomic<int64_t> next_event{kNoEvent};
+  };
+
+  size_t ShardForCurrentThread();
+
+  TimerListHost* const host_;
+  const bool coarse_;
+  const size_t num_shards_;
+  // The earliest next_event across all shards.
+  std::atomic<int64_t> min_timer_;
+  // Allow only one TimerCheck at once.
+  grpc_core::Mutex checker_mu_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
@@ -194,12 +194,14 @@ void TracedBufferList::AddNewEntry(int32_t seq_no,
                                    EventEnginePosixInterface* posix_interface,
                                    const FileDescriptor& fd,
                                    EventEngine::Endpoint::WriteEventSink sink) {
+  // Samples that request no metrics skip the TCP_INFO lookup.
+  const bool wants_metrics = sink.requested_metrics() != nullptr;
   TracedBuffer new_elem(seq_no, std::move(sink));
   // Store the current time as the sendmsg time.
   // new_elem.ts_.sendmsg_time.time = gpr_now(GPR_CLOCK_REALTIME);
   auto curr_time = absl::Now();
   struct tcp_info info;
-  if (posix_interface != nullptr &&
+  if (wants_metrics && posix_interface != nullptr &&
       GetSocketTcpInfo(&info, posix_interface, fd).ok()) {
     new_elem.sink_.RecordEvent(EventEngine::Endpoint::WriteEvent::kSendMsg,
                                curr_time, ExtractOptStatsFromTcpInfo(&info));
@@ -0,0 +1,199 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/write_latency_sampler.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/numeric/bits.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+using WriteEvent = EventEngine::Endpoint::WriteEvent;
+
+// What is known about a sampled write so far.
+struct SampledWrite {
+  SampledWrite(grpc_core::RefCountedPtr<WriteLatencySampler> sampler,
+               absl::Time accepted)
+      : sampler(std::move(sampler)), last_time(accepted) {}
+
+  grpc_core::RefCountedPtr<WriteLatencySampler> sampler;
+  // The last event received, kCount when the write was accepted.
+  WriteEvent last_event = WriteEvent::kCount;
+  absl::Time last_time;
+};
+
+// Returns the stage that ends with event, if the event that precedes it is
+// prev.
+std::optional<WriteLatencySampler::Stage> StageEndingWith(WriteEvent prev,
+                                                          WriteEvent event) {
+  switch (event) {
+    case WriteEvent::kSendMsg:
+      if (prev == WriteEvent::kCount) {
+        return WriteLatencySampler::Stage::kEndpoint;
+      }
+      break;
+    case WriteEvent::kScheduled:
+      if (prev == WriteEvent::kSendMsg) {
+        return WriteLatencySampler::Stage::kStack;
+      }
+      break;
+    case WriteEvent::kSent:
+      if (prev == WriteEvent::kScheduled) {
+        return WriteLatencySampler::Stage::kQdisc;
+      }
+      break;
+    case WriteEvent::kAcked:
+      if (prev == WriteEvent::kSent) return WriteLatencySampler::Stage::kWire;
+      break;
+    default:
+      break;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+WriteLatencySampler::WriteLatencySampler(int sample_interval)
+    : sample_interval_(sample_interval),
+      writes_until_sample_(sample_interval) {
+  CHECK_GT(sample_interval_, 0);
+}
+
+std::optional<EventEngine::Endpoint::WriteEventSink>
+WriteLatencySampler::MaybeSample() {
+  if (--writes_until_sample_ > 0) return std::nullopt;
+  writes_until_sample_ = sample_interval_;
+  auto write = std::make_unique<SampledWrite>(Ref(), absl::Now());
+  // No metrics are requested, so that the traced buffer list does not read
+  // TCP_INFO for the sample.
+  return EventEngine::Endpoint::WriteEventSink(
+      /*requested_metrics=*/nullptr,
+      {WriteEvent::kSendMsg, WriteEvent::kScheduled, WriteEvent::kSent,
+       WriteEvent::kAcked},
+      [write = std::move(write)](
+          WriteEvent event, absl::Time timestamp,
+          std::vector<EventEngine::Endpoint::WriteMetric> /*metrics*/) {
+        auto stage = StageEndingWith(write->last_event, event);
+        if (stage.has_value()) {
+          write->sampler->Record(*stage, timestamp - write->last_time);
+        }
+        write->last_event = event;
+        write->last_time = timestamp;
+      });
+}
+
+int WriteLatencySampler::BucketFor(int64_t micros) {
+  if (micros <= 0) return 0;
+  return std::min<int>(absl::bit_width(static_cast<uint64_t>(micros)),
+                       kNumBuckets - 1);
+}
+
+void WriteLatencySampler::Record(Stage stage, absl::Duration latency) {
+  int64_t micros = std::max<int64_t>(absl::ToInt64Microseconds(latency), 0);
+  buckets_[static_cast<int>(stage)][BucketFor(micros)].fetch_add(
+      1, std::memory_order_relaxed);
+  int value = static_cast<int>(
+      std::min<int64_t>(micros, std::numeric_limits<int>::max()));
+  auto& stats = grpc_core::global_stats();
+  switch (stage) {
+    case Stage::kEndpoint:
+      stats.IncrementTcpWriteEndpointDelayUs(value);
+      break;
+    case Stage::kStack:
+      stats.IncrementTcpWriteStackDelayUs(value);
+      break;
+    case Stage::kQdisc:
+      stats.IncrementTcpWriteQdiscDelayUs(value);
+      break;
+    case Stage::kWire:
+      stats.IncrementTcpWriteWireDelayUs(value);
+      break;
+    case Stage::kCount:
+      break;
+  }
+}
+
+uint64_t WriteLatencySampler::Count(Stage stage) const {
+  uint64_t count = 0;
+  for (const auto& bucket : buckets_[static_cast<int>(stage)]) {
+    count += bucket.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+std::optional<int64_t> WriteLatencySampler::QuantileUs(Stage stage,
+                                                       double q) const {
+  uint64_t counts[kNumBuckets];
+  uint64_t total = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    counts[i] =
+        buckets_[static_cast<int>(stage)][i].load(std::memory_order_relaxed);
+    total += counts[i];
+  }
+  if (total == 0) return std::nullopt;
+  const uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+  uint64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    seen += counts[i];
+    if (seen >= rank) return i == 0 ? 0 : int64_t{1} << i;
+  }
+  return int64_t{1} << (kNumBuckets - 1);
+}
+
+grpc_core::channelz::PropertyGrid WriteLatencySampler::ChannelzProperties()
+    const {
+  grpc_core::channelz::PropertyGrid grid;
+  for (int i = 0; i < static_cast<int>(Stage::kCount); ++i) {
+    const Stage stage = static_cast<Stage>(i);
+    const absl::string_view name = StageName(stage);
+    grid.Set(name, "count", Count(stage))
+        .Set(name, "p50_us", QuantileUs(stage, 0.5))
+        .Set(name, "p90_us", QuantileUs(stage, 0.9))
+        .Set(name, "p99_us", QuantileUs(stage, 0.99));
+  }
+  return grid;
+}
+
+absl::string_view WriteLatencySampler::StageName(Stage stage) {
+  switch (stage) {
+    case Stage::kEndpoint:
+      return "endpoint";
+    case Stage::kStack:
+      return "stack";
+    case Stage::kQdisc:
+      return "qdisc";
+    case Stage::kWire:
+      return "wire";
+    case Stage::kCount:
+      break;
+  }
+  return "unknown";
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,92 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_LATENCY_SAMPLER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_LATENCY_SAMPLER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <optional>
+
+#include "absl/time/time.h"
+#include "src/core/channelz/property_list.h"
+#include "src/core/util/ref_counted.h"
+
+namespace grpc_event_engine::experimental {
+
+// Timestamps one in every N writes of an endpoint, and aggregates where the
+// sampled writes spent their time into per-endpoint histograms. Unlike a
+// TcpCallTracer, it requests no connection metrics, so a sample costs one
+// sendmsg control message and the error queue messages it produces.
+//
+// The timestamps are taken when the endpoint accepts the write, when it calls
+// sendmsg, and when the kernel reports the SCM_TSTAMP_SCHED, SCM_TSTAMP_SND and
+// SCM_TSTAMP_ACK events for the last byte of the write.
+class WriteLatencySampler : public grpc_core::RefCounted<WriteLatencySampler> {
+ public:
+  enum class Stage {
+    // From the call to Write() until sendmsg: batching, waiting for the socket
+    // to become writable, and earlier writes.
+    kEndpoint,
+    // From sendmsg until the packet scheduler: the send buffer, congestion and
+    // flow control.
+    kStack,
+    // Time spent in the packet scheduler (qdisc).
+    kQdisc,
+    // From the network device until the peer acknowledged the last byte.
+    kWire,
+    kCount
+  };
+
+  // Latencies are kept in power of two buckets of microseconds: bucket 0 holds
+  // 0us, bucket i holds [2^(i-1), 2^i)us and the last bucket everything above.
+  static constexpr int kNumBuckets = 32;
+
+  // sample_interval must be positive.
+  explicit WriteLatencySampler(int sample_interval);
+
+  // Called for every write that carries no write event sink of its own.
+  // Returns a sink that records the latencies of the write if it is sampled.
+  // Must not be called concurrently.
+  std::optional<EventEngine::Endpoint::WriteEventSink> MaybeSample();
+
+  // Records that a sampled write spent latency in stage, in this sampler and in
+  // the global stats.
+  void Record(Stage stage, absl::Duration latency);
+
+  uint64_t Count(Stage stage) const;
+  // Returns the upper bound in microseconds of the bucket that holds the
+  // quantile q (in [0, 1]) of the latencies of stage, if any were recorded.
+  std::optional<int64_t> QuantileUs(Stage stage, double q) const;
+
+  // Count and median, 90th and 99th percentile of every stage.
+  grpc_core::channelz::PropertyGrid ChannelzProperties() const;
+
+  static absl::string_view StageName(Stage stage);
+
+ private:
+  static int BucketFor(int64_t micros);
+
+  const int sample_interval_;
+  int writes_until_sample_;
+  std::atomic<uint64_t> buckets_[static_cast<int>(Stage::kCount)]
+                                [kNumBuckets] = {};
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_WRITE_LATENCY_SAMPLER_H
@@ -15,13 +15,52 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
 namespace grpc_event_engine::experimental {
 
 namespace {
 thread_local bool g_thread_local{false};
+thread_local std::vector<void (*)()> g_end_of_batch_fns;
+// When the current closure batch must end. Only set while functions are
+// deferred, so that closure boundaries need no clock read otherwise.
+thread_local std::chrono::steady_clock::time_point g_end_of_batch_deadline =
+    std::chrono::steady_clock::time_point::max();
 }  // namespace
 
 void ThreadLocal::SetIsEventEngineThread(bool is) { g_thread_local = is; }
 bool ThreadLocal::IsEventEngineThread() { return g_thread_local; }
 
+bool ThreadLocal::RunAtEndOfClosureBatch(void (*fn)()) {
+  if (!g_thread_local) return false;
+  g_end_of_batch_fns.push_back(fn);
+  return true;
+}
+
+void ThreadLocal::EndClosureBatch() {
+  std::vector<void (*)()> fns;
+  while (!g_end_of_batch_fns.empty()) {
+    fns.swap(g_end_of_batch_fns);
+    for (auto fn : fns) fn();
+    fns.clear();
+  }
+  g_end_of_batch_deadline = std::chrono::steady_clock::time_point::max();
+}
+
+void ThreadLocal::EndClosureBatchBy(
+    std::chrono::steady_clock::time_point deadline) {
+  if (g_end_of_batch_fns.empty()) return;
+  g_end_of_batch_deadline = std::min(g_end_of_batch_deadline, deadline);
+}
+
+void ThreadLocal::EndClosureBatchIfOverdue() {
+  if (g_end_of_batch_deadline == std::chrono::steady_clock::time_point::max() ||
+      std::chrono::steady_clock::now() < g_end_of_batch_deadline) {
+    return;
+  }
+  EndClosureBatch();
+}
+
 }  // namespace grpc_event_engine::experimental
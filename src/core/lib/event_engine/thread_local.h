@@ -15,14 +15,30 @@
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_LOCAL_H
 #include <grpc/support/port_platform.h>
 
+#include <chrono>
+
 namespace grpc_event_engine::experimental {
 
 /// A lightweight facility to allow gpr's fork handlers and
-/// EventEngine::Forkables to coordinate.
+/// EventEngine::Forkables to coordinate, and to let code running on thread
+/// pool threads defer work until the end of the current batch of closures.
 class ThreadLocal {
  public:
   static void SetIsEventEngineThread(bool is_local);
   static bool IsEventEngineThread();
+  // Defers fn until the EventEngine thread pool has run the closures that are
+  // currently queued on this thread. Returns false, without deferring fn, if
+  // this is not an EventEngine thread.
+  static bool RunAtEndOfClosureBatch(void (*fn)());
+  // Runs the functions deferred with RunAtEndOfClosureBatch(), including those
+  // deferred while they run. Called by the thread pool.
+  static void EndClosureBatch();
+  // Ends the current closure batch at the first closure boundary after
+  // deadline, even if more closures are queued on this thread by then.
+  static void EndClosureBatchBy(std::chrono::steady_clock::time_point deadline);
+  // Ends the current closure batch if its deadline passed. Called by the
+  // thread pool after each closure.
+  static void EndClosureBatchIfOverdue();
 };
 
 }  // namespace grpc_event_engine::experimental
@@ -0,0 +1,192 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/util/no_destruct.h"
+
+#ifdef GPR_LINUX
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#endif  // GPR_LINUX
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+#ifdef GPR_LINUX
+
+std::optional<std::string> ReadSysfsFile(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (file == nullptr) return std::nullopt;
+  char buf[4096];
+  size_t n = fread(buf, 1, sizeof(buf) - 1, file);
+  fclose(file);
+  return std::string(absl::StripAsciiWhitespace(absl::string_view(buf, n)));
+}
+
+// Parses a sysfs CPU list such as "0-3,8-11".
+std::vector<int> ParseCpuList(absl::string_view list) {
+  std::vector<int> cpus;
+  for (absl::string_view range : absl::StrSplit(list, ',', absl::SkipEmpty())) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first, last;
+    if (!absl::SimpleAtoi(bounds.first, &first)) continue;
+    if (bounds.second.empty()) {
+      last = first;
+    } else if (!absl::SimpleAtoi(bounds.second, &last)) {
+      continue;
+    }
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+// Returns the first CPU sharing the last-level cache of cpu, or std::nullopt
+// if the cache hierarchy is not exposed.
+std::optional<int> LastLevelCacheLeader(int cpu) {
+  int best_level = -1;
+  std::optional<int> leader;
+  for (int index = 0;; ++index) {
+    std::string dir =
+        absl::StrCat("/sys/devices/system/cpu/cpu", cpu, "/cache/index", index);
+    auto level_str = ReadSysfsFile(absl::StrCat(dir, "/level"));
+    if (!level_str.has_value()) break;
+    int level;
+    if (!absl::SimpleAtoi(*level_str, &level) || level <= best_level) continue;
+    auto shared = ReadSysfsFile(absl::StrCat(dir, "/shared_cpu_list"));
+    if (!shared.has_value()) continue;
+    std::vector<int> cpus = ParseCpuList(*shared);
+    if (cpus.empty()) continue;
+    best_level = level;
+    leader = *std::min_element(cpus.begin(), cpus.end());
+  }
+  return leader;
+}
+
+std::vector<CpuTopology::Cpu> ReadTopology() {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return {};
+  std::map<int, int> node_of_cpu;
+  if (DIR* dir = opendir("/sys/devices/system/node")) {
+    while (struct dirent* entry = readdir(dir)) {
+      absl::string_view name(entry->d_name);
+      int node;
+      if (!absl::ConsumePrefix(&name, "node") ||
+          !absl::SimpleAtoi(name, &node)) {
+        continue;
+      }
+      auto list = ReadSysfsFile(
+          absl::StrCat("/sys/devices/system/node/", entry->d_name, "/cpulist"));
+      if (!list.has_value()) continue;
+      for (int cpu : ParseCpuList(*list)) node_of_cpu[cpu] = node;
+    }
+    closedir(dir);
+  }
+  std::vector<CpuTopology::Cpu> cpus;
+  for (int id = 0; id < CPU_SETSIZE; ++id) {
+    if (!CPU_ISSET(id, &allowed)) continue;
+    auto node = node_of_cpu.find(id);
+    CpuTopology::Cpu cpu;
+    cpu.id = id;
+    cpu.node = node == node_of_cpu.end() ? 0 : node->second;
+    // Without cache information, treat each node as one cache domain.
+    cpu.cache_domain = LastLevelCacheLeader(id).value_or(-1 - cpu.node);
+    cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+#else  // GPR_LINUX
+
+std::vector<CpuTopology::Cpu> ReadTopology() { return {}; }
+
+#endif  // GPR_LINUX
+
+}  // namespace
+
+const CpuTopology& CpuTopology::Get() {
+  static grpc_core::NoDestruct<CpuTopology> topology([] {
+    std::vector<Cpu> cpus = ReadTopology();
+    if (cpus.empty()) {
+      for (unsigned i = 0; i < gpr_cpu_num_cores(); ++i) {
+        cpus.push_back(Cpu{static_cast<int>(i), 0, 0});
+      }
+    }
+    return CpuTopology(std::move(cpus));
+  }());
+  return *topology;
+}
+
+CpuTopology::CpuTopology(std::vector<Cpu> cpus) : cpus_(std::move(cpus)) {
+  CHECK(!cpus_.empty());
+  std::map<int, int> nodes;
+  std::map<int, int> cache_domains;
+  for (Cpu& cpu : cpus_) {
+    cpu.node = nodes.emplace(cpu.node, nodes.size()).first->second;
+    cpu.cache_domain =
+        cache_domains.emplace(cpu.cache_domain, cache_domains.size())
+            .first->second;
+  }
+  num_nodes_ = nodes.size();
+  num_cache_domains_ = cache_domains.size();
+  // Take one CPU from each node in turn.
+  std::vector<std::vector<size_t>> by_node(num_nodes_);
+  for (size_t i = 0; i < cpus_.size(); ++i) {
+    by_node[cpus_[i].node].push_back(i);
+  }
+  for (size_t round = 0; placement_.size() < cpus_.size(); ++round) {
+    for (const auto& node_cpus : by_node) {
+      if (round < node_cpus.size()) placement_.push_back(node_cpus[round]);
+    }
+  }
+  GRPC_TRACE_LOG(event_engine, INFO)
+      << "CpuTopology: " << cpus_.size() << " cpus, " << num_nodes_
+      << " nodes, " << num_cache_domains_ << " cache domains";
+}
+
+bool CpuTopology::PinCurrentThread(size_t cpu_index) const {
+#ifdef GPR_LINUX
+  cpu_set_t pinned;
+  CPU_ZERO(&pinned);
+  CPU_SET(cpus_[cpu_index].id, &pinned);
+  return pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned) == 0;
+#else
+  (void)cpu_index;
+  return false;
+#endif  // GPR_LINUX
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,72 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <vector>
+
+namespace grpc_event_engine::experimental {
+
+// The CPUs the process may run on, grouped by NUMA node and by last-level
+// cache domain.
+//
+// Nodes and cache domains are numbered densely from 0, in the order in which
+// they first appear in cpus().
+class CpuTopology {
+ public:
+  struct Cpu {
+    // The CPU number the operating system uses.
+    int id;
+    int node;
+    int cache_domain;
+  };
+
+  // Returns the topology of the machine, read once. On platforms where it
+  // cannot be determined, all CPUs are reported on a single node that shares
+  // a single cache.
+  static const CpuTopology& Get();
+
+  // cpus must not be empty. Node and cache domain numbers may be arbitrary:
+  // they are renumbered densely.
+  explicit CpuTopology(std::vector<Cpu> cpus);
+
+  const std::vector<Cpu>& cpus() const { return cpus_; }
+  size_t num_nodes() const { return num_nodes_; }
+  size_t num_cache_domains() const { return num_cache_domains_; }
+
+  // Returns the index in cpus() of the CPU at which the n-th thread of a pool
+  // should be placed. Consecutive threads alternate between nodes, so that
+  // every node gets its share of a small pool.
+  size_t CpuIndexForThread(size_t n) const {
+    return placement_[n % placement_.size()];
+  }
+
+  // Restricts the calling thread to the CPU at index cpu_index in cpus().
+  // Returns false if the platform does not support it or the call failed.
+  bool PinCurrentThread(size_t cpu_index) const;
+
+ private:
+  std::vector<Cpu> cpus_;
+  std::vector<size_t> placement_;
+  size_t num_nodes_ = 0;
+  size_t num_cache_domains_ = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
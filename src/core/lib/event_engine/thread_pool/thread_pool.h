@@ -18,8 +18,10 @@
 #include <stddef.h>
 
 #include <memory>
+#include <utility>
 
 #include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/extensions/run_priority.h"
 
 namespace grpc_event_engine::experimental {
 
@@ -34,6 +36,16 @@ class ThreadPool {
   // Run must not be called after Quiesce completes
   virtual void Run(absl::AnyInvocable<void()> callback) = 0;
   virtual void Run(EventEngine::Closure* closure) = 0;
+  // Like Run, with a priority class. Pools that do not support priorities run
+  // all closures alike.
+  virtual void RunWithPriority(RunPriority /*priority*/,
+                               absl::AnyInvocable<void()> callback) {
+    Run(std::move(callback));
+  }
+  virtual void RunWithPriority(RunPriority /*priority*/,
+                               EventEngine::Closure* closure) {
+    Run(closure);
+  }
 
 #if GRPC_ENABLE_FORK_SUPPORT
   virtual void PrepareFork() = 0;
@@ -33,11 +33,16 @@
 #include "absl/log/log.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/extensions/run_priority.h"
 #include "src/core/lib/event_engine/thread_local.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
@@ -169,7 +174,15 @@ thread_local WorkQueue* g_local_queue = nullptr;
 // -------- WorkStealingThreadPool --------
 
 WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+    : WorkStealingThreadPool(
+          reserve_threads, &CpuTopology::Get(),
+          grpc_core::ConfigVars::Get().EventEngineThreadPoolPinThreads()) {}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               const CpuTopology* topology,
+                                               bool pin_threads)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(
+          reserve_threads, topology, pin_threads)} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -191,28 +204,123 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
   pool_->Run(closure);
 }
 
+void WorkStealingThreadPool::RunWithPriority(
+    RunPriority priority, absl::AnyInvocable<void()> callback) {
+  RunWithPriority(priority, SelfDeletingClosure::Create(std::move(callback)));
+}
+
+void WorkStealingThreadPool::RunWithPriority(RunPriority priority,
+                                             EventEngine::Closure* closure) {
+  pool_->RunWithPriority(priority, closure);
+}
+
+void WorkStealingThreadPool::TestOnlyDisableGrowthAndStealing() {
+  pool_->DisableGrowthAndStealing();
+}
+
+WorkStealingThreadPool::StealCounts WorkStealingThreadPool::steal_counts()
+    const {
+  return pool_->theft_registry()->steal_counts();
+}
+
+// -------- WorkStealingThreadPool::PriorityQueue --------
+
+void WorkStealingThreadPool::PriorityQueue::Add(EventEngine::Closure* closure) {
+  // Counted first, so that Empty() is never true while the closure is queued.
+  size_.fetch_add(1, std::memory_order_relaxed);
+  queue_.Add(closure);
+}
+
+EventEngine::Closure* WorkStealingThreadPool::PriorityQueue::Pop() {
+  if (Empty()) return nullptr;
+  EventEngine::Closure* closure = queue_.PopOldest();
+  if (closure != nullptr) size_.fetch_sub(1, std::memory_order_relaxed);
+  return closure;
+}
+
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+WorkStealingThreadPool::TheftRegistry::TheftRegistry(
+    const CpuTopology* topology)
+    : topology_(topology), domains_(topology->num_cache_domains()) {
+  for (const auto& cpu : topology_->cpus()) {
+    domains_[cpu.cache_domain].node = cpu.node;
+  }
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t cpu_index) {
+  auto& domain = domains_[topology_->cpus()[cpu_index].cache_domain];
+  grpc_core::MutexLock lock(&domain.mu);
+  domain.queues.emplace(queue);
+  domain.num_queues.store(domain.queues.size(), std::memory_order_relaxed);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
-  grpc_core::MutexLock lock(&mu_);
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t cpu_index) {
+  auto& domain = domains_[topology_->cpus()[cpu_index].cache_domain];
+  grpc_core::MutexLock lock(&domain.mu);
+  domain.queues.erase(queue);
+  domain.num_queues.store(domain.queues.size(), std::memory_order_relaxed);
+}
+
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealFrom(
+    CacheDomain& domain) {
+  if (domain.num_queues.load(std::memory_order_relaxed) == 0) return nullptr;
+  grpc_core::MutexLock lock(&domain.mu);
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
+  // Thieves of Chase-Lev queues take the oldest closures: only the owner of
+  // such a queue may pop its most recent ones.
+  const bool steal_oldest = grpc_core::IsEventEngineChaseLevWorkQueueEnabled();
+  for (auto* queue : domain.queues) {
+    closure = steal_oldest ? queue->PopOldest() : queue->PopMostRecent();
     if (closure != nullptr) return closure;
   }
   return nullptr;
 }
 
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    size_t cpu_index) {
+  const size_t own_domain = topology_->cpus()[cpu_index].cache_domain;
+  const size_t own_node = topology_->cpus()[cpu_index].node;
+  EventEngine::Closure* closure = StealFrom(domains_[own_domain]);
+  if (closure != nullptr) {
+    same_cache_steals_.fetch_add(1, std::memory_order_relaxed);
+    return closure;
+  }
+  // Visit the other domains starting after our own, so that thieves of
+  // different domains do not all go for the same victims first.
+  const size_t num_domains = domains_.size();
+  for (size_t i = 1; i < num_domains; ++i) {
+    auto& domain = domains_[(own_domain + i) % num_domains];
+    if (domain.node != own_node) continue;
+    closure = StealFrom(domain);
+    if (closure != nullptr) {
+      same_node_steals_.fetch_add(1, std::memory_order_relaxed);
+      return closure;
+    }
+  }
+  for (size_t i = 1; i < num_domains; ++i) {
+    auto& domain = domains_[(own_domain + i) % num_domains];
+    if (domain.node == own_node) continue;
+    closure = StealFrom(domain);
+    if (closure != nullptr) {
+      cross_node_steals_.fetch_add(1, std::memory_order_relaxed);
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
+WorkStealingThreadPool::StealCounts
+WorkStealingThreadPool::TheftRegistry::steal_counts() const {
+  StealCounts counts;
+  counts.same_cache = same_cache_steals_.load(std::memory_order_relaxed);
+  counts.same_node = same_node_steals_.load(std::memory_order_relaxed);
+  counts.cross_node = cross_node_steals_.load(std::memory_order_relaxed);
+  return counts;
+}
+
 #if GRPC_ENABLE_FORK_SUPPORT
 
 void WorkStealingThreadPool::PrepareFork() { pool_->PrepareFork(); }
@@ -224,8 +332,14 @@ void WorkStealingThreadPool::PostFork() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, const CpuTopology* topology, bool pin_threads)
+    : reserve_threads_(reserve_threads),
+      topology_(topology),
+      pin_threads_(pin_threads),
+      theft_registry_(topology),
+      queue_(this),
+      latency_sensitive_queue_(this),
+      background_queue_(this) {}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -248,6 +362,32 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   work_signal_.Signal();
 }
 
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::RunWithPriority(
+    RunPriority priority, EventEngine::Closure* closure) {
+  switch (priority) {
+    case RunPriority::kDefault:
+      Run(closure);
+      return;
+    // Prioritized closures go to global queues even when run from a pool
+    // thread: a local queue is drained in LIFO order by its owner only.
+    case RunPriority::kLatencySensitive:
+      CHECK(!IsQuiesced());
+      latency_sensitive_queue_.Add(closure);
+      break;
+    case RunPriority::kBackground:
+      CHECK(!IsQuiesced());
+      background_queue_.Add(closure);
+      break;
+  }
+  work_signal_.Signal();
+}
+
+size_t
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::NextThreadCpuIndex() {
+  return topology_->CpuIndexForThread(
+      threads_placed_.fetch_add(1, std::memory_order_relaxed));
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
   last_started_thread_.store(
       grpc_core::Timestamp::Now().milliseconds_after_process_epoch(),
@@ -280,6 +420,8 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
     DumpStacksAndCrash();
   }
   CHECK(queue_.Empty());
+  CHECK(latency_sensitive_queue_.Empty());
+  CHECK(background_queue_.Empty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -439,13 +581,15 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->queue_.Empty() || !pool_->latency_sensitive_queue_.Empty() ||
+        !pool_->background_queue_.Empty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
     // Idle threads will eventually wake up for an attempt at work stealing.
     return false;
   }
+  if (pool_->growth_and_stealing_disabled()) return false;
   // No new threads if in the throttled state.
   // However, all workers are busy, so the Lifeguard should be more
   // vigilant about checking whether a new thread must be started.
@@ -480,7 +624,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      cpu_index_(pool_->NextThreadCpuIndex()) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -491,12 +636,25 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  if (pool_->pin_threads() &&
+      !pool_->topology()->PinCurrentThread(cpu_index_)) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "Failed to pin thread pool thread to cpu "
+        << pool_->topology()->cpus()[cpu_index_].id;
+  }
+  // The queue is allocated by the worker thread after it was pinned, so that
+  // first-touch NUMA policies place it on the local node.
+  if (grpc_core::IsEventEngineChaseLevWorkQueueEnabled()) {
+    g_local_queue = new ChaseLevWorkQueue(pool_.get());
+  } else {
+    g_local_queue = new BasicWorkQueue(pool_.get());
+  }
+  pool_->theft_registry()->Enroll(g_local_queue, cpu_index_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
   }
+  ThreadLocal::EndClosureBatch();
   // cleanup
   if (pool_->IsForking()) {
     // TODO(hork): consider WorkQueue::AddAll(WorkQueue*)
@@ -511,7 +669,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry()->Unenroll(g_local_queue, cpu_index_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -526,14 +684,22 @@ void WorkStealingThreadPool::ThreadState::SleepIfRunning() {
 
 bool WorkStealingThreadPool::ThreadState::Step() {
   if (pool_->IsForking()) return false;
-  auto* closure = g_local_queue->PopMostRecent();
+  auto* closure = PopPrioritized();
+  if (closure == nullptr) closure = g_local_queue->PopMostRecent();
   // If local work is available, run it.
   if (closure != nullptr) {
     auto busy =
         pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
     closure->Run();
+    // Work deferred to the end of the batch may not wait for the local queue
+    // to drain past its deadline.
+    ThreadLocal::EndClosureBatchIfOverdue();
     return true;
   }
+  // The local queue is drained: this ends the current batch of closures. The
+  // deferred work may have queued more closures locally.
+  ThreadLocal::EndClosureBatch();
+  if (!g_local_queue->Empty()) return true;
   // Thread shutdown exit condition (ignoring fork). All must be true:
   // * shutdown was called
   // * the local queue is empty
@@ -543,17 +709,26 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   auto start_time = std::chrono::steady_clock::now();
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
-    // Pull from the global queue next
+    // Pull from the global queues next
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
     // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
+    closure = pool_->latency_sensitive_queue()->Pop();
+    if (closure == nullptr) closure = pool_->queue()->PopMostRecent();
     if (closure != nullptr) {
       should_run_again = true;
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    if (!pool_->growth_and_stealing_disabled()) {
+      closure = pool_->theft_registry()->StealOne(cpu_index_);
+    }
+    if (closure != nullptr) {
+      should_run_again = true;
+      break;
+    }
+    // Background closures run when there is nothing else to do.
+    closure = PopBackground();
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -581,11 +756,27 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     auto busy =
         pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
     closure->Run();
+    ThreadLocal::EndClosureBatchIfOverdue();
   }
   backoff_.Reset();
   return should_run_again;
 }
 
+EventEngine::Closure* WorkStealingThreadPool::ThreadState::PopPrioritized() {
+  if (closures_since_background_ < kMaxClosuresBeforeBackground) {
+    ++closures_since_background_;
+  } else if (auto* closure = PopBackground()) {
+    return closure;
+  }
+  return pool_->latency_sensitive_queue()->Pop();
+}
+
+EventEngine::Closure* WorkStealingThreadPool::ThreadState::PopBackground() {
+  auto* closure = pool_->background_queue()->Pop();
+  if (closure != nullptr) closures_since_background_ = 0;
+  return closure;
+}
+
 void WorkStealingThreadPool::ThreadState::FinishDraining() {
   // The thread is definitionally busy while draining
   auto busy =
@@ -593,6 +784,13 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
   // If a fork occurs at any point during shutdown, quit draining. The post-fork
   // threads will finish draining the global queue.
   while (!pool_->IsForking()) {
+    if (!pool_->latency_sensitive_queue()->Empty()) {
+      auto* closure = pool_->latency_sensitive_queue()->Pop();
+      if (closure != nullptr) {
+        closure->Run();
+      }
+      continue;
+    }
     if (!g_local_queue->Empty()) {
       auto* closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
@@ -607,8 +805,16 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
       }
       continue;
     }
+    if (!pool_->background_queue()->Empty()) {
+      auto* closure = pool_->background_queue()->Pop();
+      if (closure != nullptr) {
+        closure->Run();
+      }
+      continue;
+    }
     break;
   }
+  ThreadLocal::EndClosureBatch();
 }
 
 // -------- WorkStealingThreadPool::WorkSignal --------
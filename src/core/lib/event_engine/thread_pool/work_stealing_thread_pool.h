@@ -26,10 +26,14 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/extensions/run_priority.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -43,7 +47,23 @@ namespace grpc_event_engine::experimental {
 
 class WorkStealingThreadPool final : public ThreadPool {
  public:
+  // How many closures were stolen, by distance between the thief and the
+  // thread that queued them.
+  struct StealCounts {
+    uint64_t same_cache = 0;
+    uint64_t same_node = 0;
+    uint64_t cross_node = 0;
+  };
+
+  // How many closures a thread runs at most while background closures wait.
+  static constexpr int kMaxClosuresBeforeBackground = 32;
+
+  // Places threads on the CPUs of CpuTopology::Get(), and pins them if the
+  // event_engine_thread_pool_pin_threads config var is set.
   explicit WorkStealingThreadPool(size_t reserve_threads);
+  // topology must outlive the pool.
+  WorkStealingThreadPool(size_t reserve_threads, const CpuTopology* topology,
+                         bool pin_threads);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -52,6 +72,21 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Run must not be called after Quiesce completes
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
+  // Latency sensitive closures run before all others, even those already
+  // queued by the thread that runs them. Background closures run when there
+  // is nothing else to do, and at least once every
+  // kMaxClosuresBeforeBackground closures run by a thread while they wait.
+  void RunWithPriority(RunPriority priority,
+                       absl::AnyInvocable<void()> callback) override;
+  void RunWithPriority(RunPriority priority,
+                       EventEngine::Closure* closure) override;
+
+  StealCounts steal_counts() const;
+
+  // Keeps the pool at its reserve threads, and stops them from stealing
+  // closures from each other, so that tests can observe the order in which a
+  // thread runs closures.
+  void TestOnlyDisableGrowthAndStealing();
 
 #if GRPC_ENABLE_FORK_SUPPORT
   // Forkable
@@ -75,24 +110,63 @@ class WorkStealingThreadPool final : public ThreadPool {
     grpc_core::CondVar cv_ ABSL_GUARDED_BY(mu_);
   };
 
+  // A global queue for the closures of one priority class, whose emptiness
+  // can be checked without taking a lock.
+  class PriorityQueue {
+   public:
+    explicit PriorityQueue(void* owner) : queue_(owner) {}
+    void Add(EventEngine::Closure* closure);
+    // Returns the oldest closure, or nullptr.
+    EventEngine::Closure* Pop();
+    // Never false when a closure is queued.
+    bool Empty() const { return size_.load(std::memory_order_relaxed) == 0; }
+
+   private:
+    BasicWorkQueue queue_;
+    // At least the number of closures in queue_.
+    std::atomic<size_t> size_{0};
+  };
+
   // A pool of WorkQueues that participate in work stealing.
   //
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
   // unavailable.
+  //
+  // Queues are grouped by the last-level cache domain of the CPU their thread
+  // runs on, each group with its own lock. Thieves look at their own cache
+  // domain first, then at the other domains of their NUMA node, and only then
+  // at other nodes, so that closures and the memory they touch tend to stay
+  // close to the thread that queued them.
   class TheftRegistry {
    public:
-    // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    explicit TheftRegistry(const CpuTopology* topology);
+    // Allow any member of the registry to steal from the provided queue, which
+    // belongs to a thread running on the CPU at cpu_index in the topology.
+    void Enroll(WorkQueue* queue, size_t cpu_index);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t cpu_index);
     // Returns one closure from another thread, or nullptr if none are
-    // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    // available. cpu_index is the CPU of the thief.
+    EventEngine::Closure* StealOne(size_t cpu_index);
+    StealCounts steal_counts() const;
 
    private:
-    grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    struct CacheDomain {
+      size_t node;
+      grpc_core::Mutex mu;
+      absl::flat_hash_set<WorkQueue*> queues ABSL_GUARDED_BY(mu);
+      // The size of queues, checked without the lock to skip empty domains.
+      std::atomic<size_t> num_queues{0};
+    };
+
+    EventEngine::Closure* StealFrom(CacheDomain& domain);
+
+    const CpuTopology* const topology_;
+    std::vector<CacheDomain> domains_;
+    std::atomic<uint64_t> same_cache_steals_{0};
+    std::atomic<uint64_t> same_node_steals_{0};
+    std::atomic<uint64_t> cross_node_steals_{0};
   };
 
   // An implementation of the ThreadPool
@@ -102,12 +176,14 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads,
+                               const CpuTopology* topology, bool pin_threads);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
     // available, otherwise the global queue.
     void Run(EventEngine::Closure* closure);
+    void RunWithPriority(RunPriority priority, EventEngine::Closure* closure);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
     // threads created to populate the initial pool are not rate-limited, but
@@ -141,7 +217,22 @@ class WorkStealingThreadPool final : public ThreadPool {
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
+    const CpuTopology* topology() const { return topology_; }
+    bool pin_threads() const { return pin_threads_; }
+    bool growth_and_stealing_disabled() const {
+      return growth_and_stealing_disabled_.load(std::memory_order_relaxed);
+    }
+    void DisableGrowthAndStealing() {
+      growth_and_stealing_disabled_.store(true, std::memory_order_relaxed);
+    }
+    // Returns the index of the CPU in topology() at which to place a new
+    // thread.
+    size_t NextThreadCpuIndex();
     WorkQueue* queue() { return &queue_; }
+    PriorityQueue* latency_sensitive_queue() {
+      return &latency_sensitive_queue_;
+    }
+    PriorityQueue* background_queue() { return &background_queue_; }
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -173,10 +264,16 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const CpuTopology* const topology_;
+    const bool pin_threads_;
+    std::atomic<bool> growth_and_stealing_disabled_{false};
+    std::atomic<size_t> threads_placed_{0};
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
     BasicWorkQueue queue_;
+    PriorityQueue latency_sensitive_queue_;
+    PriorityQueue background_queue_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -207,6 +304,11 @@ class WorkStealingThreadPool final : public ThreadPool {
     void FinishDraining();
 
    private:
+    // Returns a background closure if they waited for too long, otherwise a
+    // latency sensitive closure, or nullptr. Called once per closure run.
+    EventEngine::Closure* PopPrioritized();
+    EventEngine::Closure* PopBackground();
+
     // pool_ must be the first member so that it is alive when the thread count
     // is decremented at time of destruction. This is necessary when this thread
     // state holds the last shared_ptr keeping the pool alive.
@@ -216,6 +318,13 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The CPU the thread is placed at, pinned or not. Its queue is enrolled
+    // in the cache domain of this CPU, and it steals as that CPU, so that the
+    // steal distance counters agree even when an unpinned thread migrates.
+    const size_t cpu_index_;
+    // The closures this thread ran since its last background closure, up to
+    // kMaxClosuresBeforeBackground.
+    int closures_since_background_ = 0;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
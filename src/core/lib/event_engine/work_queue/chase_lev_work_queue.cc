@@ -0,0 +1,113 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// Enough for the closures a thread usually queues between two polls.
+constexpr int64_t kInitialCapacity = 64;
+}  // namespace
+
+// The memory orderings follow Lê et al., except that their fences are folded
+// into sequentially consistent accesses to top_ and bottom_, which costs the
+// same on x86 and is understood by ThreadSanitizer.
+
+ChaseLevWorkQueue::ChaseLevWorkQueue(void* owner) : owner_(owner) {
+  buffers_.push_back(std::make_unique<Buffer>(kInitialCapacity));
+  buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+bool ChaseLevWorkQueue::Empty() const { return Size() == 0; }
+
+size_t ChaseLevWorkQueue::Size() const {
+  int64_t top = top_.load(std::memory_order_relaxed);
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  // A thief or a concurrent PopMostRecent may briefly move top past bottom.
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopMostRecent() {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  // Reserve the last element before looking at top_: a thief that reads
+  // top_ after this sees the reservation and leaves the element to us.
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  if (top > bottom) {
+    // Empty.
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure = buffer->Get(bottom);
+  if (top == bottom) {
+    // The last element: race the thieves for it.
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopOldest() {
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return nullptr;
+  // The element must be read before the CAS: once top_ moved past it, the
+  // owner may overwrite its slot.
+  EventEngine::Closure* closure =
+      buffer_.load(std::memory_order_acquire)->Get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return closure;
+}
+
+void ChaseLevWorkQueue::Add(EventEngine::Closure* closure) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top > buffer->capacity() - 1) {
+    buffer = Grow(buffer, top, bottom);
+  }
+  buffer->Put(bottom, closure);
+  // Publishes the element to thieves.
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+void ChaseLevWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+ChaseLevWorkQueue::Buffer* ChaseLevWorkQueue::Grow(Buffer* buffer,
+                                                   int64_t top,
+                                                   int64_t bottom) {
+  auto grown = std::make_unique<Buffer>(buffer->capacity() * 2);
+  for (int64_t i = top; i < bottom; ++i) grown->Put(i, buffer->Get(i));
+  buffer = grown.get();
+  buffers_.push_back(std::move(grown));
+  buffer_.store(buffer, std::memory_order_release);
+  return buffer;
+}
+
+}  // namespace grpc_event_engine::experimental
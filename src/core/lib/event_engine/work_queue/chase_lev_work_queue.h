@@ -0,0 +1,104 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+
+namespace grpc_event_engine::experimental {
+
+// A lock-free work-stealing deque, after Chase and Lev, "Dynamic Circular
+// Work-Stealing Deque", with the C11 memory orderings of Lê et al., "Correct
+// and Efficient Work-Stealing for Weak Memory Models".
+//
+// Unlike other WorkQueue implementations, only one thread - the owner of the
+// queue - may call Add and PopMostRecent. Both are wait-free. Any thread may
+// call PopOldest, Empty and Size concurrently with the owner. PopOldest
+// returns nullptr when it loses a race with the owner or with another thief.
+//
+// The queue grows as needed and never shrinks. Buffers that were outgrown are
+// kept until the queue is destroyed, since a thief may still be reading them.
+class ChaseLevWorkQueue : public WorkQueue {
+ public:
+  ChaseLevWorkQueue() : ChaseLevWorkQueue(nullptr) {}
+  explicit ChaseLevWorkQueue(void* owner);
+  // Returns whether the queue is empty
+  bool Empty() const override;
+  // Returns the size of the queue. The result may be stale by the time it is
+  // returned if other threads use the queue.
+  size_t Size() const override;
+  // Returns the most recent element from the queue, or nullptr if it is empty.
+  // May only be called by the owner.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element from the queue, or nullptr if it is either
+  // empty or another thread took the element first.
+  //
+  // This method may return nullptr even if the queue is not empty.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue. May only be called by the owner.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue. May only be called by
+  // the owner.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  // A circular buffer with a power of two capacity, indexed by the unbounded
+  // positions top_ and bottom_.
+  class Buffer {
+   public:
+    explicit Buffer(int64_t capacity)
+        : mask_(capacity - 1),
+          slots_(new std::atomic<EventEngine::Closure*>[capacity]) {}
+
+    int64_t capacity() const { return mask_ + 1; }
+    EventEngine::Closure* Get(int64_t i) const {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t i, EventEngine::Closure* closure) {
+      slots_[i & mask_].store(closure, std::memory_order_relaxed);
+    }
+
+   private:
+    const int64_t mask_;
+    std::unique_ptr<std::atomic<EventEngine::Closure*>[]> slots_;
+  };
+
+  // Replaces the buffer with one twice as large holding the elements between
+  // top and bottom. Owner only.
+  Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  // The oldest element is at top_, thieves take from there. The owner adds
+  // and takes at bottom_ - 1. Each is on its own cache line, since thieves
+  // write top_ while the owner writes bottom_.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // All the buffers the queue ever used, current one last. Owner only.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+  const void* const owner_ = nullptr;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
@@ -38,9 +38,27 @@ const char* const additional_constraints_chaotic_good_framing_layer = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_chttp2_endpoint_aware_write_size =
+    "Size chttp2 writes from the endpoint's pacing rate, round trip time and "
+    "unsent bytes as well as from write latency.";
+const char* const additional_constraints_chttp2_endpoint_aware_write_size =
+    "{}";
+const char* const description_chttp2_pack_small_messages =
+    "Copy runs of small gRPC messages into one slice per chttp2 DATA frame "
+    "instead of handing the endpoint a slice per message header and payload.";
+const char* const additional_constraints_chttp2_pack_small_messages = "{}";
+const char* const description_chttp2_weighted_fair_writes =
+    "Share chttp2 connection writes between streams by deficit round robin, "
+    "weighted per call, with small writes served ahead of bulk ones.";
+const char* const additional_constraints_chttp2_weighted_fair_writes = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_chase_lev_work_queue =
+    "Use lock-free Chase-Lev deques instead of mutex protected queues for the "
+    "per-thread queues of the work-stealing thread pool.";
+const char* const additional_constraints_event_engine_chase_lev_work_queue =
+    "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -76,15 +94,49 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_prioritize_io_callbacks =
+    "Run the fd readiness closures and the read and write callbacks of posix "
+    "EventEngine endpoints ahead of other closures on the thread pool.";
+const char* const additional_constraints_event_engine_prioritize_io_callbacks =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use hierarchical timing wheels instead of heaps to hold the pending "
+    "timers of the posix EventEngine.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_timer_wheel_coarse =
+    "Round the deadlines of long posix EventEngine timers up to the "
+    "granularity of their timing wheel level, so that they fire with at most "
+    "1/64 of their timeout of delay and cascade less.";
+const char* const additional_constraints_event_engine_timer_wheel_coarse =
+    "{}";
+const uint8_t required_experiments_event_engine_timer_wheel_coarse[] = {
+    static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineTimerWheel)};
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
 const char* const description_fuse_filters =
     "If set, individual filters are merged into fused filters";
 const char* const additional_constraints_fuse_filters = "{}";
+const char* const description_hpack_adaptive_indexing =
+    "Index application-defined metadata that the HPACK encoder sees "
+    "repeatedly on a connection in the dynamic table, so that it is sent as an "
+    "index afterwards instead of as a literal.";
+const char* const additional_constraints_hpack_adaptive_indexing = "{}";
+const char* const description_hpack_huffman_literals =
+    "Huffman encode the non-binary keys and values of HPACK literals whenever "
+    "that makes them shorter.";
+const char* const additional_constraints_hpack_huffman_literals = "{}";
+const char* const description_hpack_shared_interning =
+    "Share the storage of identical HPACK dynamic table entries decoded by "
+    "different connections, instead of each connection holding its own copy.";
+const char* const additional_constraints_hpack_shared_interning = "{}";
+const char* const description_hpack_zero_copy_parsing =
+    "Let HPACK header values that arrive whole in one read slice reference "
+    "that slice instead of being copied out of it.";
+const char* const additional_constraints_hpack_zero_copy_parsing = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -212,8 +264,25 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"chttp2_endpoint_aware_write_size",
+     description_chttp2_endpoint_aware_write_size,
+     additional_constraints_chttp2_endpoint_aware_write_size,
+     nullptr,
+     0,
+     false,
+     true},
+    {"chttp2_pack_small_messages", description_chttp2_pack_small_messages,
+     additional_constraints_chttp2_pack_small_messages, nullptr, 0, false,
+     true},
+    {"chttp2_weighted_fair_writes", description_chttp2_weighted_fair_writes,
+     additional_constraints_chttp2_weighted_fair_writes, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_chase_lev_work_queue",
+     description_event_engine_chase_lev_work_queue,
+     additional_constraints_event_engine_chase_lev_work_queue, nullptr, 0,
+     false, false},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -233,13 +302,31 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_prioritize_io_callbacks",
+     description_event_engine_prioritize_io_callbacks,
+     additional_constraints_event_engine_prioritize_io_callbacks, nullptr, 0,
+     false, false},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, false},
+    {"event_engine_timer_wheel_coarse",
+     description_event_engine_timer_wheel_coarse,
+     additional_constraints_event_engine_timer_wheel_coarse,
+     required_experiments_event_engine_timer_wheel_coarse, 1, false, false},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"fuse_filters", description_fuse_filters,
      additional_constraints_fuse_filters, nullptr, 0, false, false},
+    {"hpack_adaptive_indexing", description_hpack_adaptive_indexing,
+     additional_constraints_hpack_adaptive_indexing, nullptr, 0, false, true},
+    {"hpack_huffman_literals", description_hpack_huffman_literals,
+     additional_constraints_hpack_huffman_literals, nullptr, 0, false, true},
+    {"hpack_shared_interning", description_hpack_shared_interning,
+     additional_constraints_hpack_shared_interning, nullptr, 0, false, true},
+    {"hpack_zero_copy_parsing", description_hpack_zero_copy_parsing,
+     additional_constraints_hpack_zero_copy_parsing, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -341,9 +428,27 @@ const char* const additional_constraints_chaotic_good_framing_layer = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_chttp2_endpoint_aware_write_size =
+    "Size chttp2 writes from the endpoint's pacing rate, round trip time and "
+    "unsent bytes as well as from write latency.";
+const char* const additional_constraints_chttp2_endpoint_aware_write_size =
+    "{}";
+const char* const description_chttp2_pack_small_messages =
+    "Copy runs of small gRPC messages into one slice per chttp2 DATA frame "
+    "instead of handing the endpoint a slice per message header and payload.";
+const char* const additional_constraints_chttp2_pack_small_messages = "{}";
+const char* const description_chttp2_weighted_fair_writes =
+    "Share chttp2 connection writes between streams by deficit round robin, "
+    "weighted per call, with small writes served ahead of bulk ones.";
+const char* const additional_constraints_chttp2_weighted_fair_writes = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_chase_lev_work_queue =
+    "Use lock-free Chase-Lev deques instead of mutex protected queues for the "
+    "per-thread queues of the work-stealing thread pool.";
+const char* const additional_constraints_event_engine_chase_lev_work_queue =
+    "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -379,15 +484,49 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_prioritize_io_callbacks =
+    "Run the fd readiness closures and the read and write callbacks of posix "
+    "EventEngine endpoints ahead of other closures on the thread pool.";
+const char* const additional_constraints_event_engine_prioritize_io_callbacks =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use hierarchical timing wheels instead of heaps to hold the pending "
+    "timers of the posix EventEngine.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_timer_wheel_coarse =
+    "Round the deadlines of long posix EventEngine timers up to the "
+    "granularity of their timing wheel level, so that they fire with at most "
+    "1/64 of their timeout of delay and cascade less.";
+const char* const additional_constraints_event_engine_timer_wheel_coarse =
+    "{}";
+const uint8_t required_experiments_event_engine_timer_wheel_coarse[] = {
+    static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineTimerWheel)};
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
 const char* const description_fuse_filters =
     "If set, individual filters are merged into fused filters";
 const char* const additional_constraints_fuse_filters = "{}";
+const char* const description_hpack_adaptive_indexing =
+    "Index application-defined metadata that the HPACK encoder sees "
+    "repeatedly on a connection in the dynamic table, so that it is sent as an "
+    "index afterwards instead of as a literal.";
+const char* const additional_constraints_hpack_adaptive_indexing = "{}";
+const char* const description_hpack_huffman_literals =
+    "Huffman encode the non-binary keys and values of HPACK literals whenever "
+    "that makes them shorter.";
+const char* const additional_constraints_hpack_huffman_literals = "{}";
+const char* const description_hpack_shared_interning =
+    "Share the storage of identical HPACK dynamic table entries decoded by "
+    "different connections, instead of each connection holding its own copy.";
+const char* const additional_constraints_hpack_shared_interning = "{}";
+const char* const description_hpack_zero_copy_parsing =
+    "Let HPACK header values that arrive whole in one read slice reference "
+    "that slice instead of being copied out of it.";
+const char* const additional_constraints_hpack_zero_copy_parsing = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -515,8 +654,25 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"chttp2_endpoint_aware_write_size",
+     description_chttp2_endpoint_aware_write_size,
+     additional_constraints_chttp2_endpoint_aware_write_size,
+     nullptr,
+     0,
+     false,
+     true},
+    {"chttp2_pack_small_messages", description_chttp2_pack_small_messages,
+     additional_constraints_chttp2_pack_small_messages, nullptr, 0, false,
+     true},
+    {"chttp2_weighted_fair_writes", description_chttp2_weighted_fair_writes,
+     additional_constraints_chttp2_weighted_fair_writes, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_chase_lev_work_queue",
+     description_event_engine_chase_lev_work_queue,
+     additional_constraints_event_engine_chase_lev_work_queue, nullptr, 0,
+     false, false},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -536,13 +692,31 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_prioritize_io_callbacks",
+     description_event_engine_prioritize_io_callbacks,
+     additional_constraints_event_engine_prioritize_io_callbacks, nullptr, 0,
+     false, false},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, false},
+    {"event_engine_timer_wheel_coarse",
+     description_event_engine_timer_wheel_coarse,
+     additional_constraints_event_engine_timer_wheel_coarse,
+     required_experiments_event_engine_timer_wheel_coarse, 1, false, false},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"fuse_filters", description_fuse_filters,
      additional_constraints_fuse_filters, nullptr, 0, false, false},
+    {"hpack_adaptive_indexing", description_hpack_adaptive_indexing,
+     additional_constraints_hpack_adaptive_indexing, nullptr, 0, false, true},
+    {"hpack_huffman_literals", description_hpack_huffman_literals,
+     additional_constraints_hpack_huffman_literals, nullptr, 0, false, true},
+    {"hpack_shared_interning", description_hpack_shared_interning,
+     additional_constraints_hpack_shared_interning, nullptr, 0, false, true},
+    {"hpack_zero_copy_parsing", description_hpack_zero_copy_parsing,
+     additional_constraints_hpack_zero_copy_parsing, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -644,9 +818,27 @@ const char* const additional_constraints_chaotic_good_framing_layer = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_chttp2_endpoint_aware_write_size =
+    "Size chttp2 writes from the endpoint's pacing rate, round trip time and "
+    "unsent bytes as well as from write latency.";
+const char* const additional_constraints_chttp2_endpoint_aware_write_size =
+    "{}";
+const char* const description_chttp2_pack_small_messages =
+    "Copy runs of small gRPC messages into one slice per chttp2 DATA frame "
+    "instead of handing the endpoint a slice per message header and payload.";
+const char* const additional_constraints_chttp2_pack_small_messages = "{}";
+const char* const description_chttp2_weighted_fair_writes =
+    "Share chttp2 connection writes between streams by deficit round robin, "
+    "weighted per call, with small writes served ahead of bulk ones.";
+const char* const additional_constraints_chttp2_weighted_fair_writes = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
+const char* const description_event_engine_chase_lev_work_queue =
+    "Use lock-free Chase-Lev deques instead of mutex protected queues for the "
+    "per-thread queues of the work-stealing thread pool.";
+const char* const additional_constraints_event_engine_chase_lev_work_queue =
+    "{}";
 const char* const description_event_engine_client =
     "Use EventEngine clients instead of iomgr's grpc_tcp_client";
 const char* const additional_constraints_event_engine_client = "{}";
@@ -682,15 +874,49 @@ const uint8_t required_experiments_event_engine_for_all_other_endpoints[] = {
     static_cast<uint8_t>(
         grpc_core::kExperimentIdEventEngineDnsNonClientChannel),
     static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineListener)};
+const char* const description_event_engine_prioritize_io_callbacks =
+    "Run the fd readiness closures and the read and write callbacks of posix "
+    "EventEngine endpoints ahead of other closures on the thread pool.";
+const char* const additional_constraints_event_engine_prioritize_io_callbacks =
+    "{}";
 const char* const description_event_engine_secure_endpoint =
     "Use EventEngine secure endpoint wrapper instead of iomgr when available";
 const char* const additional_constraints_event_engine_secure_endpoint = "{}";
+const char* const description_event_engine_timer_wheel =
+    "Use hierarchical timing wheels instead of heaps to hold the pending "
+    "timers of the posix EventEngine.";
+const char* const additional_constraints_event_engine_timer_wheel = "{}";
+const char* const description_event_engine_timer_wheel_coarse =
+    "Round the deadlines of long posix EventEngine timers up to the "
+    "granularity of their timing wheel level, so that they fire with at most "
+    "1/64 of their timeout of delay and cascade less.";
+const char* const additional_constraints_event_engine_timer_wheel_coarse =
+    "{}";
+const uint8_t required_experiments_event_engine_timer_wheel_coarse[] = {
+    static_cast<uint8_t>(grpc_core::kExperimentIdEventEngineTimerWheel)};
 const char* const description_free_large_allocator =
     "If set, return all free bytes from a \042big\042 allocator";
 const char* const additional_constraints_free_large_allocator = "{}";
 const char* const description_fuse_filters =
     "If set, individual filters are merged into fused filters";
 const char* const additional_constraints_fuse_filters = "{}";
+const char* const description_hpack_adaptive_indexing =
+    "Index application-defined metadata that the HPACK encoder sees "
+    "repeatedly on a connection in the dynamic table, so that it is sent as an "
+    "index afterwards instead of as a literal.";
+const char* const additional_constraints_hpack_adaptive_indexing = "{}";
+const char* const description_hpack_huffman_literals =
+    "Huffman encode the non-binary keys and values of HPACK literals whenever "
+    "that makes them shorter.";
+const char* const additional_constraints_hpack_huffman_literals = "{}";
+const char* const description_hpack_shared_interning =
+    "Share the storage of identical HPACK dynamic table entries decoded by "
+    "different connections, instead of each connection holding its own copy.";
+const char* const additional_constraints_hpack_shared_interning = "{}";
+const char* const description_hpack_zero_copy_parsing =
+    "Let HPACK header values that arrive whole in one read slice reference "
+    "that slice instead of being copied out of it.";
+const char* const additional_constraints_hpack_zero_copy_parsing = "{}";
 const char* const description_keep_alive_ping_timer_batch =
     "Avoid explicitly cancelling the keepalive timer. Instead adjust the "
     "callback to re-schedule itself to the next ping interval.";
@@ -818,8 +1044,25 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"chttp2_endpoint_aware_write_size",
+     description_chttp2_endpoint_aware_write_size,
+     additional_constraints_chttp2_endpoint_aware_write_size,
+     nullptr,
+     0,
+     false,
+     true},
+    {"chttp2_pack_small_messages", description_chttp2_pack_small_messages,
+     additional_constraints_chttp2_pack_small_messages, nullptr, 0, false,
+     true},
+    {"chttp2_weighted_fair_writes", description_chttp2_weighted_fair_writes,
+     additional_constraints_chttp2_weighted_fair_writes, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
+    {"event_engine_chase_lev_work_queue",
+     description_event_engine_chase_lev_work_queue,
+     additional_constraints_event_engine_chase_lev_work_queue, nullptr, 0,
+     false, false},
     {"event_engine_client", description_event_engine_client,
      additional_constraints_event_engine_client, nullptr, 0, true, false},
     {"event_engine_dns", description_event_engine_dns,
@@ -839,13 +1082,31 @@ const ExperimentMetadata g_experiment_metadata[] = {
      description_event_engine_for_all_other_endpoints,
      additional_constraints_event_engine_for_all_other_endpoints,
      required_experiments_event_engine_for_all_other_endpoints, 4, true, false},
+    {"event_engine_prioritize_io_callbacks",
+     description_event_engine_prioritize_io_callbacks,
+     additional_constraints_event_engine_prioritize_io_callbacks, nullptr, 0,
+     false, false},
     {"event_engine_secure_endpoint", description_event_engine_secure_endpoint,
      additional_constraints_event_engine_secure_endpoint, nullptr, 0, true,
      false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel,
+     additional_constraints_event_engine_timer_wheel, nullptr, 0, false, false},
+    {"event_engine_timer_wheel_coarse",
+     description_event_engine_timer_wheel_coarse,
+     additional_constraints_event_engine_timer_wheel_coarse,
+     required_experiments_event_engine_timer_wheel_coarse, 1, false, false},
     {"free_large_allocator", description_free_large_allocator,
      additional_constraints_free_large_allocator, nullptr, 0, false, true},
     {"fuse_filters", description_fuse_filters,
      additional_constraints_fuse_filters, nullptr, 0, false, false},
+    {"hpack_adaptive_indexing", description_hpack_adaptive_indexing,
+     additional_constraints_hpack_adaptive_indexing, nullptr, 0, false, true},
+    {"hpack_huffman_literals", description_hpack_huffman_literals,
+     additional_constraints_hpack_huffman_literals, nullptr, 0, false, true},
+    {"hpack_shared_interning", description_hpack_shared_interning,
+     additional_constraints_hpack_shared_interning, nullptr, 0, false, true},
+    {"hpack_zero_copy_parsing", description_hpack_zero_copy_parsing,
+     additional_constraints_hpack_zero_copy_parsing, nullptr, 0, false, true},
     {"keep_alive_ping_timer_batch", description_keep_alive_ping_timer_batch,
      additional_constraints_keep_alive_ping_timer_batch, nullptr, 0, false,
      true},
@@ -64,7 +64,11 @@ inline bool IsChannelzUseV2ForV1ServiceEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
 inline bool IsChttp2BoundWriteSizeEnabled() { return false; }
+inline bool IsChttp2EndpointAwareWriteSizeEnabled() { return false; }
+inline bool IsChttp2PackSmallMessagesEnabled() { return false; }
+inline bool IsChttp2WeightedFairWritesEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
+inline bool IsEventEngineChaseLevWorkQueueEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
@@ -78,10 +82,17 @@ inline bool IsEventEngineListenerEnabled() { return true; }
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
+inline bool IsEventEnginePrioritizeIoCallbacksEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() { return true; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineTimerWheelCoarseEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsFuseFiltersEnabled() { return false; }
+inline bool IsHpackAdaptiveIndexingEnabled() { return false; }
+inline bool IsHpackHuffmanLiteralsEnabled() { return false; }
+inline bool IsHpackSharedInterningEnabled() { return false; }
+inline bool IsHpackZeroCopyParsingEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
@@ -119,7 +130,11 @@ inline bool IsChannelzUseV2ForV1ServiceEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
 inline bool IsChttp2BoundWriteSizeEnabled() { return false; }
+inline bool IsChttp2EndpointAwareWriteSizeEnabled() { return false; }
+inline bool IsChttp2PackSmallMessagesEnabled() { return false; }
+inline bool IsChttp2WeightedFairWritesEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
+inline bool IsEventEngineChaseLevWorkQueueEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
@@ -133,10 +148,17 @@ inline bool IsEventEngineListenerEnabled() { return true; }
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
+inline bool IsEventEnginePrioritizeIoCallbacksEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() { return true; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineTimerWheelCoarseEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsFuseFiltersEnabled() { return false; }
+inline bool IsHpackAdaptiveIndexingEnabled() { return false; }
+inline bool IsHpackHuffmanLiteralsEnabled() { return false; }
+inline bool IsHpackSharedInterningEnabled() { return false; }
+inline bool IsHpackZeroCopyParsingEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
@@ -174,7 +196,11 @@ inline bool IsChannelzUseV2ForV1ServiceEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_CHAOTIC_GOOD_FRAMING_LAYER
 inline bool IsChaoticGoodFramingLayerEnabled() { return true; }
 inline bool IsChttp2BoundWriteSizeEnabled() { return false; }
+inline bool IsChttp2EndpointAwareWriteSizeEnabled() { return false; }
+inline bool IsChttp2PackSmallMessagesEnabled() { return false; }
+inline bool IsChttp2WeightedFairWritesEnabled() { return false; }
 inline bool IsErrorFlattenEnabled() { return false; }
+inline bool IsEventEngineChaseLevWorkQueueEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_DNS
@@ -188,10 +214,17 @@ inline bool IsEventEngineListenerEnabled() { return true; }
 inline bool IsEventEngineCallbackCqEnabled() { return true; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_FOR_ALL_OTHER_ENDPOINTS
 inline bool IsEventEngineForAllOtherEndpointsEnabled() { return true; }
+inline bool IsEventEnginePrioritizeIoCallbacksEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() { return true; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsEventEngineTimerWheelCoarseEnabled() { return false; }
 inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsFuseFiltersEnabled() { return false; }
+inline bool IsHpackAdaptiveIndexingEnabled() { return false; }
+inline bool IsHpackHuffmanLiteralsEnabled() { return false; }
+inline bool IsHpackSharedInterningEnabled() { return false; }
+inline bool IsHpackZeroCopyParsingEnabled() { return false; }
 inline bool IsKeepAlivePingTimerBatchEnabled() { return false; }
 inline bool IsLocalConnectorSecureEnabled() { return false; }
 #define GRPC_EXPERIMENT_IS_INCLUDED_MAX_INFLIGHT_PINGS_STRICT_LIMIT
@@ -229,7 +262,11 @@ enum ExperimentIds {
   kExperimentIdChannelzUseV2ForV1Service,
   kExperimentIdChaoticGoodFramingLayer,
   kExperimentIdChttp2BoundWriteSize,
+  kExperimentIdChttp2EndpointAwareWriteSize,
+  kExperimentIdChttp2PackSmallMessages,
+  kExperimentIdChttp2WeightedFairWrites,
   kExperimentIdErrorFlatten,
+  kExperimentIdEventEngineChaseLevWorkQueue,
   kExperimentIdEventEngineClient,
   kExperimentIdEventEngineDns,
   kExperimentIdEventEngineDnsNonClientChannel,
@@ -237,9 +274,16 @@ enum ExperimentIds {
   kExperimentIdEventEngineListener,
   kExperimentIdEventEngineCallbackCq,
   kExperimentIdEventEngineForAllOtherEndpoints,
+  kExperimentIdEventEnginePrioritizeIoCallbacks,
   kExperimentIdEventEngineSecureEndpoint,
+  kExperimentIdEventEngineTimerWheel,
+  kExperimentIdEventEngineTimerWheelCoarse,
   kExperimentIdFreeLargeAllocator,
   kExperimentIdFuseFilters,
+  kExperimentIdHpackAdaptiveIndexing,
+  kExperimentIdHpackHuffmanLiterals,
+  kExperimentIdHpackSharedInterning,
+  kExperimentIdHpackZeroCopyParsing,
   kExperimentIdKeepAlivePingTimerBatch,
   kExperimentIdLocalConnectorSecure,
   kExperimentIdMaxInflightPingsStrictLimit,
@@ -286,10 +330,26 @@ inline bool IsChaoticGoodFramingLayerEnabled() {
 inline bool IsChttp2BoundWriteSizeEnabled() {
   return IsExperimentEnabled<kExperimentIdChttp2BoundWriteSize>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_ENDPOINT_AWARE_WRITE_SIZE
+inline bool IsChttp2EndpointAwareWriteSizeEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2EndpointAwareWriteSize>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_PACK_SMALL_MESSAGES
+inline bool IsChttp2PackSmallMessagesEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2PackSmallMessages>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_WEIGHTED_FAIR_WRITES
+inline bool IsChttp2WeightedFairWritesEnabled() {
+  return IsExperimentEnabled<kExperimentIdChttp2WeightedFairWrites>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_ERROR_FLATTEN
 inline bool IsErrorFlattenEnabled() {
   return IsExperimentEnabled<kExperimentIdErrorFlatten>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CHASE_LEV_WORK_QUEUE
+inline bool IsEventEngineChaseLevWorkQueueEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineChaseLevWorkQueue>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_CLIENT
 inline bool IsEventEngineClientEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineClient>();
@@ -318,10 +378,22 @@ inline bool IsEventEngineCallbackCqEnabled() {
 inline bool IsEventEngineForAllOtherEndpointsEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineForAllOtherEndpoints>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_PRIORITIZE_IO_CALLBACKS
+inline bool IsEventEnginePrioritizeIoCallbacksEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEnginePrioritizeIoCallbacks>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_SECURE_ENDPOINT
 inline bool IsEventEngineSecureEndpointEnabled() {
   return IsExperimentEnabled<kExperimentIdEventEngineSecureEndpoint>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_TIMER_WHEEL
+inline bool IsEventEngineTimerWheelEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineTimerWheel>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_TIMER_WHEEL_COARSE
+inline bool IsEventEngineTimerWheelCoarseEnabled() {
+  return IsExperimentEnabled<kExperimentIdEventEngineTimerWheelCoarse>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_FREE_LARGE_ALLOCATOR
 inline bool IsFreeLargeAllocatorEnabled() {
   return IsExperimentEnabled<kExperimentIdFreeLargeAllocator>();
@@ -330,6 +402,22 @@ inline bool IsFreeLargeAllocatorEnabled() {
 inline bool IsFuseFiltersEnabled() {
   return IsExperimentEnabled<kExperimentIdFuseFilters>();
 }
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_ADAPTIVE_INDEXING
+inline bool IsHpackAdaptiveIndexingEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackAdaptiveIndexing>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_HUFFMAN_LITERALS
+inline bool IsHpackHuffmanLiteralsEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackHuffmanLiterals>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_SHARED_INTERNING
+inline bool IsHpackSharedInterningEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackSharedInterning>();
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_ZERO_COPY_PARSING
+inline bool IsHpackZeroCopyParsingEnabled() {
+  return IsExperimentEnabled<kExperimentIdHpackZeroCopyParsing>();
+}
 #define GRPC_EXPERIMENT_IS_INCLUDED_KEEP_ALIVE_PING_TIMER_BATCH
 inline bool IsKeepAlivePingTimerBatchEnabled() {
   return IsExperimentEnabled<kExperimentIdKeepAlivePingTimerBatch>();
@@ -63,6 +63,16 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+// struct tcp_zerocopy_receive with recv_skip_hint is available since 4.19.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 19, 0)
+#define GRPC_LINUX_TCP_ZEROCOPY_RECEIVE 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 19, 0)
+// The io_uring poller needs multishot poll requests and IORING_FEAT_CQE_SKIP
+// from the kernel headers. Support in the running kernel is checked at
+// runtime.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 17, 0)
+#define GRPC_LINUX_IO_URING 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(5, 17, 0)
 #endif  // LINUX_VERSION_CODE
 #if defined(LINUX_VERSION_CODE) && defined(__GLIBC_PREREQ)
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 9, 0) && __GLIBC_PREREQ(2, 18)
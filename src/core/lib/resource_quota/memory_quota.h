@@ -579,6 +579,11 @@ class MemoryQuota final
   // Resize the quota to new_size.
   void SetSize(size_t new_size) { memory_quota_->SetSize(new_size); }
 
+  // Instantaneous memory pressure in the quota.
+  BasicMemoryQuota::PressureInfo GetPressureInfo() const {
+    return memory_quota_->GetPressureInfo();
+  }
+
   bool IsMemoryPressureHigh() const {
     return memory_quota_->GetPressureInfo().pressure_control_value >
            MemoryOwner::memory_pressure_high_threshold();
@@ -51,6 +51,13 @@ Timestamp BdpEstimator::CompletePing() {
       << " est=" << estimate_ << " dt=" << dt << " bw=" << bw / 125000.0
       << "Mbs bw_est=" << bw_est_ / 125000.0 << "Mbs";
   CHECK(ping_state_ == PingState::STARTED);
+  if (dt > 0) {
+    min_rtt_.Update(
+        static_cast<int64_t>(now.tv_sec) * GPR_MS_PER_SEC +
+            now.tv_nsec / GPR_NS_PER_MS,
+        dt);
+    peak_bw_.Update(++pings_completed_, bw);
+  }
   if (accumulator_ > 2 * estimate_ / 3 && bw > bw_est_) {
     estimate_ = std::max(accumulator_, estimate_ * 2);
     bw_est_ = bw;
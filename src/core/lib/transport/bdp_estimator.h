@@ -23,6 +23,7 @@
 #include <grpc/support/time.h>
 #include <inttypes.h>
 
+#include <functional>
 #include <string>
 
 #include "absl/log/check.h"
@@ -38,8 +39,19 @@ class BdpEstimator {
   explicit BdpEstimator(absl::string_view name);
   ~BdpEstimator() {}
 
+  // How long a ping round trip time is remembered for.
+  static constexpr int64_t kMinRttWindowMillis = 10000;
+  // For how many pings a bandwidth sample is remembered.
+  static constexpr int64_t kPeakBandwidthWindowPings = 10;
+
   int64_t EstimateBdp() const { return estimate_; }
   double EstimateBandwidth() const { return bw_est_; }
+  // Smallest ping round trip time in seconds over the last
+  // kMinRttWindowMillis, or zero if no ping has completed yet.
+  double EstimateRtt() const { return min_rtt_.Get(); }
+  // Largest bandwidth, in bytes per second, measured over any one of the last
+  // kPeakBandwidthWindowPings pings.
+  double EstimatePeakBandwidth() const { return peak_bw_.Get(); }
 
   void AddIncomingBytes(int64_t num_bytes) { accumulator_ += num_bytes; }
 
@@ -75,6 +87,33 @@ class BdpEstimator {
  private:
   enum class PingState { UNSCHEDULED, SCHEDULED, STARTED };
 
+  // Tracks the best value seen over a sliding window of time, as BBR does for
+  // round trip times and bandwidth: besides the best value, it keeps the best
+  // values of the later parts of the window, which take over as older samples
+  // expire. Time can be in any monotonic unit.
+  template <typename Better>
+  class WindowedFilter {
+   public:
+    explicit WindowedFilter(int64_t window) : window_(window) {}
+
+    // The best value over the window, or zero if there is none.
+    double Get() const { return samples_[0].value; }
+
+    void Update(int64_t time, double value);
+
+   private:
+    struct Sample {
+      int64_t time = 0;
+      double value = 0;
+    };
+
+    const int64_t window_;
+    bool empty_ = true;
+    // The best, second best and third best samples, from successively later
+    // parts of the window.
+    Sample samples_[3];
+  };
+
   int64_t accumulator_;
   int64_t estimate_;
   // when was the current ping started?
@@ -83,9 +122,48 @@ class BdpEstimator {
   int stable_estimate_count_;
   PingState ping_state_;
   double bw_est_;
+  WindowedFilter<std::less<double>> min_rtt_{kMinRttWindowMillis};
+  WindowedFilter<std::greater<double>> peak_bw_{kPeakBandwidthWindowPings};
+  int64_t pings_completed_ = 0;
   absl::string_view name_;
 };
 
+template <typename Better>
+void BdpEstimator::WindowedFilter<Better>::Update(int64_t time, double value) {
+  const Sample sample{time, value};
+  Better better;
+  if (empty_ || !better(samples_[0].value, value) ||
+      time - samples_[2].time > window_) {
+    // A new best value, or all samples expired.
+    empty_ = false;
+    samples_[0] = samples_[1] = samples_[2] = sample;
+    return;
+  }
+  if (!better(samples_[1].value, value)) {
+    samples_[1] = samples_[2] = sample;
+  } else if (!better(samples_[2].value, value)) {
+    samples_[2] = sample;
+  }
+  const int64_t age = time - samples_[0].time;
+  if (age > window_) {
+    // The best sample expired: the next ones take over.
+    samples_[0] = samples_[1];
+    samples_[1] = samples_[2];
+    samples_[2] = sample;
+    if (time - samples_[0].time > window_) {
+      samples_[0] = samples_[1];
+      samples_[1] = samples_[2];
+      samples_[2] = sample;
+    }
+  } else if (samples_[1].time == samples_[0].time && age > window_ / 4) {
+    // A quarter of the window passed without a second best sample: take one
+    // from the rest of the window.
+    samples_[1] = samples_[2] = sample;
+  } else if (samples_[2].time == samples_[1].time && age > window_ / 2) {
+    samples_[2] = sample;
+  }
+}
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_TRANSPORT_BDP_ESTIMATOR_H
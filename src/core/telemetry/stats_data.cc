@@ -94,6 +94,20 @@ Histogram_100000_20_64 operator-(const Histogram_100000_20_64& left,
   }
   return result;
 }
+void HistogramCollector_1000000_20_64::Collect(
+    Histogram_1000000_20_64* result) const {
+  for (int i = 0; i < 20; i++) {
+    result->buckets_[i] += buckets_[i].load(std::memory_order_relaxed);
+  }
+}
+Histogram_1000000_20_64 operator-(const Histogram_1000000_20_64& left,
+                                  const Histogram_1000000_20_64& right) {
+  Histogram_1000000_20_64 result;
+  for (int i = 0; i < 20; i++) {
+    result.buckets_[i] = left.buckets_[i] - right.buckets_[i];
+  }
+  return result;
+}
 void HistogramCollector_1800000_40_64::Collect(
     Histogram_1800000_40_64* result) const {
   for (int i = 0; i < 40; i++) {
@@ -162,26 +176,35 @@ const int kStatsTable8[21] = {0,    1,    2,    4,     8,     15,    27,
 const uint8_t kStatsTable9[30] = {3,  3,  4,  4,  5,  6,  6,  7,  7,  8,
                                   9,  9,  10, 10, 11, 11, 12, 13, 13, 14,
                                   15, 15, 16, 16, 17, 17, 18, 19, 19, 20};
-const int kStatsTable10[41] = {
+const int kStatsTable10[9] = {0,    1,     8,      57,      403,
+                              2845, 20079, 141701, 1000000};
+const uint8_t kStatsTable11[9] = {2, 2, 3, 4, 5, 5, 6, 7, 7};
+const int kStatsTable12[21] = {
+    0,     1,     3,     7,      15,     31,     62,
+    124,   248,   496,   991,    1980,   3954,   7896,
+    15769, 31490, 62884, 125576, 250768, 500768, 1000000};
+const uint8_t kStatsTable13[18] = {2,  3,  4,  5,  6,  7,  8,  9,  10,
+                                   11, 12, 13, 14, 15, 16, 17, 18, 19};
+const int kStatsTable14[41] = {
     0,      1,      2,      3,       5,      8,      12,     18,     26,
     37,     53,     76,     108,     153,    217,    308,    436,    617,
     873,    1235,   1748,   2473,    3499,   4950,   7003,   9907,   14015,
     19825,  28044,  39670,  56116,   79379,  112286, 158835, 224680, 317821,
     449574, 635945, 899575, 1272492, 1800000};
-const uint8_t kStatsTable11[37] = {
+const uint8_t kStatsTable15[37] = {
     4,  5,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
     22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39};
-const int kStatsTable12[9] = {0,     1,      11,      119,     1275,
+const int kStatsTable16[9] = {0,     1,      11,      119,     1275,
                               13656, 146259, 1566467, 16777216};
-const uint8_t kStatsTable13[11] = {2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 8};
-const int kStatsTable14[21] = {
+const uint8_t kStatsTable17[11] = {2, 2, 3, 4, 4, 5, 5, 6, 6, 7, 8};
+const int kStatsTable18[21] = {
     0,     1,      3,      8,       19,      45,      106,
     250,   588,    1383,   3252,    7646,    17976,   42262,
     99359, 233593, 549177, 1291113, 3035402, 7136218, 16777216};
-const uint8_t kStatsTable15[23] = {2,  3,  3,  4,  5,  6,  7,  8,
+const uint8_t kStatsTable19[23] = {2,  3,  3,  4,  5,  6,  7,  8,
                                    8,  9,  10, 11, 12, 12, 13, 14,
                                    15, 16, 16, 17, 18, 19, 20};
-const int kStatsTable16[51] = {
+const int kStatsTable20[51] = {
     0,       1,        2,       3,       5,       7,       10,      14,
     20,      28,       39,      54,      75,      104,     144,     200,
     277,     383,      530,     733,     1014,    1402,    1939,    2681,
@@ -189,7 +212,7 @@ const int kStatsTable16[51] = {
     49412,   68303,    94416,   130512,  180408,  249380,  344720,  476509,
     658682,  910501,   1258592, 1739760, 2404882, 3324285, 4595181, 6351949,
     8780340, 12137120, 16777216};
-const uint8_t kStatsTable17[88] = {
+const uint8_t kStatsTable21[88] = {
     4,  4,  5,  5,  6,  6,  7,  7,  8,  8,  9,  9,  10, 11, 11, 12, 12, 13,
     13, 14, 14, 15, 15, 16, 16, 17, 18, 18, 18, 19, 20, 20, 21, 21, 22, 22,
     23, 23, 24, 24, 25, 25, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31, 31, 32,
@@ -303,6 +326,52 @@ int Histogram_100000_20_64::BucketFor(int value) {
     }
   }
 }
+int Histogram_1000000_8_8::BucketFor(int value) {
+  if (value < 2) {
+    if (value < 0) {
+      return 0;
+    } else {
+      return value;
+    }
+  } else {
+    if (value < 131073) {
+      DblUint val;
+      val.dbl = value;
+      const int bucket =
+          kStatsTable11[((val.uint - 4611686018427387904ull) >> 53)];
+      return bucket - (value < kStatsTable10[bucket]);
+    } else {
+      if (value < 141701) {
+        return 6;
+      } else {
+        return 7;
+      }
+    }
+  }
+}
+int Histogram_1000000_20_64::BucketFor(int value) {
+  if (value < 2) {
+    if (value < 0) {
+      return 0;
+    } else {
+      return value;
+    }
+  } else {
+    if (value < 262145) {
+      DblUint val;
+      val.dbl = value;
+      const int bucket =
+          kStatsTable13[((val.uint - 4611686018427387904ull) >> 52)];
+      return bucket - (value < kStatsTable12[bucket]);
+    } else {
+      if (value < 500768) {
+        return 18;
+      } else {
+        return 19;
+      }
+    }
+  }
+}
 int Histogram_1800000_40_64::BucketFor(int value) {
   if (value < 4) {
     if (value < 0) {
@@ -315,8 +384,8 @@ int Histogram_1800000_40_64::BucketFor(int value) {
       DblUint val;
       val.dbl = value;
       const int bucket =
-          kStatsTable11[((val.uint - 4616189618054758400ull) >> 51)];
-      return bucket - (value < kStatsTable10[bucket]);
+          kStatsTable15[((val.uint - 4616189618054758400ull) >> 51)];
+      return bucket - (value < kStatsTable14[bucket]);
     } else {
       if (value < 1272492) {
         return 38;
@@ -338,8 +407,8 @@ int Histogram_16777216_8_8::BucketFor(int value) {
       DblUint val;
       val.dbl = value;
       const int bucket =
-          kStatsTable13[((val.uint - 4611686018427387904ull) >> 53)];
-      return bucket - (value < kStatsTable12[bucket]);
+          kStatsTable17[((val.uint - 4611686018427387904ull) >> 53)];
+      return bucket - (value < kStatsTable16[bucket]);
     } else {
       return 7;
     }
@@ -357,8 +426,8 @@ int Histogram_16777216_20_64::BucketFor(int value) {
       DblUint val;
       val.dbl = value;
       const int bucket =
-          kStatsTable15[((val.uint - 4611686018427387904ull) >> 52)];
-      return bucket - (value < kStatsTable14[bucket]);
+          kStatsTable19[((val.uint - 4611686018427387904ull) >> 52)];
+      return bucket - (value < kStatsTable18[bucket]);
     } else {
       return 19;
     }
@@ -376,8 +445,8 @@ int Histogram_16777216_50_64::BucketFor(int value) {
       DblUint val;
       val.dbl = value;
       const int bucket =
-          kStatsTable17[((val.uint - 4616189618054758400ull) >> 50)];
-      return bucket - (value < kStatsTable16[bucket]);
+          kStatsTable21[((val.uint - 4616189618054758400ull) >> 50)];
+      return bucket - (value < kStatsTable20[bucket]);
     } else {
       return 49;
     }
@@ -461,6 +530,14 @@ const absl::string_view
         "tcp_read_size",
         "tcp_read_offer",
         "tcp_read_offer_iov_size",
+        "tcp_read_alloc_size",
+        "tcp_read_unused_size",
+        "tcp_write_endpoint_delay_us",
+        "tcp_write_stack_delay_us",
+        "tcp_write_qdisc_delay_us",
+        "tcp_write_wire_delay_us",
+        "posix_poller_spin_time_us",
+        "posix_poller_blocked_time_ms",
         "wrr_subchannel_list_size",
         "wrr_subchannel_ready_size",
         "work_serializer_run_time_ms",
@@ -490,6 +567,22 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
+    "Number of bytes of read buffers allocated by the TCP subsystem before "
+    "each read",
+    "Number of bytes of read buffers left unused by the TCP subsystem after "
+    "each completed read",
+    "Number of microseconds a sampled write waited in the posix endpoint "
+    "before its sendmsg",
+    "Number of microseconds a sampled write spent in the TCP stack between its "
+    "sendmsg and reaching the packet scheduler",
+    "Number of microseconds a sampled write spent in the packet scheduler "
+    "before being handed to the network device",
+    "Number of microseconds between a sampled write being handed to the "
+    "network device and its last byte being acknowledged by the peer",
+    "Number of microseconds a busy polling posix EventEngine poller spent "
+    "spinning before it found events or gave up",
+    "Number of milliseconds a busy polling posix EventEngine poller spent "
+    "blocked in epoll_wait after its spin budget ran out",
     "Number of subchannels in a subchannel list at picker creation time",
     "Number of READY subchannels in a subchannel list at picker creation time",
     "Number of milliseconds work serializers run for",
@@ -551,20 +644,44 @@ HistogramView GlobalStats::histogram(Histogram which) const {
       return HistogramView{&Histogram_65536_26_64::BucketFor, kStatsTable6, 26,
                            call_initial_size.buckets()};
     case Histogram::kTcpWriteSize:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, tcp_write_size.buckets()};
     case Histogram::kTcpWriteIovSize:
       return HistogramView{&Histogram_80_10_64::BucketFor, kStatsTable0, 10,
                            tcp_write_iov_size.buckets()};
     case Histogram::kTcpReadSize:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, tcp_read_size.buckets()};
     case Histogram::kTcpReadOffer:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, tcp_read_offer.buckets()};
     case Histogram::kTcpReadOfferIovSize:
       return HistogramView{&Histogram_80_10_64::BucketFor, kStatsTable0, 10,
                            tcp_read_offer_iov_size.buckets()};
+    case Histogram::kTcpReadAllocSize:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
+                           20, tcp_read_alloc_size.buckets()};
+    case Histogram::kTcpReadUnusedSize:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
+                           20, tcp_read_unused_size.buckets()};
+    case Histogram::kTcpWriteEndpointDelayUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable14,
+                           40, tcp_write_endpoint_delay_us.buckets()};
+    case Histogram::kTcpWriteStackDelayUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable14,
+                           40, tcp_write_stack_delay_us.buckets()};
+    case Histogram::kTcpWriteQdiscDelayUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable14,
+                           40, tcp_write_qdisc_delay_us.buckets()};
+    case Histogram::kTcpWriteWireDelayUs:
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable14,
+                           40, tcp_write_wire_delay_us.buckets()};
+    case Histogram::kPosixPollerSpinTimeUs:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable8, 20,
+                           posix_poller_spin_time_us.buckets()};
+    case Histogram::kPosixPollerBlockedTimeMs:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable8, 20,
+                           posix_poller_blocked_time_ms.buckets()};
     case Histogram::kWrrSubchannelListSize:
       return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
                            wrr_subchannel_list_size.buckets()};
@@ -609,22 +726,22 @@ HistogramView GlobalStats::histogram(Histogram which) const {
       return HistogramView{&Histogram_100_20_64::BucketFor, kStatsTable2, 20,
                            chaotic_good_thread_hops_per_read_data.buckets()};
     case Histogram::kChaoticGoodTcpReadSizeData:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, chaotic_good_tcp_read_size_data.buckets()};
     case Histogram::kChaoticGoodTcpReadSizeControl:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, chaotic_good_tcp_read_size_control.buckets()};
     case Histogram::kChaoticGoodTcpReadOfferData:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, chaotic_good_tcp_read_offer_data.buckets()};
     case Histogram::kChaoticGoodTcpReadOfferControl:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, chaotic_good_tcp_read_offer_control.buckets()};
     case Histogram::kChaoticGoodTcpWriteSizeData:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, chaotic_good_tcp_write_size_data.buckets()};
     case Histogram::kChaoticGoodTcpWriteSizeControl:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, chaotic_good_tcp_write_size_control.buckets()};
   }
 }
@@ -691,6 +808,16 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
     data.tcp_read_size.Collect(&result->tcp_read_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
+    data.tcp_read_alloc_size.Collect(&result->tcp_read_alloc_size);
+    data.tcp_read_unused_size.Collect(&result->tcp_read_unused_size);
+    data.tcp_write_endpoint_delay_us.Collect(
+        &result->tcp_write_endpoint_delay_us);
+    data.tcp_write_stack_delay_us.Collect(&result->tcp_write_stack_delay_us);
+    data.tcp_write_qdisc_delay_us.Collect(&result->tcp_write_qdisc_delay_us);
+    data.tcp_write_wire_delay_us.Collect(&result->tcp_write_wire_delay_us);
+    data.posix_poller_spin_time_us.Collect(&result->posix_poller_spin_time_us);
+    data.posix_poller_blocked_time_ms.Collect(
+        &result->posix_poller_blocked_time_ms);
     data.wrr_subchannel_list_size.Collect(&result->wrr_subchannel_list_size);
     data.wrr_subchannel_ready_size.Collect(&result->wrr_subchannel_ready_size);
     data.work_serializer_run_time_ms.Collect(
@@ -782,6 +909,21 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->tcp_read_offer = tcp_read_offer - other.tcp_read_offer;
   result->tcp_read_offer_iov_size =
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
+  result->tcp_read_alloc_size = tcp_read_alloc_size - other.tcp_read_alloc_size;
+  result->tcp_read_unused_size =
+      tcp_read_unused_size - other.tcp_read_unused_size;
+  result->tcp_write_endpoint_delay_us =
+      tcp_write_endpoint_delay_us - other.tcp_write_endpoint_delay_us;
+  result->tcp_write_stack_delay_us =
+      tcp_write_stack_delay_us - other.tcp_write_stack_delay_us;
+  result->tcp_write_qdisc_delay_us =
+      tcp_write_qdisc_delay_us - other.tcp_write_qdisc_delay_us;
+  result->tcp_write_wire_delay_us =
+      tcp_write_wire_delay_us - other.tcp_write_wire_delay_us;
+  result->posix_poller_spin_time_us =
+      posix_poller_spin_time_us - other.posix_poller_spin_time_us;
+  result->posix_poller_blocked_time_ms =
+      posix_poller_blocked_time_ms - other.posix_poller_blocked_time_ms;
   result->wrr_subchannel_list_size =
       wrr_subchannel_list_size - other.wrr_subchannel_list_size;
   result->wrr_subchannel_ready_size =
@@ -841,6 +983,8 @@ const absl::string_view
         "http2_settings_writes", "http2_pings_sent", "http2_transport_stalls",
         "http2_stream_stalls",   "http2_hpack_hits", "http2_hpack_misses",
         "http2_writes_begun",
+        "http2_write_target_burst_limited",
+        "http2_write_target_pacing_raised",
 };
 const absl::string_view
     Http2GlobalStats::counter_doc[static_cast<int>(Counter::COUNT)] = {
@@ -853,6 +997,10 @@ const absl::string_view
         "Number of HPACK cache hits",
         "Number of HPACK cache misses (entries added but never used)",
         "Number of HTTP2 writes initiated",
+        "Number of HTTP2 writes whose target size was lowered so as not to "
+        "queue more than the connection sends in two round trips",
+        "Number of HTTP2 writes whose target size was raised to a quarter of "
+        "what the connection sends per round trip",
 };
 const absl::string_view
     Http2GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -872,6 +1020,10 @@ const absl::string_view
         "http2_write_data_frame_size",
         "http2_read_data_frame_size",
         "http2_write_target_size",
+        "http2_read_parsing_time",
+        "http2_header_decode_time",
+        "http2_write_assembly_time",
+        "http2_endpoint_write_time",
 };
 const absl::string_view Http2GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -892,6 +1044,14 @@ const absl::string_view Http2GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes for each data frame written",
     "Number of bytes for each data frame read",
     "Number of bytes targeted for http2 writes",
+    "Microseconds spent parsing each read from the endpoint, including "
+    "header decoding, when chttp2 phase accounting is enabled",
+    "Microseconds spent decoding each HPACK header block fragment, when "
+    "chttp2 phase accounting is enabled",
+    "Microseconds spent assembling each write from stream and control "
+    "frames, when chttp2 phase accounting is enabled",
+    "Microseconds spent submitting each write to the endpoint, when chttp2 "
+    "phase accounting is enabled",
 };
 Http2GlobalStats::Http2GlobalStats()
     : http2_settings_writes{0},
@@ -900,44 +1060,46 @@ Http2GlobalStats::Http2GlobalStats()
       http2_stream_stalls{0},
       http2_hpack_hits{0},
       http2_hpack_misses{0},
-      http2_writes_begun{0} {}
+      http2_writes_begun{0},
+      http2_write_target_burst_limited{0},
+      http2_write_target_pacing_raised{0} {}
 HistogramView Http2GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
       GPR_UNREACHABLE_CODE(return HistogramView());
     case Histogram::kHttp2SendMessageSize:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, http2_send_message_size.buckets()};
     case Histogram::kHttp2MetadataSize:
       return HistogramView{&Histogram_65536_26_64::BucketFor, kStatsTable6, 26,
                            http2_metadata_size.buckets()};
     case Histogram::kHttp2HpackEntryLifetime:
-      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable10,
+      return HistogramView{&Histogram_1800000_40_64::BucketFor, kStatsTable14,
                            40, http2_hpack_entry_lifetime.buckets()};
     case Histogram::kHttp2HeaderTableSize:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, http2_header_table_size.buckets()};
     case Histogram::kHttp2InitialWindowSize:
-      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
+      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable20,
                            50, http2_initial_window_size.buckets()};
     case Histogram::kHttp2MaxConcurrentStreams:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, http2_max_concurrent_streams.buckets()};
     case Histogram::kHttp2MaxFrameSize:
-      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
+      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable20,
                            50, http2_max_frame_size.buckets()};
     case Histogram::kHttp2MaxHeaderListSize:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, http2_max_header_list_size.buckets()};
     case Histogram::kHttp2PreferredReceiveCryptoMessageSize:
       return HistogramView{
-          &Histogram_16777216_20_64::BucketFor, kStatsTable14, 20,
+          &Histogram_16777216_20_64::BucketFor, kStatsTable18, 20,
           http2_preferred_receive_crypto_message_size.buckets()};
     case Histogram::kHttp2StreamRemoteWindowUpdate:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, http2_stream_remote_window_update.buckets()};
     case Histogram::kHttp2TransportRemoteWindowUpdate:
-      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable18,
                            20, http2_transport_remote_window_update.buckets()};
     case Histogram::kHttp2TransportWindowUpdatePeriod:
       return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable8, 20,
@@ -946,14 +1108,26 @@ HistogramView Http2GlobalStats::histogram(Histogram which) const {
       return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable8, 20,
                            http2_stream_window_update_period.buckets()};
     case Histogram::kHttp2WriteDataFrameSize:
-      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
+      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable20,
                            50, http2_write_data_frame_size.buckets()};
     case Histogram::kHttp2ReadDataFrameSize:
-      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
+      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable20,
                            50, http2_read_data_frame_size.buckets()};
     case Histogram::kHttp2WriteTargetSize:
-      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
+      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable20,
                            50, http2_write_target_size.buckets()};
+    case Histogram::kHttp2ReadParsingTime:
+      return HistogramView{&Histogram_1000000_20_64::BucketFor, kStatsTable12,
+                           20, http2_read_parsing_time.buckets()};
+    case Histogram::kHttp2HeaderDecodeTime:
+      return HistogramView{&Histogram_1000000_20_64::BucketFor, kStatsTable12,
+                           20, http2_header_decode_time.buckets()};
+    case Histogram::kHttp2WriteAssemblyTime:
+      return HistogramView{&Histogram_1000000_20_64::BucketFor, kStatsTable12,
+                           20, http2_write_assembly_time.buckets()};
+    case Histogram::kHttp2EndpointWriteTime:
+      return HistogramView{&Histogram_1000000_20_64::BucketFor, kStatsTable12,
+                           20, http2_endpoint_write_time.buckets()};
   }
 }
 std::unique_ptr<Http2GlobalStats> Http2GlobalStatsCollector::Collect() const {
@@ -973,6 +1147,10 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStatsCollector::Collect() const {
         data.http2_hpack_misses.load(std::memory_order_relaxed);
     result->http2_writes_begun +=
         data.http2_writes_begun.load(std::memory_order_relaxed);
+    result->http2_write_target_burst_limited +=
+        data.http2_write_target_burst_limited.load(std::memory_order_relaxed);
+    result->http2_write_target_pacing_raised +=
+        data.http2_write_target_pacing_raised.load(std::memory_order_relaxed);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
     data.http2_hpack_entry_lifetime.Collect(
@@ -999,6 +1177,12 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStatsCollector::Collect() const {
     data.http2_read_data_frame_size.Collect(
         &result->http2_read_data_frame_size);
     data.http2_write_target_size.Collect(&result->http2_write_target_size);
+    data.http2_read_parsing_time.Collect(&result->http2_read_parsing_time);
+    data.http2_header_decode_time.Collect(&result->http2_header_decode_time);
+    data.http2_write_assembly_time.Collect(
+        &result->http2_write_assembly_time);
+    data.http2_endpoint_write_time.Collect(
+        &result->http2_endpoint_write_time);
   }
   return result;
 }
@@ -1014,6 +1198,10 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStats::Diff(
   result->http2_hpack_hits = http2_hpack_hits - other.http2_hpack_hits;
   result->http2_hpack_misses = http2_hpack_misses - other.http2_hpack_misses;
   result->http2_writes_begun = http2_writes_begun - other.http2_writes_begun;
+  result->http2_write_target_burst_limited =
+      http2_write_target_burst_limited - other.http2_write_target_burst_limited;
+  result->http2_write_target_pacing_raised =
+      http2_write_target_pacing_raised - other.http2_write_target_pacing_raised;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
@@ -1050,23 +1238,52 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStats::Diff(
       http2_read_data_frame_size - other.http2_read_data_frame_size;
   result->http2_write_target_size =
       http2_write_target_size - other.http2_write_target_size;
+  result->http2_read_parsing_time =
+      http2_read_parsing_time - other.http2_read_parsing_time;
+  result->http2_header_decode_time =
+      http2_header_decode_time - other.http2_header_decode_time;
+  result->http2_write_assembly_time =
+      http2_write_assembly_time - other.http2_write_assembly_time;
+  result->http2_endpoint_write_time =
+      http2_endpoint_write_time - other.http2_endpoint_write_time;
   return result;
 }
 const absl::string_view
     Http2Stats::counter_name[static_cast<int>(Counter::COUNT)] = {
         "http2_writes_begun",
+        "http2_write_target_burst_limited",
+        "http2_write_target_pacing_raised",
 };
 const absl::string_view
     Http2Stats::counter_doc[static_cast<int>(Counter::COUNT)] = {
         "Number of HTTP2 writes initiated",
+        "Number of HTTP2 writes whose target size was lowered so as not to "
+        "queue more than the connection sends in two round trips",
+        "Number of HTTP2 writes whose target size was raised to a quarter of "
+        "what the connection sends per round trip",
 };
 const absl::string_view
     Http2Stats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
         "http2_write_target_size",
+        "http2_read_parsing_time",
+        "http2_header_decode_time",
+        "http2_write_assembly_time",
+        "http2_endpoint_write_time",
 };
 const absl::string_view
     Http2Stats::histogram_doc[static_cast<int>(Histogram::COUNT)] = {
         "Number of bytes targeted for http2 writes",
+        "Microseconds spent parsing each read from the endpoint, including "
+        "header decoding, when chttp2 phase accounting is enabled",
+        "Microseconds spent decoding each HPACK header block fragment, when "
+        "chttp2 phase accounting is enabled",
+        "Microseconds spent assembling each write from stream and control "
+        "frames, when chttp2 phase accounting is enabled",
+        "Microseconds spent submitting each write to the endpoint, when chttp2 "
+        "phase accounting is enabled",
 };
-Http2Stats::Http2Stats() : http2_writes_begun{0} {}
+Http2Stats::Http2Stats()
+    : http2_writes_begun{0},
+      http2_write_target_burst_limited{0},
+      http2_write_target_pacing_raised{0} {}
 }  // namespace grpc_core
@@ -167,6 +167,52 @@ class HistogramCollector_100000_20_64 {
  private:
   std::atomic<uint64_t> buckets_[20]{};
 };
+class Histogram_1000000_8_8 {
+ public:
+  static int BucketFor(int value);
+  const uint8_t* buckets() const { return buckets_; }
+  size_t bucket_count() const { return 8; }
+  void Increment(int value) {
+    auto& bucket = buckets_[Histogram_1000000_8_8::BucketFor(value)];
+    if (GPR_UNLIKELY(bucket == std::numeric_limits<uint8_t>::max())) {
+      for (size_t i = 0; i < 8; ++i) {
+        buckets_[i] /= 2;
+      }
+    }
+    ++bucket;
+  }
+
+ private:
+  uint8_t buckets_[8]{};
+};
+class HistogramCollector_1000000_20_64;
+class Histogram_1000000_20_64 {
+ public:
+  static int BucketFor(int value);
+  const uint64_t* buckets() const { return buckets_; }
+  size_t bucket_count() const { return 20; }
+  void Increment(int value) {
+    ++buckets_[Histogram_1000000_20_64::BucketFor(value)];
+  }
+  friend Histogram_1000000_20_64 operator-(
+      const Histogram_1000000_20_64& left,
+      const Histogram_1000000_20_64& right);
+
+ private:
+  friend class HistogramCollector_1000000_20_64;
+  uint64_t buckets_[20]{};
+};
+class HistogramCollector_1000000_20_64 {
+ public:
+  void Increment(int value) {
+    buckets_[Histogram_1000000_20_64::BucketFor(value)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void Collect(Histogram_1000000_20_64* result) const;
+
+ private:
+  std::atomic<uint64_t> buckets_[20]{};
+};
 class HistogramCollector_1800000_40_64;
 class Histogram_1800000_40_64 {
  public:
@@ -310,6 +356,14 @@ struct GlobalStats {
     kTcpReadSize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
+    kTcpReadAllocSize,
+    kTcpReadUnusedSize,
+    kTcpWriteEndpointDelayUs,
+    kTcpWriteStackDelayUs,
+    kTcpWriteQdiscDelayUs,
+    kTcpWriteWireDelayUs,
+    kPosixPollerSpinTimeUs,
+    kPosixPollerBlockedTimeMs,
     kWrrSubchannelListSize,
     kWrrSubchannelReadySize,
     kWorkSerializerRunTimeMs,
@@ -380,6 +434,14 @@ struct GlobalStats {
   Histogram_16777216_20_64 tcp_read_size;
   Histogram_16777216_20_64 tcp_read_offer;
   Histogram_80_10_64 tcp_read_offer_iov_size;
+  Histogram_16777216_20_64 tcp_read_alloc_size;
+  Histogram_16777216_20_64 tcp_read_unused_size;
+  Histogram_1800000_40_64 tcp_write_endpoint_delay_us;
+  Histogram_1800000_40_64 tcp_write_stack_delay_us;
+  Histogram_1800000_40_64 tcp_write_qdisc_delay_us;
+  Histogram_1800000_40_64 tcp_write_wire_delay_us;
+  Histogram_100000_20_64 posix_poller_spin_time_us;
+  Histogram_100000_20_64 posix_poller_blocked_time_ms;
   Histogram_10000_20_64 wrr_subchannel_list_size;
   Histogram_10000_20_64 wrr_subchannel_ready_size;
   Histogram_100000_20_64 work_serializer_run_time_ms;
@@ -526,6 +588,30 @@ class GlobalStatsCollector {
   void IncrementTcpReadOfferIovSize(int value) {
     data_.this_cpu().tcp_read_offer_iov_size.Increment(value);
   }
+  void IncrementTcpReadAllocSize(int value) {
+    data_.this_cpu().tcp_read_alloc_size.Increment(value);
+  }
+  void IncrementTcpReadUnusedSize(int value) {
+    data_.this_cpu().tcp_read_unused_size.Increment(value);
+  }
+  void IncrementTcpWriteEndpointDelayUs(int value) {
+    data_.this_cpu().tcp_write_endpoint_delay_us.Increment(value);
+  }
+  void IncrementTcpWriteStackDelayUs(int value) {
+    data_.this_cpu().tcp_write_stack_delay_us.Increment(value);
+  }
+  void IncrementTcpWriteQdiscDelayUs(int value) {
+    data_.this_cpu().tcp_write_qdisc_delay_us.Increment(value);
+  }
+  void IncrementTcpWriteWireDelayUs(int value) {
+    data_.this_cpu().tcp_write_wire_delay_us.Increment(value);
+  }
+  void IncrementPosixPollerSpinTimeUs(int value) {
+    data_.this_cpu().posix_poller_spin_time_us.Increment(value);
+  }
+  void IncrementPosixPollerBlockedTimeMs(int value) {
+    data_.this_cpu().posix_poller_blocked_time_ms.Increment(value);
+  }
   void IncrementWrrSubchannelListSize(int value) {
     data_.this_cpu().wrr_subchannel_list_size.Increment(value);
   }
@@ -628,6 +714,14 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20_64 tcp_read_size;
     HistogramCollector_16777216_20_64 tcp_read_offer;
     HistogramCollector_80_10_64 tcp_read_offer_iov_size;
+    HistogramCollector_16777216_20_64 tcp_read_alloc_size;
+    HistogramCollector_16777216_20_64 tcp_read_unused_size;
+    HistogramCollector_1800000_40_64 tcp_write_endpoint_delay_us;
+    HistogramCollector_1800000_40_64 tcp_write_stack_delay_us;
+    HistogramCollector_1800000_40_64 tcp_write_qdisc_delay_us;
+    HistogramCollector_1800000_40_64 tcp_write_wire_delay_us;
+    HistogramCollector_100000_20_64 posix_poller_spin_time_us;
+    HistogramCollector_100000_20_64 posix_poller_blocked_time_ms;
     HistogramCollector_10000_20_64 wrr_subchannel_list_size;
     HistogramCollector_10000_20_64 wrr_subchannel_ready_size;
     HistogramCollector_100000_20_64 work_serializer_run_time_ms;
@@ -663,6 +757,8 @@ struct Http2GlobalStats {
     kHttp2HpackHits,
     kHttp2HpackMisses,
     kHttp2WritesBegun,
+    kHttp2WriteTargetBurstLimited,
+    kHttp2WriteTargetPacingRaised,
     COUNT
   };
   enum class Histogram {
@@ -682,6 +778,10 @@ struct Http2GlobalStats {
     kHttp2WriteDataFrameSize,
     kHttp2ReadDataFrameSize,
     kHttp2WriteTargetSize,
+    kHttp2ReadParsingTime,
+    kHttp2HeaderDecodeTime,
+    kHttp2WriteAssemblyTime,
+    kHttp2EndpointWriteTime,
     COUNT
   };
   Http2GlobalStats();
@@ -700,6 +800,8 @@ struct Http2GlobalStats {
       uint64_t http2_hpack_hits;
       uint64_t http2_hpack_misses;
       uint64_t http2_writes_begun;
+      uint64_t http2_write_target_burst_limited;
+      uint64_t http2_write_target_pacing_raised;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -719,6 +821,10 @@ struct Http2GlobalStats {
   Histogram_16777216_50_64 http2_write_data_frame_size;
   Histogram_16777216_50_64 http2_read_data_frame_size;
   Histogram_16777216_50_64 http2_write_target_size;
+  Histogram_1000000_20_64 http2_read_parsing_time;
+  Histogram_1000000_20_64 http2_header_decode_time;
+  Histogram_1000000_20_64 http2_write_assembly_time;
+  Histogram_1000000_20_64 http2_endpoint_write_time;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<Http2GlobalStats> Diff(const Http2GlobalStats& other) const;
 };
@@ -751,6 +857,14 @@ class Http2GlobalStatsCollector {
   void IncrementHttp2WritesBegun() {
     data_.this_cpu().http2_writes_begun.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementHttp2WriteTargetBurstLimited() {
+    data_.this_cpu().http2_write_target_burst_limited.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WriteTargetPacingRaised() {
+    data_.this_cpu().http2_write_target_pacing_raised.fetch_add(
+        1, std::memory_order_relaxed);
+  }
 
  public:
   void IncrementHttp2SendMessageSize(int value) {
@@ -804,6 +918,18 @@ class Http2GlobalStatsCollector {
   void IncrementHttp2WriteTargetSize(int value) {
     data_.this_cpu().http2_write_target_size.Increment(value);
   }
+  void IncrementHttp2ReadParsingTime(int value) {
+    data_.this_cpu().http2_read_parsing_time.Increment(value);
+  }
+  void IncrementHttp2HeaderDecodeTime(int value) {
+    data_.this_cpu().http2_header_decode_time.Increment(value);
+  }
+  void IncrementHttp2WriteAssemblyTime(int value) {
+    data_.this_cpu().http2_write_assembly_time.Increment(value);
+  }
+  void IncrementHttp2EndpointWriteTime(int value) {
+    data_.this_cpu().http2_endpoint_write_time.Increment(value);
+  }
   friend class GlobalStatsCollector;
   friend class Http2StatsCollector;
   struct Data {
@@ -814,6 +940,8 @@ class Http2GlobalStatsCollector {
     std::atomic<uint64_t> http2_hpack_hits{0};
     std::atomic<uint64_t> http2_hpack_misses{0};
     std::atomic<uint64_t> http2_writes_begun{0};
+    std::atomic<uint64_t> http2_write_target_burst_limited{0};
+    std::atomic<uint64_t> http2_write_target_pacing_raised{0};
     HistogramCollector_16777216_20_64 http2_send_message_size;
     HistogramCollector_65536_26_64 http2_metadata_size;
     HistogramCollector_1800000_40_64 http2_hpack_entry_lifetime;
@@ -831,6 +959,10 @@ class Http2GlobalStatsCollector {
     HistogramCollector_16777216_50_64 http2_write_data_frame_size;
     HistogramCollector_16777216_50_64 http2_read_data_frame_size;
     HistogramCollector_16777216_50_64 http2_write_target_size;
+    HistogramCollector_1000000_20_64 http2_read_parsing_time;
+    HistogramCollector_1000000_20_64 http2_header_decode_time;
+    HistogramCollector_1000000_20_64 http2_write_assembly_time;
+    HistogramCollector_1000000_20_64 http2_endpoint_write_time;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
@@ -838,8 +970,20 @@ inline Http2GlobalStatsCollector& http2_global_stats() {
   return *NoDestructSingleton<Http2GlobalStatsCollector>::Get();
 }
 struct Http2Stats {
-  enum class Counter { kHttp2WritesBegun, COUNT };
-  enum class Histogram { kHttp2WriteTargetSize, COUNT };
+  enum class Counter {
+    kHttp2WritesBegun,
+    kHttp2WriteTargetBurstLimited,
+    kHttp2WriteTargetPacingRaised,
+    COUNT
+  };
+  enum class Histogram {
+    kHttp2WriteTargetSize,
+    kHttp2ReadParsingTime,
+    kHttp2HeaderDecodeTime,
+    kHttp2WriteAssemblyTime,
+    kHttp2EndpointWriteTime,
+    COUNT
+  };
   Http2Stats();
   static const absl::string_view counter_name[static_cast<int>(Counter::COUNT)];
   static const absl::string_view
@@ -850,10 +994,16 @@ struct Http2Stats {
   union {
     struct {
       uint64_t http2_writes_begun;
+      uint64_t http2_write_target_burst_limited;
+      uint64_t http2_write_target_pacing_raised;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
   Histogram_16777216_8_8 http2_write_target_size;
+  Histogram_1000000_8_8 http2_read_parsing_time;
+  Histogram_1000000_8_8 http2_header_decode_time;
+  Histogram_1000000_8_8 http2_write_assembly_time;
+  Histogram_1000000_8_8 http2_endpoint_write_time;
 };
 class Http2StatsCollector {
  public:
@@ -880,6 +1030,14 @@ class Http2StatsCollector {
     ++data_.http2_writes_begun;
     http2_global_stats().IncrementHttp2WritesBegun();
   }
+  void IncrementHttp2WriteTargetBurstLimited() {
+    ++data_.http2_write_target_burst_limited;
+    http2_global_stats().IncrementHttp2WriteTargetBurstLimited();
+  }
+  void IncrementHttp2WriteTargetPacingRaised() {
+    ++data_.http2_write_target_pacing_raised;
+    http2_global_stats().IncrementHttp2WriteTargetPacingRaised();
+  }
   void IncrementHttp2SendMessageSize(int value) {
     http2_global_stats().IncrementHttp2SendMessageSize(value);
   }
@@ -929,6 +1087,22 @@ class Http2StatsCollector {
     data_.http2_write_target_size.Increment(value);
     http2_global_stats().IncrementHttp2WriteTargetSize(value);
   }
+  void IncrementHttp2ReadParsingTime(int value) {
+    data_.http2_read_parsing_time.Increment(value);
+    http2_global_stats().IncrementHttp2ReadParsingTime(value);
+  }
+  void IncrementHttp2HeaderDecodeTime(int value) {
+    data_.http2_header_decode_time.Increment(value);
+    http2_global_stats().IncrementHttp2HeaderDecodeTime(value);
+  }
+  void IncrementHttp2WriteAssemblyTime(int value) {
+    data_.http2_write_assembly_time.Increment(value);
+    http2_global_stats().IncrementHttp2WriteAssemblyTime(value);
+  }
+  void IncrementHttp2EndpointWriteTime(int value) {
+    data_.http2_endpoint_write_time.Increment(value);
+    http2_global_stats().IncrementHttp2EndpointWriteTime(value);
+  }
 
  private:
   Http2Stats data_;
@@ -159,8 +159,10 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/hpack_encoder_table.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parse_result.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser.cc',
+    'src/core/ext/transport/chttp2/transport/hpack_parser_interner.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
     'src/core/ext/transport/chttp2/transport/http2_client_transport.cc',
+    'src/core/ext/transport/chttp2/transport/http2_server_transport.cc',
     'src/core/ext/transport/chttp2/transport/http2_settings.cc',
     'src/core/ext/transport/chttp2/transport/http2_settings_manager.cc',
     'src/core/ext/transport/chttp2/transport/http2_stats_collector.cc',
@@ -168,6 +170,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/huffsyms.cc',
     'src/core/ext/transport/chttp2/transport/keepalive.cc',
     'src/core/ext/transport/chttp2/transport/parsing.cc',
+    'src/core/ext/transport/chttp2/transport/phase_accounting.cc',
     'src/core/ext/transport/chttp2/transport/ping_abuse_policy.cc',
     'src/core/ext/transport/chttp2/transport/ping_callbacks.cc',
     'src/core/ext/transport/chttp2/transport/ping_promise.cc',
@@ -175,6 +178,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/stream_lists.cc',
     'src/core/ext/transport/chttp2/transport/transport_common.cc',
     'src/core/ext/transport/chttp2/transport/varint.cc',
+    'src/core/ext/transport/chttp2/transport/write_deficit.cc',
     'src/core/ext/transport/chttp2/transport/write_size_policy.cc',
     'src/core/ext/transport/chttp2/transport/writing.cc',
     'src/core/ext/transport/inproc/inproc_transport.cc',
@@ -547,7 +551,9 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/default_event_engine_factory.cc',
     'src/core/lib/event_engine/endpoint_channel_arg_wrapper.cc',
     'src/core/lib/event_engine/event_engine.cc',
+    'src/core/lib/event_engine/posix_engine/accept_admission_control.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/file_descriptor_collection.cc',
@@ -566,16 +572,19 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.cc',
+    'src/core/lib/event_engine/posix_engine/write_latency_sampler.cc',
     'src/core/lib/event_engine/resolved_address.cc',
     'src/core/lib/event_engine/shim.cc',
     'src/core/lib/event_engine/slice.cc',
     'src/core/lib/event_engine/slice_buffer.cc',
     'src/core/lib/event_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/thread_local.cc',
+    'src/core/lib/event_engine/thread_pool/cpu_topology.cc',
     'src/core/lib/event_engine/thread_pool/thread_count.cc',
     'src/core/lib/event_engine/thread_pool/thread_pool_factory.cc',
     'src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc',
@@ -590,6 +599,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
@@ -241,6 +241,47 @@ TEST_F(ClientChannelParserTest, InvalidWaitForReady) {
       << service_config.status();
 }
 
+TEST_F(ClientChannelParserTest, ValidWriteWeight) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"writeWeight\": 4\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  auto parsed_config = static_cast<internal::ClientChannelMethodParsedConfig*>(
+      ((*vector_ptr)[parser_index_]).get());
+  EXPECT_EQ(parsed_config->write_weight(), 4);
+}
+
+TEST_F(ClientChannelParserTest, InvalidWriteWeight) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"method\" }\n"
+      "    ],\n"
+      "    \"writeWeight\": -1\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].writeWeight error:failed to parse "
+            "non-negative number]")
+      << service_config.status();
+}
+
 TEST_F(ClientChannelParserTest, ValidHealthCheck) {
   const char* test_json =
       "{\n"
@@ -0,0 +1,82 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/accept_admission_control.h"
+
+#include "gtest/gtest.h"
+
+namespace grpc_event_engine::experimental {
+
+TEST(AcceptAdmissionControlTest, UnlimitedWithoutPressure) {
+  AcceptAdmissionControl control(nullptr, 0);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(control.ShouldAccept());
+    control.OnConnectionAccepted();
+  }
+  EXPECT_EQ(control.live_connections(), 1000);
+  EXPECT_FALSE(control.paused());
+}
+
+TEST(AcceptAdmissionControlTest, PausesAtConnectionLimit) {
+  AcceptAdmissionControl control(nullptr, 20);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(control.ShouldAccept());
+    control.OnConnectionAccepted();
+  }
+  EXPECT_FALSE(control.ShouldAccept());
+  EXPECT_TRUE(control.paused());
+  // Closing a single connection is not enough to resume.
+  control.OnConnectionClosed();
+  EXPECT_FALSE(control.ShouldAccept());
+  // Resumes once a tenth of the connections have been closed.
+  control.OnConnectionClosed();
+  EXPECT_TRUE(control.ShouldAccept());
+  EXPECT_FALSE(control.paused());
+}
+
+TEST(AcceptAdmissionControlTest, ResumesBelowLimitOfOne) {
+  AcceptAdmissionControl control(nullptr, 1);
+  ASSERT_TRUE(control.ShouldAccept());
+  control.OnConnectionAccepted();
+  EXPECT_FALSE(control.ShouldAccept());
+  control.OnConnectionClosed();
+  EXPECT_TRUE(control.ShouldAccept());
+}
+
+TEST(AcceptAdmissionControlTest, MemoryPressureHysteresis) {
+  AcceptAdmissionControl control(nullptr, 0);
+  EXPECT_TRUE(control.ShouldAcceptAt(0.95));
+  EXPECT_FALSE(control.ShouldAcceptAt(1.0));
+  EXPECT_TRUE(control.paused());
+  // Pressure that would not have paused does not resume either.
+  EXPECT_FALSE(control.ShouldAcceptAt(0.95));
+  EXPECT_TRUE(control.ShouldAcceptAt(0.5));
+  EXPECT_FALSE(control.paused());
+}
+
+TEST(AcceptAdmissionControlTest, ResumesOnlyWhenBothRecover) {
+  AcceptAdmissionControl control(nullptr, 10);
+  for (int i = 0; i < 10; ++i) control.OnConnectionAccepted();
+  EXPECT_FALSE(control.ShouldAcceptAt(1.0));
+  for (int i = 0; i < 5; ++i) control.OnConnectionClosed();
+  EXPECT_FALSE(control.ShouldAcceptAt(0.95));
+  EXPECT_TRUE(control.ShouldAcceptAt(0.1));
+}
+
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
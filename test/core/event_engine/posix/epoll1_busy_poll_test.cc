@@ -0,0 +1,156 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/event_engine/posix/posix_engine_test_utils.h"
+
+#ifdef GRPC_LINUX_EPOLL
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using namespace std::chrono_literals;
+
+class Epoll1BusyPollTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    if (poller_ != nullptr) poller_->Close();
+    grpc_core::ConfigVars::SetOverrides({});
+  }
+
+  // Creates a poller that spins for busy_poll before blocking, or skips the
+  // test if epoll is not available.
+  bool MakePoller(std::chrono::microseconds busy_poll) {
+    grpc_core::ConfigVars::Overrides overrides;
+    overrides.posix_poller_busy_poll_us =
+        static_cast<int32_t>(busy_poll.count());
+    grpc_core::ConfigVars::SetOverrides(overrides);
+    poller_ = MakeEpoll1Poller(&scheduler_);
+    return poller_ != nullptr;
+  }
+
+  TestScheduler scheduler_;
+  std::shared_ptr<Epoll1Poller> poller_;
+};
+
+// A kick that arrives while spinning ends Work() without waiting for the rest
+// of the spin budget.
+TEST_F(Epoll1BusyPollTest, KickWhileSpinningReturnsKicked) {
+  if (!MakePoller(10s)) GTEST_SKIP();
+  std::thread kicker([this]() {
+    std::this_thread::sleep_for(100ms);
+    poller_->Kick();
+  });
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller_->Work(1h, []() {}), Poller::WorkResult::kKicked);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+  kicker.join();
+  // The kick was consumed: the next Work() call waits for its timeout.
+  EXPECT_EQ(poller_->Work(10ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+}
+
+// A kick that arrives once the spin budget is used up goes through the wakeup
+// fd, and still wakes up the blocking epoll_wait.
+TEST_F(Epoll1BusyPollTest, KickWhileBlockedReturnsKicked) {
+  if (!MakePoller(1ms)) GTEST_SKIP();
+  std::thread kicker([this]() {
+    std::this_thread::sleep_for(100ms);
+    poller_->Kick();
+  });
+  EXPECT_EQ(poller_->Work(1h, []() {}), Poller::WorkResult::kKicked);
+  kicker.join();
+}
+
+// An fd that becomes readable while spinning is reported by that Work() call.
+TEST_F(Epoll1BusyPollTest, EventWhileSpinningIsProcessed) {
+  if (!MakePoller(10s)) GTEST_SKIP();
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+  EventHandle* handle = poller_->CreateHandle(
+      poller_->posix_interface().Adopt(sv[0]), "test", false);
+  std::atomic<bool> readable{false};
+  PosixEngineClosure on_read(
+      [&readable](absl::Status status) {
+        EXPECT_TRUE(status.ok()) << status;
+        readable.store(true, std::memory_order_relaxed);
+      },
+      /*is_permanent=*/false);
+  handle->NotifyOnRead(&on_read);
+  std::thread writer([&sv]() {
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(write(sv[1], "x", 1), 1);
+  });
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller_->Work(1h, []() {}), Poller::WorkResult::kOk);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+  EXPECT_TRUE(readable.load(std::memory_order_relaxed));
+  writer.join();
+  handle->OrphanHandle(nullptr, nullptr, "test done");
+  close(sv[1]);
+}
+
+// The spin budget is capped by the Work() timeout, and Work() blocks for the
+// rest of the timeout once the budget is used up. epoll_wait() truncates its
+// timeout to milliseconds, hence the slack on the blocking case.
+TEST_F(Epoll1BusyPollTest, WorkTimesOut) {
+  if (!MakePoller(10s)) GTEST_SKIP();
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller_->Work(50ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, 50ms);
+  EXPECT_LT(elapsed, 5s);
+  ASSERT_TRUE(MakePoller(10ms));
+  start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller_->Work(100ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 99ms);
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
+
+#else  // GRPC_LINUX_EPOLL
+
+int main(int /*argc*/, char** /*argv*/) { return 0; }
+
+#endif  // GRPC_LINUX_EPOLL
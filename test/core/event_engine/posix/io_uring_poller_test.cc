@@ -0,0 +1,172 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/event_engine/posix/posix_engine_test_utils.h"
+
+#ifdef GRPC_LINUX_IO_URING
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using namespace std::chrono_literals;
+
+class IoUringPollerTest : public ::testing::Test {
+ protected:
+  // Creates a poller with a submission queue of sq_entries, or skips the test
+  // if the running kernel doesn't support the io_uring poller.
+  std::shared_ptr<IoUringPoller> MakePoller(
+      unsigned sq_entries = IoUringPoller::kDefaultSqEntries) {
+    auto poller = MakeIoUringPoller(&scheduler_, sq_entries);
+    if (poller == nullptr) {
+      LOG(INFO) << "io_uring is not supported by the running kernel";
+    }
+    return poller;
+  }
+
+  TestScheduler scheduler_;
+};
+
+// Polls until pred() holds or the deadline passes.
+template <typename Pred>
+bool PollUntil(IoUringPoller* poller, Pred pred) {
+  auto deadline = std::chrono::steady_clock::now() + 30s;
+  while (!pred()) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    poller->Work(100ms, []() {});
+  }
+  return true;
+}
+
+TEST_F(IoUringPollerTest, KickWakesUpWork) {
+  auto poller = MakePoller();
+  if (poller == nullptr) GTEST_SKIP();
+  std::thread kicker([&poller]() {
+    std::this_thread::sleep_for(100ms);
+    poller->Kick();
+  });
+  EXPECT_EQ(poller->Work(1h, []() {}), Poller::WorkResult::kKicked);
+  kicker.join();
+  poller->Close();
+}
+
+TEST_F(IoUringPollerTest, WorkTimesOut) {
+  auto poller = MakePoller();
+  if (poller == nullptr) GTEST_SKIP();
+  EXPECT_EQ(poller->Work(10ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  poller->Close();
+}
+
+// Registers many more handles than there are submission queue entries, in one
+// burst: none of the poll requests may be dropped, so every handle must be
+// notified once its socket becomes readable.
+TEST_F(IoUringPollerTest, NoRegistrationIsLostWhenSubmissionQueueIsSmall) {
+  static constexpr int kNumHandles = 200;
+  auto poller = MakePoller(/*sq_entries=*/2);
+  if (poller == nullptr) GTEST_SKIP();
+  std::atomic<int> num_readable{0};
+  std::vector<int> peers;
+  std::vector<EventHandle*> handles;
+  std::vector<std::unique_ptr<PosixEngineClosure>> closures;
+  for (int i = 0; i < kNumHandles; ++i) {
+    int sv[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+    peers.push_back(sv[1]);
+    EventHandle* handle = poller->CreateHandle(
+        poller->posix_interface().Adopt(sv[0]), "test", false);
+    handles.push_back(handle);
+    closures.push_back(std::make_unique<PosixEngineClosure>(
+        [&num_readable](absl::Status status) {
+          EXPECT_TRUE(status.ok()) << status;
+          num_readable.fetch_add(1, std::memory_order_relaxed);
+        },
+        /*is_permanent=*/false));
+    handle->NotifyOnRead(closures.back().get());
+  }
+  for (int peer : peers) {
+    ASSERT_EQ(write(peer, "x", 1), 1);
+  }
+  EXPECT_TRUE(PollUntil(poller.get(), [&num_readable]() {
+    return num_readable.load(std::memory_order_relaxed) == kNumHandles;
+  }));
+  for (EventHandle* handle : handles) {
+    handle->OrphanHandle(nullptr, nullptr, "test done");
+  }
+  for (int peer : peers) close(peer);
+  poller->Close();
+}
+
+TEST_F(IoUringPollerTest, OrphanedHandlesAreRecycled) {
+  auto poller = MakePoller();
+  if (poller == nullptr) GTEST_SKIP();
+  for (int round = 0; round < 10; ++round) {
+    int sv[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv), 0);
+    EventHandle* handle = poller->CreateHandle(
+        poller->posix_interface().Adopt(sv[0]), "test", false);
+    std::atomic<bool> readable{false};
+    PosixEngineClosure on_read(
+        [&readable](absl::Status status) {
+          EXPECT_TRUE(status.ok()) << status;
+          readable.store(true, std::memory_order_relaxed);
+        },
+        /*is_permanent=*/false);
+    handle->NotifyOnRead(&on_read);
+    ASSERT_EQ(write(sv[1], "x", 1), 1);
+    EXPECT_TRUE(PollUntil(poller.get(), [&readable]() {
+      return readable.load(std::memory_order_relaxed);
+    }));
+    handle->OrphanHandle(nullptr, nullptr, "test done");
+    close(sv[1]);
+  }
+  poller->Close();
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
+
+#else  // GRPC_LINUX_IO_URING
+
+int main(int /*argc*/, char** /*argv*/) { return 0; }
+
+#endif  // GRPC_LINUX_IO_URING
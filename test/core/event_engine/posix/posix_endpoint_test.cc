@@ -15,10 +15,17 @@
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/support/alloc.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
@@ -44,6 +51,7 @@
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/notification.h"
@@ -326,6 +334,223 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
+namespace {
+
+int g_num_freed_slices = 0;
+
+Slice MakeCountedSlice(size_t length) {
+  void* bytes = gpr_malloc(length);
+  return Slice(grpc_slice_new_with_user_data(
+      bytes, length,
+      [](void* p) {
+        ++g_num_freed_slices;
+        gpr_free(p);
+      },
+      bytes));
+}
+
+}  // namespace
+
+TEST(TrimTrailingSlicesTest, ReleasesOnlyWholeSlices) {
+  g_num_freed_slices = 0;
+  SliceBuffer buf;
+  for (int i = 0; i < 4; ++i) buf.AppendIndexed(MakeCountedSlice(1024));
+  // Releasing part of the second slice would free nothing, so it is kept
+  // whole.
+  TrimTrailingSlices(buf, 1500);
+  EXPECT_EQ(buf.Length(), 2048u);
+  EXPECT_EQ(g_num_freed_slices, 2);
+  TrimTrailingSlices(buf, 2048);
+  EXPECT_EQ(buf.Length(), 2048u);
+  EXPECT_EQ(g_num_freed_slices, 2);
+  TrimTrailingSlices(buf, 0);
+  EXPECT_EQ(buf.Length(), 0u);
+  EXPECT_EQ(g_num_freed_slices, 4);
+}
+
+// Drives deferred writes by hand: the test thread plays the part of a thread
+// pool thread, and ends its closure batches itself.
+class PosixEndpointWriteBatchTest : public ::testing::Test {
+ protected:
+  static constexpr auto kMaxDelay = 50ms;
+
+  void SetUp() override {
+    poller_ = MakeDefaultPoller(&scheduler_);
+    if (poller_ == nullptr) GTEST_SKIP() << "No poller available";
+    engine_ = PosixEventEngine::MakeTestOnlyPosixEventEngine(poller_);
+    ThreadLocal::SetIsEventEngineThread(true);
+  }
+
+  void TearDown() override {
+    ThreadLocal::EndClosureBatch();
+    ThreadLocal::SetIsEventEngineThread(false);
+    for (int peer : peers_) close(peer);
+    if (engine_ != nullptr) grpc_core::WaitForSingleOwner(std::move(engine_));
+  }
+
+  // Returns an endpoint that batches its small writes, and whose peer is
+  // peers_.back().
+  std::unique_ptr<PosixEndpoint> CreateEndpoint() {
+    int sv[2];
+    CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    peers_.push_back(sv[1]);
+    PosixTcpOptions options;
+    options.tcp_write_batch_max_delay_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(kMaxDelay)
+            .count();
+    options.resource_quota = grpc_core::ResourceQuota::Default();
+    EventHandle* handle = poller_->CreateHandle(
+        poller_->posix_interface().Adopt(sv[0]), "test", false);
+    return CreatePosixEndpoint(
+        handle, nullptr, engine_,
+        options.resource_quota->memory_quota()->CreateMemoryAllocator("test"),
+        options);
+  }
+
+  // Returns a small payload that lives as long as the test.
+  SliceBuffer* MakePayload() {
+    payloads_.emplace_back();
+    payloads_.back().Append(Slice::FromCopiedString("hello"));
+    return &payloads_.back();
+  }
+
+  // Writes a small payload, and expects the write to be deferred.
+  void DeferWrite(PosixEndpoint* endpoint, std::atomic<int>* num_written) {
+    EXPECT_FALSE(endpoint->Write(
+        [num_written](absl::Status status) {
+          EXPECT_TRUE(status.ok()) << status;
+          num_written->fetch_add(1, std::memory_order_relaxed);
+        },
+        MakePayload(), EventEngine::Endpoint::WriteArgs()));
+  }
+
+  // Waits up to 10 seconds for counter to reach n.
+  static void WaitFor(const std::atomic<int>& counter, int n) {
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (counter.load() < n && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+
+  // Returns the number of bytes the peer received so far.
+  static size_t PeerReceivedBytes(int peer) {
+    char buf[64];
+    ssize_t n = recv(peer, buf, sizeof(buf), MSG_DONTWAIT);
+    return n > 0 ? n : 0;
+  }
+
+  TestScheduler scheduler_;
+  std::shared_ptr<PosixEventPoller> poller_;
+  std::shared_ptr<EventEngine> engine_;
+  std::vector<int> peers_;
+  // A write reads its payload until it completes.
+  std::list<SliceBuffer> payloads_;
+};
+
+// A lone write deferred on a thread that never runs out of closures is
+// flushed at the first closure boundary after the delay.
+TEST_F(PosixEndpointWriteBatchTest, LoneWriteIsFlushedUnderSustainedLoad) {
+  auto endpoint = CreateEndpoint();
+  std::atomic<int> num_written{0};
+  auto start = std::chrono::steady_clock::now();
+  DeferWrite(endpoint.get(), &num_written);
+  ThreadLocal::EndClosureBatchIfOverdue();
+  EXPECT_EQ(PeerReceivedBytes(peers_.back()), 0u);
+  EXPECT_EQ(num_written.load(), 0);
+  // Closure boundaries of a thread whose local queue never drains.
+  while (num_written.load() == 0 &&
+         std::chrono::steady_clock::now() - start < 10s) {
+    std::this_thread::sleep_for(1ms);
+    ThreadLocal::EndClosureBatchIfOverdue();
+  }
+  EXPECT_EQ(num_written.load(), 1);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, kMaxDelay);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+  EXPECT_EQ(PeerReceivedBytes(peers_.back()), 5u);
+}
+
+// The writes of several endpoints deferred in one batch are flushed together
+// at its end.
+TEST_F(PosixEndpointWriteBatchTest, WritesAreFlushedTogether) {
+  constexpr int kNumEndpoints = 4;
+  std::vector<std::unique_ptr<PosixEndpoint>> endpoints;
+  std::atomic<int> num_written{0};
+  for (int i = 0; i < kNumEndpoints; ++i) {
+    endpoints.push_back(CreateEndpoint());
+    DeferWrite(endpoints.back().get(), &num_written);
+  }
+  for (int peer : peers_) EXPECT_EQ(PeerReceivedBytes(peer), 0u);
+  EXPECT_EQ(num_written.load(), 0);
+  ThreadLocal::EndClosureBatch();
+  EXPECT_EQ(num_written.load(), kNumEndpoints);
+  for (int peer : peers_) EXPECT_EQ(PeerReceivedBytes(peer), 5u);
+}
+
+// Shutting down an endpoint sends its deferred write, and the end of the
+// batch does not complete it a second time.
+TEST_F(PosixEndpointWriteBatchTest, DeferredWriteIsFlushedOnShutdown) {
+  auto endpoint = CreateEndpoint();
+  std::atomic<int> num_written{0};
+  DeferWrite(endpoint.get(), &num_written);
+  endpoint.reset();
+  EXPECT_EQ(PeerReceivedBytes(peers_.back()), 5u);
+  // The write callback runs on the engine.
+  WaitFor(num_written, 1);
+  ThreadLocal::EndClosureBatch();
+  EXPECT_EQ(num_written.load(), 1);
+}
+
+// A batch flushed early by the write of another endpoint completes its writes
+// on the engine, not on the stack of that write, even if their callbacks
+// write again.
+TEST_F(PosixEndpointWriteBatchTest, EarlyFlushRunsCallbacksOnEngine) {
+  constexpr int kNumEndpoints = 2;
+  const std::thread::id test_thread = std::this_thread::get_id();
+  std::atomic<int> num_inline{0};
+  std::atomic<int> num_rewritten{0};
+  std::vector<std::unique_ptr<PosixEndpoint>> endpoints;
+  for (int i = 0; i < kNumEndpoints; ++i) {
+    endpoints.push_back(CreateEndpoint());
+    PosixEndpoint* endpoint = endpoints.back().get();
+    SliceBuffer* rewrite = MakePayload();
+    auto on_rewritten = [&num_rewritten](absl::Status status) {
+      EXPECT_TRUE(status.ok()) << status;
+      num_rewritten.fetch_add(1);
+    };
+    EXPECT_FALSE(endpoint->Write(
+        [&, endpoint, rewrite, on_rewritten](absl::Status status) {
+          EXPECT_TRUE(status.ok()) << status;
+          if (std::this_thread::get_id() == test_thread) {
+            num_inline.fetch_add(1);
+          }
+          if (endpoint->Write(on_rewritten, rewrite,
+                              EventEngine::Endpoint::WriteArgs())) {
+            num_rewritten.fetch_add(1);
+          }
+        },
+        MakePayload(), EventEngine::Endpoint::WriteArgs()));
+  }
+  std::this_thread::sleep_for(kMaxDelay);
+  // The batch is overdue: this write flushes it before joining a new one.
+  auto endpoint = CreateEndpoint();
+  std::atomic<int> num_written{0};
+  DeferWrite(endpoint.get(), &num_written);
+  EXPECT_EQ(num_inline.load(), 0);
+  for (int i = 0; i < kNumEndpoints; ++i) {
+    EXPECT_EQ(PeerReceivedBytes(peers_[i]), 5u);
+  }
+  WaitFor(num_rewritten, kNumEndpoints);
+  EXPECT_EQ(num_rewritten.load(), kNumEndpoints);
+  EXPECT_EQ(num_inline.load(), 0);
+  for (int i = 0; i < kNumEndpoints; ++i) {
+    EXPECT_EQ(PeerReceivedBytes(peers_[i]), 5u);
+  }
+  EXPECT_EQ(num_written.load(), 0);
+  ThreadLocal::EndClosureBatch();
+  EXPECT_EQ(num_written.load(), 1);
+  EXPECT_EQ(PeerReceivedBytes(peers_.back()), 5u);
+}
+
 // Test with zero copy enabled and disabled.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
@@ -0,0 +1,230 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/cpu.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/iomgr/port.h"
+
+// This test won't work except with posix sockets enabled
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/fork.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/wait_for_single_owner.h"
+#include "test/core/event_engine/posix/posix_engine_test_utils.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr int kNumShards = 2;
+
+class PosixEngineListenerShardTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (gpr_cpu_num_cores() < kNumShards) {
+      GTEST_SKIP() << "Sharding needs at least " << kNumShards << " CPUs";
+    }
+    if (grpc_core::Fork::Enabled()) {
+      GTEST_SKIP() << "Sharding is disabled when fork support is enabled";
+    }
+    engine_ = PosixEventEngine::MakePosixEventEngine();
+  }
+
+  void TearDown() override {
+    if (engine_ != nullptr) grpc_core::WaitForSingleOwner(std::move(engine_));
+  }
+
+  absl::StatusOr<std::unique_ptr<EventEngine::Listener>> CreateListener(
+      EventEngine::Listener::AcceptCallback on_accept) {
+    ChannelArgsEndpointConfig config(
+        grpc_core::ChannelArgs()
+            .Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+            .Set(GRPC_ARG_TCP_LISTENER_SHARD_COUNT, kNumShards));
+    return engine_->CreateListener(
+        std::move(on_accept), [](absl::Status) {}, config,
+        std::make_unique<grpc_core::MemoryQuota>(
+            grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+                "shard_test")));
+  }
+
+  std::shared_ptr<PosixEventEngine> engine_;
+};
+
+// Accepts enough connections that the kernel sends some to every shard, and
+// checks that each one is accepted on a shard thread, and that a timer armed
+// from there fires on the same shard.
+TEST_F(PosixEngineListenerShardTest, ConnectionsAndTimersStayOnShards) {
+  static constexpr int kNumConnections = 64;
+  grpc_core::Mutex mu;
+  std::set<PosixEnginePollerShard*> accepting_shards;
+  std::atomic<int> num_accepted{0};
+  std::atomic<int> num_timers_on_shard{0};
+  std::atomic<int> num_timers_fired{0};
+  auto listener = CreateListener(
+      [&](std::unique_ptr<EventEngine::Endpoint> /*endpoint*/,
+          grpc_core::MemoryAllocator /*memory_allocator*/) {
+        PosixEnginePollerShard* shard = PosixEnginePollerShard::Current();
+        {
+          grpc_core::MutexLock lock(&mu);
+          accepting_shards.insert(shard);
+        }
+        engine_->RunAfter(1ms, [&, shard]() {
+          if (PosixEnginePollerShard::Current() == shard) {
+            num_timers_on_shard.fetch_add(1, std::memory_order_relaxed);
+          }
+          num_timers_fired.fetch_add(1, std::memory_order_release);
+        });
+        num_accepted.fetch_add(1, std::memory_order_release);
+      });
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  auto addr = URIToResolvedAddress("ipv6:[::1]:0");
+  ASSERT_TRUE(addr.ok()) << addr.status();
+  auto port = (*listener)->Bind(*addr);
+  ASSERT_TRUE(port.ok()) << port.status();
+  ASSERT_TRUE((*listener)->Start().ok());
+  ResolvedAddressSetPort(*addr, *port);
+  std::vector<int> clients;
+  for (int i = 0; i < kNumConnections; ++i) {
+    clients.push_back(ConnectToServerOrDie(*addr));
+  }
+  while (num_accepted.load(std::memory_order_acquire) < kNumConnections ||
+         num_timers_fired.load(std::memory_order_acquire) < kNumConnections) {
+    std::this_thread::sleep_for(10ms);
+  }
+  for (int client : clients) close(client);
+  listener->reset();
+  EXPECT_EQ(num_timers_on_shard.load(), kNumConnections);
+  grpc_core::MutexLock lock(&mu);
+  EXPECT_EQ(accepting_shards.count(nullptr), 0u);
+  // The odds of the kernel sending all connections to one socket are 2^-63.
+  EXPECT_EQ(accepting_shards.size(), static_cast<size_t>(kNumShards));
+}
+
+// Lets the first shard bind but not the second one, by running out of file
+// descriptors: the failed Bind must close the socket of the first shard.
+TEST_F(PosixEngineListenerShardTest, FailedBindClosesBoundShards) {
+  auto listener =
+      CreateListener([](std::unique_ptr<EventEngine::Endpoint> /*endpoint*/,
+                        grpc_core::MemoryAllocator /*memory_allocator*/) {});
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  auto addr = URIToResolvedAddress("ipv6:[::1]:0");
+  ASSERT_TRUE(addr.ok()) << addr.status();
+  // The first socket gets the lowest free descriptor, and none is left after
+  // it.
+  int next_fd = dup(0);
+  ASSERT_GE(next_fd, 0);
+  close(next_fd);
+  struct rlimit limit;
+  ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+  struct rlimit lowered = limit;
+  lowered.rlim_cur = next_fd + 1;
+  ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &lowered), 0);
+  auto port = (*listener)->Bind(*addr);
+  ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+  EXPECT_FALSE(port.ok());
+  EXPECT_EQ(fcntl(next_fd, F_GETFD), -1);
+  // The listener is still usable once descriptors are available again.
+  port = (*listener)->Bind(*addr);
+  EXPECT_TRUE(port.ok()) << port.status();
+}
+
+// Drops the last ref to the engine on a shard thread: the shard must not wait
+// for its own thread to exit, and closures queued on the shard while the engine
+// shuts down must still run.
+TEST_F(PosixEngineListenerShardTest, EngineCanBeDestroyedOnShardThread) {
+  std::atomic<PosixEnginePollerShard*> shard{nullptr};
+  grpc_core::Notification accepted;
+  auto listener = CreateListener(
+      [&](std::unique_ptr<EventEngine::Endpoint> /*endpoint*/,
+          grpc_core::MemoryAllocator /*memory_allocator*/) {
+        shard.store(PosixEnginePollerShard::Current(),
+                    std::memory_order_relaxed);
+        if (!accepted.HasBeenNotified()) accepted.Notify();
+      });
+  ASSERT_TRUE(listener.ok()) << listener.status();
+  auto addr = URIToResolvedAddress("ipv6:[::1]:0");
+  ASSERT_TRUE(addr.ok()) << addr.status();
+  auto port = (*listener)->Bind(*addr);
+  ASSERT_TRUE(port.ok()) << port.status();
+  ASSERT_TRUE((*listener)->Start().ok());
+  ResolvedAddressSetPort(*addr, *port);
+  int client = ConnectToServerOrDie(*addr);
+  accepted.WaitForNotification();
+  close(client);
+  listener->reset();
+  PosixEnginePollerShard* current = shard.load(std::memory_order_relaxed);
+  ASSERT_NE(current, nullptr);
+  // Whatever the listener still holds is released asynchronously.
+  while (engine_.use_count() > 1) std::this_thread::sleep_for(10ms);
+  grpc_core::Notification destroyed;
+  grpc_core::Notification ran_after_shutdown;
+  current->Run([&, engine = std::move(engine_)]() mutable {
+    EXPECT_EQ(PosixEnginePollerShard::Current(), current);
+    engine.reset();
+    current->Run([&]() { ran_after_shutdown.Notify(); });
+    destroyed.Notify();
+  });
+  EXPECT_TRUE(destroyed.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_TRUE(ran_after_shutdown.WaitForNotificationWithTimeout(
+      absl::Seconds(30)));
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
+
+#else  // GRPC_POSIX_SOCKET_TCP
+
+int main(int /* argc */, char** /* argv */) { return 0; }
+
+#endif  // GRPC_POSIX_SOCKET_TCP
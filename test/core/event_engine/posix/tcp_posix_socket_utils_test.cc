@@ -30,6 +30,7 @@
 #include <netinet/ip.h>
 
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/net/socket_mutator.h"
 #include "src/core/util/useful.h"
 
@@ -149,6 +150,50 @@ TEST(TcpPosixSocketUtilsTest, SocketMutatorTest) {
   test_with_vtable(&mutator_vtable2);
 }
 
+#ifdef SO_BUSY_POLL
+TEST(TcpPosixSocketUtilsTest, BusyPollIsAppliedToClientSockets) {
+  constexpr int kBusyPollUs = 50;
+  // Raising SO_BUSY_POLL above net.core.busy_read needs CAP_NET_ADMIN.
+  int probe = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(probe, 0);
+  int value = kBusyPollUs;
+  int default_value = 0;
+  socklen_t len = sizeof(default_value);
+  ASSERT_EQ(getsockopt(probe, SOL_SOCKET, SO_BUSY_POLL, &default_value, &len),
+            0);
+  bool permitted =
+      setsockopt(probe, SOL_SOCKET, SO_BUSY_POLL, &value, sizeof(value)) == 0;
+  close(probe);
+  if (!permitted) {
+    GTEST_SKIP() << "Not permitted to set SO_BUSY_POLL";
+  }
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(1);
+  EventEngine::ResolvedAddress target(reinterpret_cast<sockaddr*>(&addr),
+                                      sizeof(addr));
+  EventEnginePosixInterface posix_interface;
+  auto get_busy_poll = [&](int busy_poll_us) {
+    PosixTcpOptions options;
+    options.busy_poll_us = busy_poll_us;
+    auto result =
+        posix_interface.CreateAndPrepareTcpClientSocket(options, target);
+    EXPECT_TRUE(result.ok()) << result.status();
+    if (!result.ok()) return -1;
+    int busy_poll = -1;
+    socklen_t busy_poll_len = sizeof(busy_poll);
+    EXPECT_EQ(getsockopt(result->sock.fd(), SOL_SOCKET, SO_BUSY_POLL,
+                         &busy_poll, &busy_poll_len),
+              0);
+    posix_interface.Close(result->sock);
+    return busy_poll;
+  };
+  EXPECT_EQ(get_busy_poll(kBusyPollUs), kBusyPollUs);
+  EXPECT_EQ(get_busy_poll(PosixTcpOptions::kBusyPollUnset), default_value);
+}
+#endif  // SO_BUSY_POLL
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -0,0 +1,174 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+#ifdef GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+constexpr size_t kRegionBytes = 64 * 1024;
+
+// Counts the bytes reserved and not released yet.
+class CountingAllocatorImpl : public internal::MemoryAllocatorImpl {
+ public:
+  size_t Reserve(MemoryRequest request) override {
+    reserved_.fetch_add(request.min(), std::memory_order_relaxed);
+    return request.min();
+  }
+  grpc_slice MakeSlice(MemoryRequest /*request*/) override {
+    grpc_core::Crash("unused");
+  }
+  void Release(size_t n) override {
+    reserved_.fetch_sub(n, std::memory_order_relaxed);
+  }
+  void Shutdown() override {}
+
+  size_t reserved() const { return reserved_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<size_t> reserved_{0};
+};
+
+class TcpZerocopyReceiveCtxTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd_, 0);
+  }
+  void TearDown() override { close(fd_); }
+
+  // Maps a region, or skips the test if the kernel does not support mapping
+  // TCP sockets.
+  void* PrepareRegion(TcpZerocopyReceiveCtx& ctx) {
+    void* region = ctx.PrepareRegion(fd_, kRegionBytes, allocator_);
+    if (region == nullptr) {
+      EXPECT_FALSE(ctx.enabled());
+    }
+    return region;
+  }
+
+  int fd_ = -1;
+  std::shared_ptr<CountingAllocatorImpl> allocator_impl_ =
+      std::make_shared<CountingAllocatorImpl>();
+  MemoryAllocator allocator_{allocator_impl_};
+};
+
+TEST_F(TcpZerocopyReceiveCtxTest, PausedAfterConsecutiveMisses) {
+  TcpZerocopyReceiveCtx ctx(true, kRegionBytes);
+  for (int i = 1; i < TcpZerocopyReceiveCtx::kMaxConsecutiveMisses; ++i) {
+    EXPECT_TRUE(ctx.OnReceived(0).empty());
+    ctx.OnCopied(true);
+    EXPECT_TRUE(ctx.enabled());
+  }
+  ctx.OnCopied(true);
+  EXPECT_FALSE(ctx.enabled());
+  // Receiving is attempted again once the cooldown is over.
+  for (int i = 1; i < TcpZerocopyReceiveCtx::kMissCooldownReads; ++i) {
+    ctx.OnCopied(false);
+    EXPECT_FALSE(ctx.enabled());
+  }
+  ctx.OnCopied(false);
+  EXPECT_TRUE(ctx.enabled());
+}
+
+TEST_F(TcpZerocopyReceiveCtxTest, EmptyReceivesAreNotMisses) {
+  TcpZerocopyReceiveCtx ctx(true, kRegionBytes);
+  // Nothing to read, e.g. EAGAIN: no read copies anything afterwards.
+  for (int i = 0; i < 2 * TcpZerocopyReceiveCtx::kMaxConsecutiveMisses; ++i) {
+    EXPECT_TRUE(ctx.OnReceived(0).empty());
+  }
+  EXPECT_TRUE(ctx.enabled());
+  // Reads too small to attempt a receive.
+  for (int i = 0; i < 2 * TcpZerocopyReceiveCtx::kMaxConsecutiveMisses; ++i) {
+    ctx.OnCopied(false);
+  }
+  EXPECT_TRUE(ctx.enabled());
+}
+
+TEST_F(TcpZerocopyReceiveCtxTest, MappedBytesResetMisses) {
+  TcpZerocopyReceiveCtx ctx(true, kRegionBytes);
+  if (PrepareRegion(ctx) == nullptr) GTEST_SKIP();
+  for (int i = 1; i < TcpZerocopyReceiveCtx::kMaxConsecutiveMisses; ++i) {
+    ctx.OnCopied(true);
+  }
+  EXPECT_EQ(ctx.OnReceived(4096).length(), 4096u);
+  for (int i = 1; i < TcpZerocopyReceiveCtx::kMaxConsecutiveMisses; ++i) {
+    ctx.OnCopied(true);
+  }
+  EXPECT_TRUE(ctx.enabled());
+}
+
+TEST_F(TcpZerocopyReceiveCtxTest, RegionIsReusedOnceSlicesAreReleased) {
+  auto ctx = std::make_unique<TcpZerocopyReceiveCtx>(true, kRegionBytes);
+  void* first = PrepareRegion(*ctx);
+  if (first == nullptr) GTEST_SKIP();
+  EXPECT_EQ(allocator_impl_->reserved(), kRegionBytes);
+  // Nothing references the region: it is reused as is.
+  EXPECT_EQ(PrepareRegion(*ctx), first);
+  Slice received = ctx->OnReceived(4096);
+  EXPECT_EQ(received.begin(), first);
+  EXPECT_EQ(received.length(), 4096u);
+  // The received pages must stay valid, so the next receive needs another
+  // region, and both are charged.
+  void* second = PrepareRegion(*ctx);
+  EXPECT_NE(second, first);
+  EXPECT_EQ(allocator_impl_->reserved(), 2 * kRegionBytes);
+  // Releasing the slice unmaps the first region.
+  received = Slice();
+  EXPECT_EQ(allocator_impl_->reserved(), kRegionBytes);
+  EXPECT_EQ(PrepareRegion(*ctx), second);
+  // A slice can outlive the context.
+  received = ctx->OnReceived(4096);
+  ctx.reset();
+  EXPECT_EQ(allocator_impl_->reserved(), kRegionBytes);
+  received = Slice();
+  EXPECT_EQ(allocator_impl_->reserved(), 0u);
+}
+
+TEST_F(TcpZerocopyReceiveCtxTest, DisableReleasesIdleRegion) {
+  TcpZerocopyReceiveCtx ctx(true, kRegionBytes);
+  if (PrepareRegion(ctx) == nullptr) GTEST_SKIP();
+  ctx.Disable();
+  EXPECT_FALSE(ctx.enabled());
+  EXPECT_EQ(allocator_impl_->reserved(), 0u);
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+#else  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
+
+int main(int /* argc */, char** /* argv */) { return 0; }
+
+#endif  // GRPC_LINUX_TCP_ZEROCOPY_RECEIVE
@@ -0,0 +1,233 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class FakeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now_ms);
+  }
+  void Kick() override { ++kicks; }
+
+  int64_t now_ms = 0;
+  int kicks = 0;
+};
+
+class CountingClosure : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { ++runs; }
+
+  int runs = 0;
+};
+
+grpc_core::Timestamp Millis(int64_t ms) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(ms);
+}
+
+// Runs the closures of the timers that fired. Returns how many there were, or
+// -1 if the timers could not be checked.
+int RunExpired(TimerWheel& wheel, grpc_core::Timestamp* next = nullptr) {
+  auto result = wheel.TimerCheck(next);
+  if (!result.has_value()) return -1;
+  for (auto* closure : *result) closure->Run();
+  return result->size();
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  CountingClosure closures[20];
+  FakeHost host;
+  host.now_ms = 100;
+  TimerWheel wheel(&host);
+
+  for (int i = 0; i < 10; i++) {
+    wheel.TimerInit(&timers[i], Millis(110), &closures[i]);
+  }
+  for (int i = 10; i < 20; i++) {
+    wheel.TimerInit(&timers[i], Millis(1110), &closures[i]);
+  }
+  EXPECT_GT(host.kicks, 0);
+
+  host.now_ms = 600;
+  EXPECT_EQ(RunExpired(wheel), 10);
+  for (int i = 0; i < 20; i++) EXPECT_EQ(closures[i].runs, i < 10 ? 1 : 0);
+
+  host.now_ms = 700;
+  EXPECT_EQ(RunExpired(wheel), 0);
+
+  host.now_ms = 1109;
+  EXPECT_EQ(RunExpired(wheel), 0);
+  host.now_ms = 1110;
+  EXPECT_EQ(RunExpired(wheel), 10);
+  for (int i = 0; i < 20; i++) EXPECT_EQ(closures[i].runs, 1);
+}
+
+TEST(TimerWheelTest, Cancel) {
+  Timer timers[5];
+  CountingClosure closures[5];
+  FakeHost host;
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timers[0], Millis(100), &closures[0]);
+  wheel.TimerInit(&timers[1], Millis(3), &closures[1]);
+  wheel.TimerInit(&timers[2], Millis(100), &closures[2]);
+  wheel.TimerInit(&timers[3], Millis(3), &closures[3]);
+  wheel.TimerInit(&timers[4], Millis(1), &closures[4]);
+
+  host.now_ms = 2;
+  EXPECT_EQ(RunExpired(wheel), 1);
+  EXPECT_EQ(closures[4].runs, 1);
+  EXPECT_FALSE(wheel.TimerCancel(&timers[4]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[3]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[2]));
+
+  host.now_ms = 1000;
+  EXPECT_EQ(RunExpired(wheel), 0);
+  for (int i = 0; i < 4; i++) EXPECT_EQ(closures[i].runs, 0);
+}
+
+TEST(TimerWheelTest, ReportsNextDeadline) {
+  Timer timer;
+  CountingClosure closure;
+  FakeHost host;
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timer, Millis(5000), &closure);
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(RunExpired(wheel, &next), 0);
+  // The wheel wakes up at the start of the slot of the timer, at the latest
+  // at its deadline.
+  EXPECT_LE(next, Millis(5000));
+  EXPECT_GT(next, Millis(0));
+}
+
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  Timer timers[3];
+  CountingClosure closures[3];
+  const int64_t k25Days = grpc_core::Duration::Hours(25 * 24).millis();
+  FakeHost host;
+  host.now_ms = k25Days;
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timers[0], Millis(2 * k25Days), &closures[0]);
+  wheel.TimerInit(&timers[1], Millis(k25Days + 3), &closures[1]);
+  wheel.TimerInit(&timers[2],
+                  Millis(std::numeric_limits<int64_t>::max() - 1),
+                  &closures[2]);
+
+  host.now_ms = k25Days + 4;
+  EXPECT_EQ(RunExpired(wheel), 1);
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[2]));
+}
+
+// Every timer fires at the first check at or after its deadline, and never
+// before, whatever the order of insertions and the time between checks.
+TEST(TimerWheelTest, FiresInOrder) {
+  constexpr int kTimers = 2000;
+  std::vector<Timer> timers(kTimers);
+  std::vector<CountingClosure> closures(kTimers);
+  std::vector<int64_t> deadlines(kTimers);
+  std::mt19937 rng(42);
+  FakeHost host;
+  host.now_ms = 12345;
+  TimerWheel wheel(&host);
+
+  for (int i = 0; i < kTimers; i++) {
+    // Spread the timeouts over all the levels of the wheel.
+    int64_t timeout = int64_t{1}
+                      << std::uniform_int_distribution<>(0, 40)(rng);
+    timeout += std::uniform_int_distribution<int64_t>(0, timeout)(rng);
+    deadlines[i] = host.now_ms + timeout;
+    wheel.TimerInit(&timers[i], Millis(deadlines[i]), &closures[i]);
+  }
+  for (int i = 0; i < kTimers; i += 7) {
+    EXPECT_TRUE(wheel.TimerCancel(&timers[i]));
+  }
+  while (host.now_ms < 12345 + (int64_t{1} << 42)) {
+    host.now_ms += std::uniform_int_distribution<int64_t>(
+        1, (host.now_ms - 12345) / 8 + 1)(rng);
+    ASSERT_GE(RunExpired(wheel), 0);
+    for (int i = 0; i < kTimers; i++) {
+      int expected = (i % 7 != 0 && deadlines[i] <= host.now_ms) ? 1 : 0;
+      ASSERT_EQ(closures[i].runs, expected) << i;
+    }
+  }
+}
+
+TEST(TimerWheelTest, CoarseModeBoundsTheDelay) {
+  constexpr int kTimers = 500;
+  std::vector<Timer> timers(kTimers);
+  std::vector<CountingClosure> closures(kTimers);
+  std::vector<int64_t> deadlines(kTimers);
+  std::mt19937 rng(7);
+  FakeHost host;
+  host.now_ms = 1000;
+  TimerWheel wheel(&host, /*coarse=*/true);
+
+  for (int i = 0; i < kTimers; i++) {
+    int64_t timeout =
+        std::uniform_int_distribution<int64_t>(1, int64_t{1} << 30)(rng);
+    deadlines[i] = host.now_ms + timeout;
+    wheel.TimerInit(&timers[i], Millis(deadlines[i]), &closures[i]);
+  }
+  std::vector<int64_t> fired_at(kTimers, -1);
+  while (host.now_ms < 1000 + (int64_t{1} << 31)) {
+    host.now_ms += (host.now_ms - 1000) / 256 + 1;
+    ASSERT_GE(RunExpired(wheel), 0);
+    for (int i = 0; i < kTimers; i++) {
+      if (fired_at[i] == -1 && closures[i].runs == 1) {
+        fired_at[i] = host.now_ms;
+      }
+    }
+  }
+  for (int i = 0; i < kTimers; i++) {
+    ASSERT_NE(fired_at[i], -1) << i;
+    // Never early, and late by at most 1/64 of the timeout, plus the time
+    // between two checks.
+    EXPECT_LE(deadlines[i], fired_at[i]) << i;
+    EXPECT_LE(fired_at[i] - deadlines[i], (deadlines[i] - 1000) / 32 + 1) << i;
+  }
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
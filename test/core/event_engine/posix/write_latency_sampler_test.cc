@@ -0,0 +1,126 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/write_latency_sampler.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <memory>
+#include <optional>
+
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/posix_engine/posix_write_event_sink.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+using Stage = WriteLatencySampler::Stage;
+using WriteEvent = EventEngine::Endpoint::WriteEvent;
+
+// Delivers event to sink the way the traced buffer list does.
+void Deliver(PosixWriteEventSink& sink, WriteEvent event, absl::Time time) {
+  sink.RecordEvent(event, time, PosixWriteEventSink::ConnectionMetrics());
+}
+
+}  // namespace
+
+TEST(WriteLatencySamplerTest, SamplesOneInN) {
+  auto sampler = grpc_core::MakeRefCounted<WriteLatencySampler>(4);
+  int sampled = 0;
+  for (int i = 0; i < 20; ++i) {
+    auto sink = sampler->MaybeSample();
+    if (sink.has_value()) {
+      EXPECT_EQ(i % 4, 3);
+      EXPECT_EQ(sink->requested_metrics(), nullptr);
+      ++sampled;
+    }
+  }
+  EXPECT_EQ(sampled, 5);
+}
+
+TEST(WriteLatencySamplerTest, RecordsEveryStage) {
+  auto sampler = grpc_core::MakeRefCounted<WriteLatencySampler>(1);
+  auto sink = sampler->MaybeSample();
+  ASSERT_TRUE(sink.has_value());
+  PosixWriteEventSink posix_sink(std::move(*sink));
+  absl::Time sendmsg = absl::Now() + absl::Microseconds(100);
+  Deliver(posix_sink, WriteEvent::kSendMsg, sendmsg);
+  Deliver(posix_sink, WriteEvent::kScheduled,
+          sendmsg + absl::Microseconds(10));
+  Deliver(posix_sink, WriteEvent::kSent, sendmsg + absl::Microseconds(15));
+  Deliver(posix_sink, WriteEvent::kAcked, sendmsg + absl::Milliseconds(2));
+  for (auto stage :
+       {Stage::kEndpoint, Stage::kStack, Stage::kQdisc, Stage::kWire}) {
+    EXPECT_EQ(sampler->Count(stage), 1)
+        << WriteLatencySampler::StageName(stage);
+  }
+  // Each latency lands in the power of two bucket above it.
+  EXPECT_EQ(sampler->QuantileUs(Stage::kStack, 0.5), 16);
+  EXPECT_EQ(sampler->QuantileUs(Stage::kQdisc, 0.5), 8);
+  EXPECT_EQ(sampler->QuantileUs(Stage::kWire, 0.5), 2048);
+}
+
+TEST(WriteLatencySamplerTest, SkipsStagesWithMissingEvents) {
+  auto sampler = grpc_core::MakeRefCounted<WriteLatencySampler>(1);
+  auto sink = sampler->MaybeSample();
+  ASSERT_TRUE(sink.has_value());
+  PosixWriteEventSink posix_sink(std::move(*sink));
+  absl::Time sendmsg = absl::Now();
+  Deliver(posix_sink, WriteEvent::kSendMsg, sendmsg);
+  // No kScheduled: the time to kSent spans two stages.
+  Deliver(posix_sink, WriteEvent::kSent, sendmsg + absl::Microseconds(20));
+  Deliver(posix_sink, WriteEvent::kAcked, sendmsg + absl::Microseconds(90));
+  EXPECT_EQ(sampler->Count(Stage::kStack), 0);
+  EXPECT_EQ(sampler->Count(Stage::kQdisc), 0);
+  EXPECT_EQ(sampler->Count(Stage::kWire), 1);
+  EXPECT_EQ(sampler->QuantileUs(Stage::kStack, 0.5), std::nullopt);
+}
+
+TEST(WriteLatencySamplerTest, Quantiles) {
+  auto sampler = grpc_core::MakeRefCounted<WriteLatencySampler>(1);
+  for (int i = 0; i < 98; ++i) {
+    sampler->Record(Stage::kWire, absl::Microseconds(100));
+  }
+  sampler->Record(Stage::kWire, absl::Milliseconds(50));
+  sampler->Record(Stage::kWire, absl::Hours(1));
+  EXPECT_EQ(sampler->Count(Stage::kWire), 100);
+  EXPECT_EQ(sampler->QuantileUs(Stage::kWire, 0.5), 128);
+  EXPECT_EQ(sampler->QuantileUs(Stage::kWire, 0.99), 65536);
+  EXPECT_EQ(sampler->QuantileUs(Stage::kWire, 1),
+            int64_t{1} << (WriteLatencySampler::kNumBuckets - 1));
+  // Clock steps backwards count as no delay.
+  sampler->Record(Stage::kQdisc, absl::Microseconds(-5));
+  EXPECT_EQ(sampler->QuantileUs(Stage::kQdisc, 1), 0);
+}
+
+TEST(WriteLatencySamplerTest, SinkOutlivesEndpointReference) {
+  auto sampler = grpc_core::MakeRefCounted<WriteLatencySampler>(1);
+  auto sink = sampler->MaybeSample();
+  ASSERT_TRUE(sink.has_value());
+  WriteLatencySampler* raw = sampler.get();
+  sampler.reset();
+  PosixWriteEventSink posix_sink(std::move(*sink));
+  Deliver(posix_sink, WriteEvent::kSendMsg, absl::Now());
+  EXPECT_EQ(raw->Count(Stage::kEndpoint), 1);
+}
+
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -29,9 +29,12 @@
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/event_engine/extensions/run_priority.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
@@ -300,6 +303,116 @@ TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   p1.Quiesce();
 }
 
+TEST(CpuTopologyTest, RenumbersNodesAndCacheDomains) {
+  CpuTopology topology({{4, 7, 40}, {5, 7, 40}, {6, 3, 60}, {7, 3, 61}});
+  EXPECT_EQ(topology.num_nodes(), 2);
+  EXPECT_EQ(topology.num_cache_domains(), 3);
+  EXPECT_EQ(topology.cpus()[0].node, 0);
+  EXPECT_EQ(topology.cpus()[2].node, 1);
+  EXPECT_EQ(topology.cpus()[1].cache_domain, 0);
+  EXPECT_EQ(topology.cpus()[3].cache_domain, 2);
+}
+
+TEST(CpuTopologyTest, SpreadsThreadsOverNodes) {
+  CpuTopology topology({{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 1, 1}});
+  EXPECT_EQ(topology.CpuIndexForThread(0), 0);
+  EXPECT_EQ(topology.CpuIndexForThread(1), 3);
+  EXPECT_EQ(topology.CpuIndexForThread(2), 1);
+  EXPECT_EQ(topology.CpuIndexForThread(3), 2);
+  // Wraps around when there are more threads than CPUs.
+  EXPECT_EQ(topology.CpuIndexForThread(4), 0);
+}
+
+TEST(WorkStealingThreadPoolTopologyTest, RunsClosuresOnMultipleNodes) {
+  // Pretend the CPUs of the machine are split over two nodes, each with two
+  // cache domains.
+  std::vector<CpuTopology::Cpu> cpus;
+  for (int i = 0; i < 8; ++i) cpus.push_back({i, i / 4, i / 2});
+  CpuTopology topology(std::move(cpus));
+  WorkStealingThreadPool pool(8, &topology, /*pin_threads=*/false);
+  constexpr int kClosures = 10000;
+  std::atomic<int> runs{0};
+  grpc_core::Notification done;
+  for (int i = 0; i < 8; ++i) {
+    pool.Run([&] {
+      // Queue closures onto this worker's local queue for others to steal.
+      for (int j = 0; j < kClosures / 8; ++j) {
+        pool.Run([&] {
+          if (runs.fetch_add(1) + 1 == kClosures) done.Notify();
+        });
+      }
+    });
+  }
+  done.WaitForNotification();
+  pool.Quiesce();
+  auto steals = pool.steal_counts();
+  EXPECT_LE(steals.same_cache + steals.same_node + steals.cross_node,
+            kClosures);
+}
+
+TEST(WorkStealingThreadPoolPriorityTest, RunsLatencySensitiveClosuresFirst) {
+  WorkStealingThreadPool pool(1);
+  // No other thread may take the queued closures.
+  pool.TestOnlyDisableGrowthAndStealing();
+  grpc_core::Mutex mu;
+  std::vector<int> order;
+  grpc_core::Notification done;
+  pool.Run([&] {
+    // The only thread is busy: queue closures for it to run next.
+    for (int i = 1; i <= 10; ++i) {
+      pool.Run([&, i] {
+        grpc_core::MutexLock lock(&mu);
+        order.push_back(i);
+        if (order.size() == 11) done.Notify();
+      });
+    }
+    pool.RunWithPriority(RunPriority::kLatencySensitive, [&] {
+      grpc_core::MutexLock lock(&mu);
+      order.push_back(0);
+      if (order.size() == 11) done.Notify();
+    });
+  });
+  done.WaitForNotification();
+  pool.Quiesce();
+  ASSERT_EQ(order.size(), 11);
+  EXPECT_EQ(order[0], 0);
+}
+
+TEST(WorkStealingThreadPoolPriorityTest, BoundsStarvationOfBackgroundClosures) {
+  constexpr int kClosures =
+      4 * WorkStealingThreadPool::kMaxClosuresBeforeBackground;
+  WorkStealingThreadPool pool(1);
+  pool.TestOnlyDisableGrowthAndStealing();
+  std::atomic<int> runs{0};
+  std::atomic<int> background_run_at{-1};
+  grpc_core::Notification done;
+  pool.Run([&] {
+    pool.RunWithPriority(RunPriority::kBackground, [&] {
+      background_run_at.store(runs.load());
+      if (runs.fetch_add(1) + 1 == kClosures + 1) done.Notify();
+    });
+    for (int i = 0; i < kClosures; ++i) {
+      pool.Run([&] {
+        if (runs.fetch_add(1) + 1 == kClosures + 1) done.Notify();
+      });
+    }
+  });
+  done.WaitForNotification();
+  pool.Quiesce();
+  // The background closure waited for some of the others, but not all.
+  EXPECT_GT(background_run_at.load(), 0);
+  EXPECT_LE(background_run_at.load(),
+            WorkStealingThreadPool::kMaxClosuresBeforeBackground);
+}
+
+TEST(WorkStealingThreadPoolPriorityTest, RunsBackgroundClosuresWhenIdle) {
+  WorkStealingThreadPool pool(4);
+  grpc_core::Notification done;
+  pool.RunWithPriority(RunPriority::kBackground, [&] { done.Notify(); });
+  done.WaitForNotification();
+  pool.Quiesce();
+}
+
 class BusyThreadCountTest : public testing::Test {};
 
 TEST_F(BusyThreadCountTest, StressTest) {
@@ -0,0 +1,175 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "test/core/test_util/test_config.h"
+
+namespace {
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
+using ::grpc_event_engine::experimental::EventEngine;
+
+TEST(ChaseLevWorkQueueTest, StartsEmpty) {
+  ChaseLevWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+  ASSERT_EQ(queue.PopMostRecent(), nullptr);
+  ASSERT_EQ(queue.PopOldest(), nullptr);
+}
+
+TEST(ChaseLevWorkQueueTest, TakesClosures) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  AnyInvocableClosure closure([&ran] { ran = true; });
+  queue.Add(&closure);
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, TakesAnyInvocables) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, BecomesEmptyOnPopOldest) {
+  ChaseLevWorkQueue queue;
+  bool ran = false;
+  queue.Add([&ran] { ran = true; });
+  ASSERT_FALSE(queue.Empty());
+  EventEngine::Closure* closure = queue.PopOldest();
+  ASSERT_NE(closure, nullptr);
+  closure->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopMostRecentIsLIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopMostRecent()->Run();
+  EXPECT_FALSE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  queue.PopMostRecent()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, PopOldestIsFIFO) {
+  ChaseLevWorkQueue queue;
+  int flag = 0;
+  queue.Add([&flag] { flag |= 1; });
+  queue.Add([&flag] { flag |= 2; });
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_FALSE(flag & 2);
+  queue.PopOldest()->Run();
+  EXPECT_TRUE(flag & 1);
+  EXPECT_TRUE(flag & 2);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ChaseLevWorkQueueTest, GrowsKeepingOrder) {
+  constexpr int kCount = 1000;
+  ChaseLevWorkQueue queue;
+  std::vector<AnyInvocableClosure*> closures;
+  for (int i = 0; i < kCount; i++) {
+    closures.push_back(new AnyInvocableClosure([] {}));
+    queue.Add(closures.back());
+    // Interleave takes from both ends so that the elements wrap around.
+    if (i % 3 == 0) {
+      ASSERT_EQ(queue.PopOldest(), closures[i / 3]);
+    }
+  }
+  ASSERT_EQ(queue.Size(), kCount - (kCount + 2) / 3);
+  for (int i = kCount - 1; i >= (kCount + 2) / 3; i--) {
+    ASSERT_EQ(queue.PopMostRecent(), closures[i]);
+  }
+  ASSERT_TRUE(queue.Empty());
+  for (auto* closure : closures) delete closure;
+}
+
+// The owner adds and pops while thieves steal. Every closure must run exactly
+// once.
+TEST(ChaseLevWorkQueueTest, ThreadedStress) {
+  ChaseLevWorkQueue queue;
+  constexpr int thief_count = 8;
+  constexpr int element_count = 200000;
+  std::atomic<int> run_count{0};
+  std::atomic<bool> done{false};
+  class TestClosure : public EventEngine::Closure {
+   public:
+    explicit TestClosure(std::atomic<int>* run_count)
+        : run_count_(run_count) {}
+    void Run() override {
+      run_count_->fetch_add(1, std::memory_order_relaxed);
+      delete this;
+    }
+
+   private:
+    std::atomic<int>* run_count_;
+  };
+  std::vector<std::thread> thieves;
+  thieves.reserve(thief_count);
+  for (int i = 0; i < thief_count; i++) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_relaxed)) {
+        if (auto* c = queue.PopOldest()) c->Run();
+      }
+    });
+  }
+  for (int i = 0; i < element_count; i++) {
+    queue.Add(new TestClosure(&run_count));
+    // Keep the queue short sometimes, to race the thieves for the last
+    // element.
+    if (i % 2 == 0 || i % 1000 > 900) {
+      if (auto* c = queue.PopMostRecent()) c->Run();
+    }
+  }
+  while (auto* c = queue.PopMostRecent()) c->Run();
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thd : thieves) thd.join();
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(run_count.load(), element_count);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
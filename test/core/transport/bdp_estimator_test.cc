@@ -133,6 +133,59 @@ INSTANTIATE_TEST_SUITE_P(TooManyNames, BdpEstimatorRandomTest,
                          ::testing::Values(3, 4, 6, 9, 13, 19, 28, 42, 63, 94,
                                            141, 211, 316, 474, 711));
 
+namespace {
+// Completes a ping taking rtt_seconds, during which bytes are received.
+void Ping(BdpEstimator* estimator, int64_t bytes, int rtt_seconds) {
+  ExecCtx exec_ctx;
+  estimator->SchedulePing();
+  estimator->StartPing();
+  estimator->AddIncomingBytes(bytes);
+  g_clock.fetch_add(rtt_seconds);
+  ExecCtx::Get()->InvalidateNow();
+  estimator->CompletePing();
+}
+}  // namespace
+
+TEST(BdpEstimatorTest, MinRttExpiresAfterWindow) {
+  BdpEstimator est("test");
+  Ping(&est, 1000, 1);
+  EXPECT_EQ(est.EstimateRtt(), 1);
+  // The path got slower: the old round trip time is remembered for a while,
+  // and then forgotten.
+  int elapsed = 0;
+  while (elapsed <= BdpEstimator::kMinRttWindowMillis / 1000) {
+    EXPECT_EQ(est.EstimateRtt(), 1);
+    Ping(&est, 1000, 5);
+    elapsed += 5;
+  }
+  EXPECT_EQ(est.EstimateRtt(), 5);
+}
+
+TEST(BdpEstimatorTest, PeakBandwidthExpiresAfterWindow) {
+  BdpEstimator est("test");
+  Ping(&est, 1000000, 1);
+  EXPECT_EQ(est.EstimatePeakBandwidth(), 1000000);
+  for (int i = 0; i < BdpEstimator::kPeakBandwidthWindowPings; ++i) {
+    Ping(&est, 1000, 1);
+    EXPECT_EQ(est.EstimatePeakBandwidth(), 1000000);
+  }
+  Ping(&est, 1000, 1);
+  EXPECT_EQ(est.EstimatePeakBandwidth(), 1000);
+}
+
+TEST(BdpEstimatorTest, WindowKeepsBestOfRecentSamples) {
+  BdpEstimator est("test");
+  Ping(&est, 1000000, 1);
+  // Decreasing samples over the window: once the peak expires, the best of
+  // the samples that followed it takes over, rather than the latest one.
+  for (int i = 0; i < BdpEstimator::kPeakBandwidthWindowPings + 1; ++i) {
+    Ping(&est, 100000 - i * 1000, 1);
+  }
+  EXPECT_LT(est.EstimatePeakBandwidth(), 1000000);
+  EXPECT_GT(est.EstimatePeakBandwidth(),
+            100000 - BdpEstimator::kPeakBandwidthWindowPings * 1000);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
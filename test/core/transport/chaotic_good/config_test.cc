@@ -33,6 +33,7 @@ struct FuzzerChannelArgs {
   std::optional<int> max_send_chunk_size;
   std::optional<int> inlined_payload_size_threshold;
   std::optional<bool> tracing_enabled;
+  std::optional<bool> data_endpoint_draining;
 
   ChannelArgs MakeChannelArgs() {
     ChannelArgs out;
@@ -46,6 +47,8 @@ struct FuzzerChannelArgs {
     transfer(inlined_payload_size_threshold,
              GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD);
     transfer(tracing_enabled, GRPC_ARG_TCP_TRACING_ENABLED);
+    transfer(data_endpoint_draining,
+             GRPC_ARG_CHAOTIC_GOOD_DATA_ENDPOINT_DRAINING);
     return out;
   }
 };
@@ -100,6 +103,11 @@ void ConfigTest(FuzzerChannelArgs client_args_input,
             client_config.max_send_chunk_size());
   EXPECT_GE(client_config.max_recv_chunk_size(),
             server_config.max_send_chunk_size());
+  // Draining is only used if the client asked for it.
+  EXPECT_EQ(client_options.enable_data_endpoint_draining,
+            server_options.enable_data_endpoint_draining);
+  EXPECT_EQ(client_options.enable_data_endpoint_draining,
+            client_args_input.data_endpoint_draining.value_or(false));
   if (auto a = client_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_ALIGNMENT);
       a.has_value() && *a > 0) {
     EXPECT_EQ(client_options.decode_alignment, *a);
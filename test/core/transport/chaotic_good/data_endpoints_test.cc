@@ -239,7 +239,7 @@ DATA_ENDPOINTS_TEST(CanWrite) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "rand", Time1Clock());
+      false, "rand", Time1Clock());
   ep.ExpectWrite(
       {DataFrameHeader(64, 123, 1, 5),
        grpc_event_engine::experimental::Slice::FromCopiedString("hello"),
@@ -274,7 +274,7 @@ DATA_ENDPOINTS_TEST(CanMultiWrite) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "spanrr", Time1Clock());
+      false, "spanrr", Time1Clock());
   SliceBuffer writes;
   ep1.CaptureWrites(writes, event_engine().get());
   ep2.CaptureWrites(writes, event_engine().get());
@@ -326,7 +326,7 @@ DATA_ENDPOINTS_TEST(CanRead) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "spanrr", Time1Clock());
+      false, "spanrr", Time1Clock());
   SpawnTestSeqWithoutContext("read", data_endpoints.Read(5).Await(),
                              [](absl::StatusOr<SliceBuffer> result) {
                                EXPECT_TRUE(result.ok());
@@ -356,7 +356,7 @@ DATA_ENDPOINTS_TEST(CanWriteSecurityFrame) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "rand", Time1Clock());
+      false, "rand", Time1Clock());
   ::testing::Mock::VerifyAndClearExpectations(
       transport_framing_endpoint_extension);
   ep.ExpectWrite({DataFrameHeader(64, 0, 0, strlen("security_frame_bytes")),
@@ -401,7 +401,7 @@ DATA_ENDPOINTS_TEST(CanReadSecurityFrame) {
       MakeRefCounted<chaotic_good::TransportContext>(
           event_engine(), MakeTestChannelzSocketNode()),
       64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
-      "rand", Time1Clock());
+      false, "rand", Time1Clock());
   SpawnTestSeqWithoutContext(
       "read",
       [&data_endpoints]() {
@@ -418,6 +418,138 @@ DATA_ENDPOINTS_TEST(CanReadSecurityFrame) {
   WaitForAllPendingWork();
 }
 
+DATA_ENDPOINTS_TEST(CanRetireEndpoint) {
+  util::testing::MockPromiseEndpoint ep1(1234);
+  util::testing::MockPromiseEndpoint ep2(1235);
+  EXPECT_CALL(*ep1.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress()));
+  EXPECT_CALL(*ep1.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress()));
+  EXPECT_CALL(*ep2.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress2()));
+  EXPECT_CALL(*ep2.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress2()));
+  ExportMockTelemetryInfo(ep1);
+  ExportMockTelemetryInfo(ep2);
+  auto peer_drained = ep1.ExpectDelayedRead(
+      {DataFrameHeader(
+          64, chaotic_good::data_endpoints_detail::kEndpointDrainedPayloadTag,
+          1, 0)},
+      event_engine().get());
+  auto close_ep2 = ep2.ExpectDelayedReadClose(
+      absl::UnavailableError("test done"), event_engine().get());
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep1.promise_endpoint),
+                std::move(ep2.promise_endpoint)),
+      MakeRefCounted<chaotic_good::TransportContext>(
+          event_engine(), MakeTestChannelzSocketNode()),
+      64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
+      true, "spanrr", Time1Clock());
+  ep1.ExpectWrite(
+      {DataFrameHeader(
+          64, chaotic_good::data_endpoints_detail::kEndpointDrainedPayloadTag,
+          1, 0)},
+      event_engine().get());
+  EXPECT_TRUE(data_endpoints.RetireEndpoint(0));
+  // The other endpoint is the last one taking data frames.
+  EXPECT_FALSE(data_endpoints.RetireEndpoint(1));
+  EXPECT_FALSE(data_endpoints.empty());
+  WaitForAllPendingWork();
+  // Still draining until the peer has drained too.
+  EXPECT_TRUE(data_endpoints.RetireEndpoint(0));
+  peer_drained();
+  WaitForAllPendingWork();
+  EXPECT_FALSE(data_endpoints.RetireEndpoint(0));
+  // Data frames now go to the remaining endpoint.
+  ep2.ExpectWrite(
+      {DataFrameHeader(64, 123, 1, 5),
+       grpc_event_engine::experimental::Slice::FromCopiedString("hello"),
+       PaddingBytes(64 - 5)},
+      event_engine().get());
+  data_endpoints.Write(123, TestFrame("hello"));
+  WaitForAllPendingWork();
+  close_ep2();
+  WaitForAllPendingWork();
+}
+
+DATA_ENDPOINTS_TEST(CannotRetireLastEndpoint) {
+  util::testing::MockPromiseEndpoint ep(1234);
+  EXPECT_CALL(*ep.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress()));
+  EXPECT_CALL(*ep.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress()));
+  ExportMockTelemetryInfo(ep);
+  auto close_ep = ep.ExpectDelayedReadClose(absl::UnavailableError("test done"),
+                                            event_engine().get());
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep.promise_endpoint)),
+      MakeRefCounted<chaotic_good::TransportContext>(
+          event_engine(), MakeTestChannelzSocketNode()),
+      64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
+      true, "spanrr", Time1Clock());
+  EXPECT_FALSE(data_endpoints.RetireEndpoint(0));
+  EXPECT_FALSE(data_endpoints.empty());
+  WaitForAllPendingWork();
+  close_ep();
+  WaitForAllPendingWork();
+}
+
+DATA_ENDPOINTS_TEST(PeerDrainRetiresEndpoint) {
+  util::testing::MockPromiseEndpoint ep(1234);
+  EXPECT_CALL(*ep.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress()));
+  EXPECT_CALL(*ep.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress()));
+  ExportMockTelemetryInfo(ep);
+  ep.ExpectRead(
+      {DataFrameHeader(
+          64, chaotic_good::data_endpoints_detail::kEndpointDrainedPayloadTag,
+          1, 0)},
+      event_engine().get());
+  ep.ExpectWrite(
+      {DataFrameHeader(
+          64, chaotic_good::data_endpoints_detail::kEndpointDrainedPayloadTag,
+          1, 0)},
+      event_engine().get());
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep.promise_endpoint)),
+      MakeRefCounted<chaotic_good::TransportContext>(
+          event_engine(), MakeTestChannelzSocketNode()),
+      64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
+      true, "spanrr", Time1Clock());
+  WaitForAllPendingWork();
+  EXPECT_TRUE(data_endpoints.empty());
+  EXPECT_FALSE(data_endpoints.RetireEndpoint(0));
+}
+
+DATA_ENDPOINTS_TEST(RetireNeedsNegotiatedDraining) {
+  util::testing::MockPromiseEndpoint ep(1234);
+  EXPECT_CALL(*ep.endpoint, GetPeerAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetPeerAddress()));
+  EXPECT_CALL(*ep.endpoint, GetLocalAddress())
+      .WillRepeatedly(::testing::ReturnRef(GetLocalAddress()));
+  ExportMockTelemetryInfo(ep);
+  auto close_ep = ep.ExpectDelayedReadClose(absl::UnavailableError("test done"),
+                                            event_engine().get());
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep.promise_endpoint)),
+      MakeRefCounted<chaotic_good::TransportContext>(
+          event_engine(), MakeTestChannelzSocketNode()),
+      64, 64, std::make_shared<chaotic_good::TcpZTraceCollector>(), false,
+      false, "spanrr", Time1Clock());
+  EXPECT_FALSE(data_endpoints.RetireEndpoint(0));
+  EXPECT_FALSE(data_endpoints.empty());
+  ep.ExpectWrite(
+      {DataFrameHeader(64, 123, 1, 5),
+       grpc_event_engine::experimental::Slice::FromCopiedString("hello"),
+       PaddingBytes(64 - 5)},
+      event_engine().get());
+  data_endpoints.Write(123, TestFrame("hello"));
+  WaitForAllPendingWork();
+  close_ep();
+  WaitForAllPendingWork();
+}
+
 TEST(DataEndpointsTest, CanMultiWriteRegression) {
   CanMultiWrite(ParseTestProto(
       R"pb(event_engine_actions {
@@ -173,6 +173,22 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+TEST(BinEncoderTest, HuffmanCompressedLengthMatchesOutput) {
+  for (const char* s :
+       {"", "a", "www.example.com", "no-cache", "custom-value",
+        "Mon, 21 Oct 2013 20:13:21 GMT", "\x7f\xff\xfe long tail codes",
+        "6f1c2a9e-3b7d-4e8a-9c05-d2f4b1a7e390"}) {
+    grpc_slice input = grpc_slice_from_copied_string(s);
+    grpc_slice out = grpc_chttp2_huffman_compress(input);
+    EXPECT_EQ(grpc_chttp2_huffman_compressed_length(
+                  GRPC_SLICE_START_PTR(input), GRPC_SLICE_LENGTH(input)),
+              GRPC_SLICE_LENGTH(out))
+        << s;
+    grpc_slice_unref(input);
+    grpc_slice_unref(out);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,178 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Cost of splitting reads into frames and dispatching them in
+// grpc_chttp2_perform_read, for streams of small frames as a peer sends them.
+// Reads are either whole, so that every frame is contiguous, or cut into
+// small slices so that frame headers straddle them.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "test/core/test_util/mock_endpoint.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kFramesPerStream = 256;
+
+void AppendFrame(std::string& out, uint8_t type, uint8_t flags,
+                 uint32_t stream_id, absl::string_view payload) {
+  const uint32_t length = payload.size();
+  out.push_back(static_cast<char>(length >> 16));
+  out.push_back(static_cast<char>(length >> 8));
+  out.push_back(static_cast<char>(length));
+  out.push_back(static_cast<char>(type));
+  out.push_back(static_cast<char>(flags));
+  out.push_back(static_cast<char>(stream_id >> 24));
+  out.push_back(static_cast<char>(stream_id >> 16));
+  out.push_back(static_cast<char>(stream_id >> 8));
+  out.push_back(static_cast<char>(stream_id));
+  out.append(payload.data(), payload.size());
+}
+
+// WINDOW_UPDATE frames for the connection and for streams that have since
+// closed, as a peer reading many small messages sends them.
+std::string WindowUpdateFrames() {
+  std::string out;
+  const std::string increment("\x00\x00\x10\x00", 4);
+  for (int i = 0; i < kFramesPerStream; ++i) {
+    AppendFrame(out, GRPC_CHTTP2_FRAME_WINDOW_UPDATE, 0,
+                i % 2 == 0 ? 0 : 2 * i + 1, increment);
+  }
+  return out;
+}
+
+// Frames of an extension type, with payloads of up to 100 bytes, which the
+// transport skips: the cost is the framing alone.
+std::string ExtensionFrames() {
+  std::string out;
+  for (int i = 0; i < kFramesPerStream; ++i) {
+    AppendFrame(out, 0x20, 0, 2 * i + 1, std::string(i % 101, 'a'));
+  }
+  return out;
+}
+
+// A client transport that has received the server's SETTINGS, reading
+// directly from memory rather than from its endpoint.
+class ParsingFixture {
+ public:
+  ParsingFixture() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    auto controller =
+        grpc_event_engine::experimental::MockEndpointController::Create(
+            engine);
+    controller->NoMoreReads();
+    const ChannelArgs args = ChannelArgs()
+                                 .SetObject(ResourceQuota::Default())
+                                 .SetObject(std::move(engine));
+    ExecCtx exec_ctx;
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        args, OrphanablePtr<grpc_endpoint>(controller->TakeCEndpoint()),
+        /*is_client=*/true));
+    std::string settings;
+    AppendFrame(settings, GRPC_CHTTP2_FRAME_SETTINGS, 0, 0, "");
+    Read(settings, settings.size());
+  }
+
+  ~ParsingFixture() {
+    ExecCtx exec_ctx;
+    t_->Orphan();
+  }
+
+  // Parse bytes in the transport's combiner, as slices of slice_size bytes.
+  void Read(absl::string_view bytes, size_t slice_size) {
+    Notification done;
+    {
+      ExecCtx exec_ctx;
+      t_->combiner->Run(
+          NewClosure([this, bytes, slice_size, &done](grpc_error_handle) {
+            for (size_t i = 0; i < bytes.size(); i += slice_size) {
+              const grpc_slice slice = grpc_slice_from_static_buffer(
+                  bytes.data() + i, std::min(slice_size, bytes.size() - i));
+              size_t requests_started = 0;
+              auto result = grpc_chttp2_perform_read(t_, slice,
+                                                     requests_started);
+              CHECK(std::holds_alternative<absl::Status>(result));
+              CHECK_OK(std::get<absl::Status>(result));
+            }
+            done.Notify();
+          }),
+          absl::OkStatus());
+    }
+    done.WaitForNotification();
+  }
+
+ private:
+  grpc_chttp2_transport* t_;
+};
+
+void BM_ParseFrames(benchmark::State& state, std::string frames) {
+  // 0 reads all frames in one slice.
+  const size_t slice_size =
+      state.range(0) == 0 ? frames.size() : static_cast<size_t>(state.range(0));
+  ParsingFixture fixture;
+  for (auto _ : state) {
+    fixture.Read(frames, slice_size);
+  }
+  state.SetBytesProcessed(state.iterations() * frames.size());
+  state.SetItemsProcessed(state.iterations() * kFramesPerStream);
+}
+
+// Argument: size of each read slice in bytes, or 0 for a single slice.
+BENCHMARK_CAPTURE(BM_ParseFrames, WindowUpdates, WindowUpdateFrames())
+    ->Arg(0)
+    ->Arg(1000)
+    ->Arg(16);
+BENCHMARK_CAPTURE(BM_ParseFrames, ExtensionFrames, ExtensionFrames())
+    ->Arg(0)
+    ->Arg(1000)
+    ->Arg(16);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
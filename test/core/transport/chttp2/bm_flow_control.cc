@@ -0,0 +1,228 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput of one bulk stream over a simulated link, for each flow control
+// strategy. Time is simulated, so results do not depend on the machine: the
+// interesting numbers are the counters, not the wall time.
+
+#include <benchmark/benchmark.h>
+#include <grpc/support/time.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <tuple>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/bdp_estimator.h"
+#include "src/core/util/time.h"
+
+extern gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type);
+
+namespace grpc_core {
+namespace chttp2 {
+
+gpr_timespec g_now;
+gpr_timespec now_impl(gpr_clock_type clock_type) {
+  CHECK(clock_type != GPR_TIMESPAN);
+  gpr_timespec ts = g_now;
+  ts.clock_type = clock_type;
+  return ts;
+}
+
+namespace {
+
+// The reader always wants this much more, like a reader of a stream of large
+// messages.
+constexpr int64_t kReaderDemand = 1024 * 1024 * 1024;
+
+// A receiver with the given flow control strategy, and a sender with
+// unlimited data to send, connected by a link with a fixed bandwidth and
+// round trip time. Advances one simulated millisecond per Step().
+class SimulatedLink {
+ public:
+  SimulatedLink(int64_t bytes_per_ms, int64_t one_way_delay_ms,
+                FlowControlStrategy strategy)
+      : bytes_per_ms_(bytes_per_ms),
+        one_way_delay_ms_(one_way_delay_ms),
+        tfc_("bm", true, &memory_owner_, strategy),
+        sfc_(&tfc_) {
+    ExecCtx exec_ctx;
+    next_ping_ = Timestamp::Now();
+    StreamFlowControl::IncomingUpdateContext upd(&sfc_);
+    upd.SetMinProgressSize(kReaderDemand);
+    std::ignore = upd.MakeAction();
+  }
+
+  void Step() {
+    ++now_ms_;
+    g_now = gpr_time_add(g_now, gpr_time_from_millis(1, GPR_TIMESPAN));
+    ExecCtx exec_ctx;
+    Deliver(to_receiver_);
+    Deliver(to_sender_);
+    ReceiverWrite();
+    SenderWrite();
+  }
+
+  int64_t delivered_bytes() const { return delivered_bytes_; }
+
+ private:
+  struct Event {
+    int64_t at_ms;
+    std::function<void()> fn;
+  };
+
+  void Deliver(std::deque<Event>& queue) {
+    while (!queue.empty() && queue.front().at_ms <= now_ms_) {
+      auto fn = std::move(queue.front().fn);
+      queue.pop_front();
+      fn();
+    }
+  }
+
+  void Send(std::deque<Event>& queue, std::function<void()> fn) {
+    queue.push_back(Event{now_ms_ + one_way_delay_ms_, std::move(fn)});
+  }
+
+  void ReceiveData(int64_t size) {
+    delivered_bytes_ += size;
+    tfc_.bdp_estimator()->AddIncomingBytes(size);
+    StreamFlowControl::IncomingUpdateContext upd(&sfc_);
+    CHECK_OK(upd.RecvData(size));
+    upd.SetMinProgressSize(kReaderDemand);
+    std::ignore = upd.MakeAction();
+  }
+
+  void ReceivePong() {
+    next_ping_ = tfc_.bdp_estimator()->CompletePing();
+    FlowControlAction action = tfc_.PeriodicUpdate();
+    if (action.send_initial_window_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      const uint32_t window = action.initial_window_size();
+      tfc_.FlushedSettings();
+      Send(to_sender_, [this, window]() {
+        sender_initial_window_ = window;
+        Send(to_receiver_, [this, window]() {
+          std::ignore = tfc_.SetAckedInitialWindow(window);
+        });
+      });
+    }
+  }
+
+  void ReceiverWrite() {
+    if (Timestamp::Now() >= next_ping_) {
+      BdpEstimator* bdp = tfc_.bdp_estimator();
+      bdp->SchedulePing();
+      bdp->StartPing();
+      next_ping_ = Timestamp::InfFuture();
+      Send(to_sender_,
+           [this]() { Send(to_receiver_, [this]() { ReceivePong(); }); });
+    }
+    const int64_t transport_update = tfc_.MaybeSendUpdate(true);
+    const int64_t stream_update = sfc_.MaybeSendUpdate();
+    if (transport_update == 0 && stream_update == 0) return;
+    Send(to_sender_, [this, transport_update, stream_update]() {
+      sender_transport_window_ += transport_update;
+      sender_stream_window_delta_ += stream_update;
+    });
+  }
+
+  void SenderWrite() {
+    const int64_t size = std::min(
+        {bytes_per_ms_, sender_transport_window_,
+         sender_initial_window_ + sender_stream_window_delta_});
+    if (size <= 0) return;
+    sender_transport_window_ -= size;
+    sender_stream_window_delta_ -= size;
+    Send(to_receiver_, [this, size]() { ReceiveData(size); });
+  }
+
+  const int64_t bytes_per_ms_;
+  const int64_t one_way_delay_ms_;
+  int64_t now_ms_ = 0;
+  int64_t delivered_bytes_ = 0;
+  std::deque<Event> to_receiver_;
+  std::deque<Event> to_sender_;
+  MemoryOwner memory_owner_ =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryOwner();
+  TransportFlowControl tfc_;
+  StreamFlowControl sfc_;
+  Timestamp next_ping_;
+  int64_t sender_transport_window_ = kDefaultWindow;
+  int64_t sender_initial_window_ = kDefaultWindow;
+  int64_t sender_stream_window_delta_ = 0;
+};
+
+void BM_SimulatedLinkThroughput(benchmark::State& state) {
+  const int64_t mbps = state.range(0);
+  const int64_t rtt_ms = state.range(1);
+  const auto strategy = state.range(2) ? FlowControlStrategy::kModel
+                                       : FlowControlStrategy::kDefault;
+  constexpr int64_t kSimulatedMs = 10000;
+  const int64_t bytes_per_ms = mbps * 1000 * 1000 / 8 / 1000;
+  double delivered_bytes = 0;
+  double ms_to_half_rate = 0;
+  for (auto _ : state) {
+    SimulatedLink link(bytes_per_ms, rtt_ms / 2, strategy);
+    int64_t first_half_rate_ms = kSimulatedMs;
+    int64_t last_delivered = 0;
+    for (int64_t ms = 0; ms < kSimulatedMs; ++ms) {
+      link.Step();
+      if (first_half_rate_ms == kSimulatedMs &&
+          2 * (link.delivered_bytes() - last_delivered) >= bytes_per_ms) {
+        first_half_rate_ms = ms;
+      }
+      last_delivered = link.delivered_bytes();
+    }
+    delivered_bytes += link.delivered_bytes();
+    ms_to_half_rate += first_half_rate_ms;
+  }
+  // Simulated, not wall clock, throughput.
+  state.counters["sim_mbps"] = benchmark::Counter(
+      delivered_bytes * 8 / 1e6 / (kSimulatedMs / 1000.0),
+      benchmark::Counter::kAvgIterations);
+  // Simulated milliseconds until the stream first received at half of the
+  // link bandwidth.
+  state.counters["sim_ms_to_half_rate"] =
+      benchmark::Counter(ms_to_half_rate, benchmark::Counter::kAvgIterations);
+}
+
+// Arguments: link bandwidth in Mbps, round trip time in milliseconds, and
+// whether to use FlowControlStrategy::kModel.
+BENCHMARK(BM_SimulatedLinkThroughput)
+    ->ArgsProduct({{100, 1000, 10000}, {2, 50, 150}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace chttp2
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc_core::chttp2::g_now = {1, 0, GPR_CLOCK_MONOTONIC};
+  grpc_core::TestOnlySetProcessEpoch(grpc_core::chttp2::g_now);
+  gpr_now_impl = grpc_core::chttp2::now_impl;
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -72,10 +72,10 @@ void InitGlobals() {
 
 class FlowControlFuzzer {
  public:
-  explicit FlowControlFuzzer(bool enable_bdp) {
+  FlowControlFuzzer(bool enable_bdp, FlowControlStrategy strategy) {
     ExecCtx exec_ctx;
     tfc_ = std::make_unique<TransportFlowControl>("fuzzer", enable_bdp,
-                                                  &memory_owner_);
+                                                  &memory_owner_, strategy);
   }
 
   ~FlowControlFuzzer() {
@@ -214,7 +214,7 @@ void FlowControlFuzzer::Perform(const flow_control_fuzzer::Action& action) {
                   stream_update.id, stream_update.size, s->window_delta);
         }
         s->window_delta += stream_update.size;
-        CHECK(s->window_delta <= chttp2::kMaxWindowDelta);
+        CHECK(s->window_delta <= MaxWindowDelta(tfc_->strategy()));
       }
       remote_transport_window_size_ += sent_to_remote.transport_window_update;
       send_to_remote_.pop_front();
@@ -476,7 +476,10 @@ void Test(flow_control_fuzzer::Msg msg) {
   ApplyFuzzConfigVars(msg.config_vars());
   TestOnlyReloadExperimentsFromConfigVariables();
   chttp2::InitGlobals();
-  chttp2::FlowControlFuzzer fuzzer(msg.enable_bdp());
+  chttp2::FlowControlFuzzer fuzzer(
+      msg.enable_bdp(), msg.model_flow_control()
+                            ? chttp2::FlowControlStrategy::kModel
+                            : chttp2::FlowControlStrategy::kDefault);
   for (const auto& action : msg.actions()) {
     if (!squelch) {
       fprintf(stderr, "%s\n", action.DebugString().c_str());
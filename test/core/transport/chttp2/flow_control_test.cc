@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <tuple>
+#include <utility>
 
 #include "absl/log/check.h"
 #include "gtest/gtest.h"
@@ -263,6 +264,116 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+class ModelFlowControlTest : public FlowControlTest {
+ protected:
+  // The model is what is under test here, so take the mocker out of the way.
+  void SetUp() override {
+    mocker_ = std::exchange(
+        g_test_only_transport_target_window_estimates_mocker, nullptr);
+  }
+  void TearDown() override {
+    g_test_only_transport_target_window_estimates_mocker = mocker_;
+  }
+
+  // Complete a BDP ping that takes rtt_ms, during which bytes are received.
+  static void Ping(TransportFlowControl& tfc, int64_t bytes, uint64_t rtt_ms) {
+    BdpEstimator* bdp = tfc.bdp_estimator();
+    bdp->SchedulePing();
+    bdp->StartPing();
+    bdp->AddIncomingBytes(bytes);
+    AdvanceClockMillis(rtt_ms);
+    bdp->CompletePing();
+  }
+
+  // Announce what sfc wants, then receive all of its window.
+  static void ReceiveWindow(TransportFlowControl& tfc, StreamFlowControl& sfc) {
+    std::ignore = sfc.MaybeSendUpdate();
+    std::ignore = tfc.MaybeSendUpdate(true);
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(sfc.announced_window_delta() +
+                               tfc.acked_init_window()),
+              absl::OkStatus());
+    std::ignore = sfc_upd.MakeAction();
+  }
+
+ private:
+  TestOnlyTransportTargetWindowEstimatesMocker* mocker_;
+};
+
+TEST_F(ModelFlowControlTest, JumpsToMeasuredBdp) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_,
+                           FlowControlStrategy::kModel);
+  // 100MB/s over a 100ms round trip.
+  Ping(tfc, 10 * 1024 * 1024, 100);
+  EXPECT_DOUBLE_EQ(tfc.bdp_estimator()->EstimateRtt(), 0.1);
+  std::ignore = tfc.PeriodicUpdate();
+  // The sender was held back by the initial window, so the model allows for
+  // more than it saw.
+  EXPECT_EQ(tfc.queued_init_window(), 64 * 1024 * 1024);
+  // Once the window is not what limits the sender, twice the BDP is enough.
+  Ping(tfc, 10 * 1024 * 1024, 100);
+  std::ignore = tfc.PeriodicUpdate();
+  EXPECT_EQ(tfc.queued_init_window(), 32 * 1024 * 1024);
+}
+
+TEST_F(ModelFlowControlTest, CapsWindowByMemoryQuota) {
+  ExecCtx exec_ctx;
+  auto resource_quota = MakeResourceQuota("test");
+  resource_quota->memory_quota()->SetSize(16 * 1024 * 1024);
+  MemoryOwner memory_owner =
+      resource_quota->memory_quota()->CreateMemoryOwner();
+  TransportFlowControl tfc("test", true, &memory_owner,
+                           FlowControlStrategy::kModel);
+  Ping(tfc, 10 * 1024 * 1024, 100);
+  std::ignore = tfc.PeriodicUpdate();
+  // A sixteenth of the quota.
+  EXPECT_EQ(tfc.queued_init_window(), 1024 * 1024);
+}
+
+TEST_F(ModelFlowControlTest, StreamWindowFollowsReceiveRate) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_,
+                           FlowControlStrategy::kModel);
+  Ping(tfc, 64 * 1024, 100);
+  std::ignore = tfc.PeriodicUpdate();
+  StreamFlowControl sfc(&tfc);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    sfc_upd.SetMinProgressSize(1024 * 1024 * 1024);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(sfc.MaybeSendUpdate(), kMaxWindowDelta);
+  // Receive a full window every round trip: the window is what holds the
+  // stream back, so it should grow.
+  ReceiveWindow(tfc, sfc);
+  AdvanceClockMillis(100);
+  ReceiveWindow(tfc, sfc);
+  EXPECT_GT(sfc.receive_rate(), 0);
+  std::ignore = sfc.MaybeSendUpdate();
+  EXPECT_GT(sfc.announced_window_delta(), kMaxWindowDelta);
+}
+
+TEST_F(ModelFlowControlTest, DefaultStrategyKeepsStreamWindowClamp) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  Ping(tfc, 64 * 1024, 100);
+  std::ignore = tfc.PeriodicUpdate();
+  StreamFlowControl sfc(&tfc);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    sfc_upd.SetMinProgressSize(1024 * 1024 * 1024);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(sfc.MaybeSendUpdate(), kMaxWindowDelta);
+  ReceiveWindow(tfc, sfc);
+  AdvanceClockMillis(100);
+  ReceiveWindow(tfc, sfc);
+  EXPECT_EQ(sfc.receive_rate(), 0);
+  std::ignore = sfc.MaybeSendUpdate();
+  EXPECT_EQ(sfc.announced_window_delta(), kMaxWindowDelta);
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
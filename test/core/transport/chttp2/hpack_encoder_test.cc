@@ -27,9 +27,11 @@
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -233,6 +235,84 @@ TEST(HpackEncoderTest, TestBasicHeaders) {
   delete g_compressor;
 }
 
+std::string EncodeRawHeaders(
+    grpc_core::HPackCompressor& compressor,
+    const std::vector<std::pair<std::string, std::string>>& header_fields) {
+  grpc_metadata_batch b;
+  for (const auto& field : header_fields) {
+    b.Append(field.first, grpc_core::Slice::FromCopiedString(field.second),
+             CrashOnAppendError);
+  }
+  grpc_core::SliceBuffer output;
+  EXPECT_TRUE(compressor.EncodeRawHeaders(b, output));
+  return output.JoinIntoString();
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingIndexesRepeatedMetadata) {
+  if (!grpc_core::IsHpackAdaptiveIndexingEnabled()) {
+    GTEST_SKIP() << "hpack_adaptive_indexing is not enabled.";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  const std::string literal = absl::StrCat("\x08", "x-tenant", "\x04", "acme");
+  // Sent as a literal without indexing the first time...
+  EXPECT_EQ(EncodeRawHeaders(compressor, {{"x-tenant", "acme"}}),
+            std::string(1, '\x00') + literal);
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+  // ... indexed the second time...
+  EXPECT_EQ(EncodeRawHeaders(compressor, {{"x-tenant", "acme"}}),
+            "\x40" + literal);
+  EXPECT_EQ(compressor.test_only_table_size(), 44);
+  // ... and referenced by its index (the first dynamic one) afterwards.
+  EXPECT_EQ(EncodeRawHeaders(compressor, {{"x-tenant", "acme"}}), "\xbe");
+  EXPECT_EQ(EncodeRawHeaders(compressor, {{"x-tenant", "acme"}}), "\xbe");
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingSkipsUniqueMetadata) {
+  if (!grpc_core::IsHpackAdaptiveIndexingEnabled()) {
+    GTEST_SKIP() << "hpack_adaptive_indexing is not enabled.";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  for (int i = 0; i < 1000; ++i) {
+    const std::string encoded = EncodeRawHeaders(
+        compressor, {{"x-request-id", absl::StrCat("request-", i)}});
+    ASSERT_EQ(encoded[0], '\x00') << i;
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingSkipsLargeMetadata) {
+  if (!grpc_core::IsHpackAdaptiveIndexingEnabled()) {
+    GTEST_SKIP() << "hpack_adaptive_indexing is not enabled.";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  // More than a quarter of the default 4096 byte table.
+  const std::string value(2000, 'a');
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(EncodeRawHeaders(compressor, {{"x-large", value}})[0], '\x00');
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingNeverIndexesCredentials) {
+  if (!grpc_core::IsHpackAdaptiveIndexingEnabled()) {
+    GTEST_SKIP() << "hpack_adaptive_indexing is not enabled.";
+  }
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  for (const char* key :
+       {"authorization", "proxy-authorization", "cookie", "set-cookie"}) {
+    for (int i = 0; i < 3; ++i) {
+      // A literal never indexed (RFC 7541 section 6.2.3) every time.
+      EXPECT_EQ(EncodeRawHeaders(compressor, {{key, "secret"}})[0], '\x10')
+          << key << " " << i;
+    }
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+}
+
 MATCHER(HasLiteralHeaderFieldNewNameFlagIncrementalIndexing, "") {
   constexpr size_t kHttp2FrameHeaderSize = 9u;
   /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.2.1
@@ -0,0 +1,218 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_interner.h"
+
+#include <grpc/grpc.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr absl::string_view kTenant =
+    "acme-production-europe-west1-tenant-0042";
+constexpr absl::string_view kUserAgent =
+    "grpc-c++/1.74.0 grpc-c/48.0.0 (linux; chttp2)";
+
+uint32_t TransportSize(absl::string_view key, absl::string_view value) {
+  return hpack_constants::SizeForEntry(key.size(), value.size());
+}
+
+ParsedMetadata<grpc_metadata_batch> Parse(absl::string_view key,
+                                          absl::string_view value) {
+  return grpc_metadata_batch::Parse(
+      key, Slice::FromCopiedString(value),
+      /*will_keep_past_request_lifetime=*/true, TransportSize(key, value),
+      [](absl::string_view error, const Slice&) { FAIL() << error; });
+}
+
+// Returns where md stores its value.
+const char* ValueStorage(const ParsedMetadata<grpc_metadata_batch>& md) {
+  grpc_metadata_batch batch;
+  md.SetOnContainer(&batch);
+  std::string buffer;
+  return batch.GetStringValue(md.key(), &buffer)->data();
+}
+
+TEST(HPackParserInternerTest, SharesUnknownKeyStorage) {
+  HPackParserInterner interner;
+  // Long enough not to be inlined into the slice.
+  constexpr absl::string_view kKey = "x-acme-tenant-routing-partition";
+  EXPECT_FALSE(interner.Lookup(kKey, kTenant, 0).has_value());
+  auto first = interner.Intern(kTenant, Parse(kKey, kTenant));
+  auto second = interner.Lookup(kKey, kTenant, TransportSize(kKey, kTenant));
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(second->DebugString(), absl::StrCat(kKey, ": ", kTenant));
+  EXPECT_EQ(second->transport_size(), first.transport_size());
+  EXPECT_EQ(ValueStorage(*second), ValueStorage(first));
+  EXPECT_EQ(second->key().data(), first.key().data());
+}
+
+TEST(HPackParserInternerTest, SharesKnownKeyStorage) {
+  HPackParserInterner interner;
+  auto first = interner.Intern(kUserAgent, Parse("user-agent", kUserAgent));
+  auto second = interner.Lookup("user-agent", kUserAgent,
+                                TransportSize("user-agent", kUserAgent));
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(ValueStorage(*second), ValueStorage(first));
+}
+
+TEST(HPackParserInternerTest, KeyAndValueMustBothMatch) {
+  HPackParserInterner interner;
+  interner.Intern(kTenant, Parse("x-tenant", kTenant));
+  EXPECT_FALSE(interner.Lookup("x-other", kTenant, 0).has_value());
+  EXPECT_FALSE(interner.Lookup("x-tenant", "acme", 0).has_value());
+}
+
+TEST(HPackParserInternerTest, KeepsTransportSizeOfLookup) {
+  HPackParserInterner interner;
+  interner.Intern(kTenant, Parse("x-tenant", kTenant));
+  // The same value may take a different number of bytes on the wire, e.g.
+  // binary values that are base64 encoded or not.
+  auto md = interner.Lookup("x-tenant", kTenant, 100);
+  ASSERT_TRUE(md.has_value());
+  EXPECT_EQ(md->transport_size(), 100);
+}
+
+TEST(HPackParserInternerTest, SkipsLargeEntries) {
+  HPackParserInterner interner;
+  const std::string value(HPackParserInterner::kMaxEntryBytes, 'a');
+  interner.Intern(value, Parse("x-large", value));
+  EXPECT_FALSE(interner.Lookup("x-large", value, 0).has_value());
+  EXPECT_EQ(interner.TestOnlyBytes(), 0);
+}
+
+constexpr size_t kShardBytes =
+    HPackParserInterner::kMaxBytes / HPackParserInterner::kNumShards;
+// Number of entries of kMaxEntryBytes that fill a shard.
+constexpr int kShardFill = kShardBytes / HPackParserInterner::kMaxEntryBytes;
+
+// Returns n values of entries of exactly kMaxEntryBytes for key "x-a", which
+// all belong to the same shard.
+std::vector<std::string> SameShardValues(size_t n) {
+  std::vector<std::string> values;
+  for (int i = 0; values.size() < n; ++i) {
+    std::string value = absl::StrCat(i, "-");
+    value.resize(HPackParserInterner::kMaxEntryBytes -
+                     hpack_constants::kEntryOverhead - 3,
+                 'v');
+    if (values.empty() ||
+        HPackParserInterner::ShardIndex("x-a", value) ==
+            HPackParserInterner::ShardIndex("x-a", values[0])) {
+      values.push_back(std::move(value));
+    }
+  }
+  return values;
+}
+
+TEST(HPackParserInternerTest, EvictsUnreferencedEntriesFirst) {
+  HPackParserInterner interner;
+  const auto values = SameShardValues(kShardFill + 1);
+  for (int i = 0; i < kShardFill; ++i) {
+    interner.Intern(values[i], Parse("x-a", values[i]));
+  }
+  EXPECT_EQ(interner.TestOnlyBytes(), kShardBytes);
+  ASSERT_TRUE(interner.Lookup("x-a", values[0], 0).has_value());
+  // Entry 0 was looked up, so entry 1 is the first to go.
+  interner.Intern(values[kShardFill], Parse("x-a", values[kShardFill]));
+  EXPECT_EQ(interner.TestOnlyBytes(), kShardBytes);
+  EXPECT_TRUE(interner.Lookup("x-a", values[0], 0).has_value());
+  EXPECT_FALSE(interner.Lookup("x-a", values[1], 0).has_value());
+  EXPECT_TRUE(interner.Lookup("x-a", values[2], 0).has_value());
+  EXPECT_TRUE(interner.Lookup("x-a", values[kShardFill], 0).has_value());
+}
+
+TEST(HPackParserInternerTest, CachesShareEntries) {
+  auto interner = MakeRefCounted<HPackParserInterner>();
+  HPackParserInterner::Cache first(interner);
+  HPackParserInterner::Cache second(interner);
+  auto interned = first.Intern(kTenant, Parse("x-tenant", kTenant));
+  EXPECT_FALSE(second.Lookup("x-other", kTenant, 0).has_value());
+  for (int i = 0; i < 2; ++i) {
+    // Found in the interner, then in the cache of second.
+    auto md = second.Lookup("x-tenant", kTenant,
+                            TransportSize("x-tenant", kTenant));
+    ASSERT_TRUE(md.has_value());
+    EXPECT_EQ(ValueStorage(*md), ValueStorage(interned));
+  }
+}
+
+TEST(HPackParserInternerTest, CachesDropForgottenEntries) {
+  auto interner = MakeRefCounted<HPackParserInterner>();
+  HPackParserInterner::Cache cache(interner);
+  const auto values = SameShardValues(kShardFill + 1);
+  cache.Intern(values[0], Parse("x-a", values[0]));
+  ASSERT_TRUE(cache.Lookup("x-a", values[0], 0).has_value());
+  // The interner forgets entry 0 once it was passed over twice.
+  for (int round = 0; round < 2; ++round) {
+    for (int i = 1; i <= kShardFill; ++i) {
+      interner->Intern(values[i], Parse("x-a", values[i]));
+    }
+  }
+  EXPECT_FALSE(interner->Lookup("x-a", values[0], 0).has_value());
+  EXPECT_FALSE(cache.Lookup("x-a", values[0], 0).has_value());
+}
+
+TEST(HPackParserInternerTest, DoesNotRetainSecrets) {
+  HPackParserInterner interner;
+  for (absl::string_view key :
+       {"authorization", "proxy-authorization", "cookie", "set-cookie",
+        "x-acme-token-bin"}) {
+    SCOPED_TRACE(key);
+    auto md = Parse(key, kTenant);
+    const char* storage = ValueStorage(md);
+    // The entry keeps its own storage rather than a shared copy.
+    auto result = interner.Intern(kTenant, std::move(md));
+    EXPECT_EQ(ValueStorage(result), storage);
+    EXPECT_FALSE(interner.Lookup(key, kTenant, 0).has_value());
+  }
+  EXPECT_EQ(interner.TestOnlyBytes(), 0);
+}
+
+TEST(HPackParserInternerTest, EachChannelHasItsOwnInterner) {
+  const auto& preconditioning =
+      CoreConfiguration::Get().channel_args_preconditioning();
+  ChannelArgs first = preconditioning.PreconditionChannelArgs(nullptr);
+  ChannelArgs second = preconditioning.PreconditionChannelArgs(nullptr);
+  ASSERT_NE(first.GetObject<HPackParserInterner>(), nullptr);
+  ASSERT_NE(second.GetObject<HPackParserInterner>(), nullptr);
+  EXPECT_NE(first.GetObject<HPackParserInterner>(),
+            second.GetObject<HPackParserInterner>());
+  // Channel args compare interners by identity.
+  EXPECT_NE(first, second);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("hpack_shared_interning", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestGrpcScope grpc_scope;
+  return RUN_ALL_TESTS();
+}
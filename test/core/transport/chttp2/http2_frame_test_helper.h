@@ -91,6 +91,15 @@ class Http2FrameTestHelper {
         Http2SettingsFrame{false, std::move(settings)});
   }
 
+  EventEngineSlice EventEngineSliceFromHttp2ServerSettingsFrameDefault() const {
+    std::vector<Http2SettingsFrame::Setting> settings;
+    settings.push_back({Http2Settings::kInitialWindowSizeWireId, 65535u});
+    settings.push_back({Http2Settings::kMaxHeaderListSizeWireId, 16384u});
+    settings.push_back({Http2Settings::kGrpcAllowTrueBinaryMetadataWireId, 1u});
+    return EventEngineSliceFromHttp2Frame(
+        Http2SettingsFrame{false, std::move(settings)});
+  }
+
   EventEngineSlice EventEngineSliceFromHttp2PingFrame(
       bool ack = false, uint64_t opaque = 0x123456789abcdef0) const {
     return EventEngineSliceFromHttp2Frame(Http2PingFrame{ack, opaque});
@@ -20,14 +20,23 @@
 
 #include <grpc/event_engine/slice.h>
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/http2_status.h"
+#include "src/core/ext/transport/chttp2/transport/transport_common.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/util/orphanable.h"
 #include "test/core/transport/chttp2/http2_frame_test_helper.h"
 #include "test/core/transport/util/mock_promise_endpoint.h"
@@ -42,6 +51,43 @@ using transport::testing::Http2FrameTestHelper;
 using util::testing::MockPromiseEndpoint;
 using util::testing::TransportTest;
 
+// Encoded string of header ":path: /demo.Service/Step".
+static const std::vector<uint8_t> kPathDemoServiceStep = {
+    0x40, 0x05, 0x3a, 0x70, 0x61, 0x74, 0x68, 0x12, 0x2f,
+    0x64, 0x65, 0x6d, 0x6f, 0x2e, 0x53, 0x65, 0x72, 0x76,
+    0x69, 0x63, 0x65, 0x2f, 0x53, 0x74, 0x65, 0x70};
+
+// Parses the frames that the transport wrote to the endpoint. How the frames
+// were batched into writes is not checked.
+static std::vector<Http2Frame> ParseWrittenFrames(SliceBuffer& writes) {
+  std::vector<Http2Frame> frames;
+  while (writes.Length() >= kFrameHeaderSize) {
+    uint8_t header_bytes[kFrameHeaderSize];
+    writes.MoveFirstNBytesIntoBuffer(kFrameHeaderSize, header_bytes);
+    Http2FrameHeader header = Http2FrameHeader::Parse(header_bytes);
+    SliceBuffer payload;
+    writes.MoveFirstNBytesIntoSliceBuffer(header.length, payload);
+    ValueOrHttp2Status<Http2Frame> frame =
+        ParseFramePayload(header, std::move(payload));
+    EXPECT_TRUE(frame.IsOk()) << frame.DebugString();
+    if (frame.IsOk()) frames.push_back(TakeValue(std::move(frame)));
+  }
+  EXPECT_EQ(writes.Length(), 0u);
+  return frames;
+}
+
+template <typename T>
+static std::vector<const T*> FramesOfType(
+    const std::vector<Http2Frame>& frames) {
+  std::vector<const T*> result;
+  for (const Http2Frame& frame : frames) {
+    if (const T* typed_frame = std::get_if<T>(&frame)) {
+      result.push_back(typed_frame);
+    }
+  }
+  return result;
+}
+
 class Http2ServerTransportTest : public TransportTest {
  public:
   Http2ServerTransportTest() {
@@ -64,8 +110,13 @@ TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportObjectCreation) {
   LOG(INFO) << "TestHttp2ServerTransportObjectCreation Begin";
   MockPromiseEndpoint mock_endpoint(/*port=*/1000);
 
+  mock_endpoint.ExpectWrite(
+      {helper_.EventEngineSliceFromHttp2ServerSettingsFrameDefault()},
+      event_engine().get());
   mock_endpoint.ExpectRead(
-      {helper_.EventEngineSliceFromHttp2DataFrame(
+      {EventEngineSlice(
+           grpc_slice_from_copied_string(GRPC_CHTTP2_CLIENT_CONNECT_STRING)),
+       helper_.EventEngineSliceFromHttp2DataFrame(
            /*payload=*/"Hello!", /*stream_id=*/9, /*end_stream=*/false),
        helper_.EventEngineSliceFromHttp2DataFrame(
            /*payload=*/"Bye!", /*stream_id=*/11, /*end_stream=*/true)},
@@ -90,6 +141,223 @@ TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportObjectCreation) {
   LOG(INFO) << "TestHttp2ServerTransportObjectCreation End";
 }
 
+TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportPingAck) {
+  // Event Engine      : FuzzingEventEngine
+  // This test asserts :
+  // 1. The server reads the connection preface of the client.
+  // 2. The server sends its SETTINGS frame first, then acknowledges the PING
+  // of the client.
+
+  LOG(INFO) << "TestHttp2ServerTransportPingAck Begin";
+  MockPromiseEndpoint mock_endpoint(/*port=*/1000);
+
+  mock_endpoint.ExpectWrite(
+      {helper_.EventEngineSliceFromHttp2ServerSettingsFrameDefault()},
+      event_engine().get());
+  mock_endpoint.ExpectRead(
+      {EventEngineSlice(
+           grpc_slice_from_copied_string(GRPC_CHTTP2_CLIENT_CONNECT_STRING)),
+       helper_.EventEngineSliceFromHttp2PingFrame(/*ack=*/false,
+                                                  /*opaque=*/1234)},
+      event_engine().get());
+  mock_endpoint.ExpectWrite(
+      {helper_.EventEngineSliceFromHttp2PingFrame(/*ack=*/true,
+                                                  /*opaque=*/1234)},
+      event_engine().get());
+  mock_endpoint.ExpectReadClose(absl::UnavailableError("Connection closed"),
+                                event_engine().get());
+
+  auto server_transport = MakeOrphanable<Http2ServerTransport>(
+      std::move(mock_endpoint.promise_endpoint), GetChannelArgs(),
+      event_engine());
+
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+  LOG(INFO) << "TestHttp2ServerTransportPingAck End";
+}
+
+TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportPingAbuse) {
+  // Event Engine      : FuzzingEventEngine
+  // This test asserts :
+  // 1. A client that sends more pings than the server allows while there is
+  // no call gets a GOAWAY with ENHANCE_YOUR_CALM and "too_many_pings".
+  // 2. The SETTINGS and PING ack frames written by the server do not forgive
+  // the ping strikes of the client.
+
+  LOG(INFO) << "TestHttp2ServerTransportPingAbuse Begin";
+  MockPromiseEndpoint mock_endpoint(/*port=*/1000);
+  SliceBuffer writes;
+  mock_endpoint.CaptureWrites(writes, event_engine().get());
+  // The first ping is allowed, each of the next two is a strike.
+  mock_endpoint.ExpectRead(
+      {EventEngineSlice(
+           grpc_slice_from_copied_string(GRPC_CHTTP2_CLIENT_CONNECT_STRING)),
+       helper_.EventEngineSliceFromHttp2SettingsFrameAck({}),
+       helper_.EventEngineSliceFromHttp2PingFrame(/*ack=*/false,
+                                                  /*opaque=*/1),
+       helper_.EventEngineSliceFromHttp2PingFrame(/*ack=*/false,
+                                                  /*opaque=*/2),
+       helper_.EventEngineSliceFromHttp2PingFrame(/*ack=*/false,
+                                                  /*opaque=*/3)},
+      event_engine().get());
+
+  auto server_transport = MakeOrphanable<Http2ServerTransport>(
+      std::move(mock_endpoint.promise_endpoint),
+      GetChannelArgs().Set(GRPC_ARG_HTTP2_MAX_PING_STRIKES, 1),
+      event_engine());
+
+  event_engine()->TickUntilIdle();
+  std::vector<Http2Frame> frames = ParseWrittenFrames(writes);
+  std::vector<const Http2GoawayFrame*> goaways =
+      FramesOfType<Http2GoawayFrame>(frames);
+  ASSERT_EQ(goaways.size(), 1u);
+  EXPECT_EQ(goaways[0]->error_code,
+            static_cast<uint32_t>(Http2ErrorCode::kEnhanceYourCalm));
+  EXPECT_EQ(goaways[0]->debug_data.as_string_view(), "too_many_pings");
+  for (const Http2PingFrame* ping : FramesOfType<Http2PingFrame>(frames)) {
+    EXPECT_TRUE(ping->ack);
+    EXPECT_NE(ping->opaque, 3u);
+  }
+  event_engine()->UnsetGlobalHooks();
+  LOG(INFO) << "TestHttp2ServerTransportPingAbuse End";
+}
+
+TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportFlowControlOverflow) {
+  // Event Engine      : FuzzingEventEngine
+  // This test asserts :
+  // 1. A WINDOW_UPDATE that grows the connection window of the server beyond
+  // 2^31-1 is a connection error of type FLOW_CONTROL_ERROR.
+
+  LOG(INFO) << "TestHttp2ServerTransportFlowControlOverflow Begin";
+  MockPromiseEndpoint mock_endpoint(/*port=*/1000);
+  SliceBuffer writes;
+  mock_endpoint.CaptureWrites(writes, event_engine().get());
+  mock_endpoint.ExpectRead(
+      {EventEngineSlice(
+           grpc_slice_from_copied_string(GRPC_CHTTP2_CLIENT_CONNECT_STRING)),
+       helper_.EventEngineSliceFromHttp2SettingsFrameAck({}),
+       helper_.EventEngineSliceFromHttp2WindowUpdateFrame(
+           /*stream_id=*/0, /*increment=*/RFC9113::kMaxStreamId31Bit)},
+      event_engine().get());
+
+  auto server_transport = MakeOrphanable<Http2ServerTransport>(
+      std::move(mock_endpoint.promise_endpoint), GetChannelArgs(),
+      event_engine());
+
+  event_engine()->TickUntilIdle();
+  std::vector<Http2Frame> frames = ParseWrittenFrames(writes);
+  std::vector<const Http2GoawayFrame*> goaways =
+      FramesOfType<Http2GoawayFrame>(frames);
+  ASSERT_EQ(goaways.size(), 1u);
+  EXPECT_EQ(goaways[0]->error_code,
+            static_cast<uint32_t>(Http2ErrorCode::kFlowControlError));
+  event_engine()->UnsetGlobalHooks();
+  LOG(INFO) << "TestHttp2ServerTransportFlowControlOverflow End";
+}
+
+TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportMaxConcurrentStreams) {
+  // Event Engine      : FuzzingEventEngine
+  // This test asserts :
+  // 1. Once the client has acked MAX_CONCURRENT_STREAMS, a stream beyond the
+  // limit is reset with REFUSED_STREAM, so the client may retry it.
+  // 2. The stream within the limit is not reset.
+
+  LOG(INFO) << "TestHttp2ServerTransportMaxConcurrentStreams Begin";
+  MockPromiseEndpoint mock_endpoint(/*port=*/1000);
+  SliceBuffer writes;
+  mock_endpoint.CaptureWrites(writes, event_engine().get());
+  const std::string path_header(kPathDemoServiceStep.begin(),
+                                kPathDemoServiceStep.end());
+  mock_endpoint.ExpectRead(
+      {EventEngineSlice(
+           grpc_slice_from_copied_string(GRPC_CHTTP2_CLIENT_CONNECT_STRING)),
+       helper_.EventEngineSliceFromHttp2SettingsFrameAck({}),
+       helper_.EventEngineSliceFromHttp2HeaderFrame(path_header,
+                                                    /*stream_id=*/1),
+       helper_.EventEngineSliceFromHttp2HeaderFrame(path_header,
+                                                    /*stream_id=*/3)},
+      event_engine().get());
+  auto read_close = mock_endpoint.ExpectDelayedReadClose(
+      absl::UnavailableError("Connection closed"), event_engine().get());
+
+  auto server_transport = MakeOrphanable<Http2ServerTransport>(
+      std::move(mock_endpoint.promise_endpoint),
+      GetChannelArgs().Set(GRPC_ARG_MAX_CONCURRENT_STREAMS, 1),
+      event_engine());
+
+  event_engine()->TickUntilIdle();
+  std::vector<Http2Frame> frames = ParseWrittenFrames(writes);
+  std::vector<const Http2RstStreamFrame*> resets =
+      FramesOfType<Http2RstStreamFrame>(frames);
+  ASSERT_EQ(resets.size(), 1u);
+  EXPECT_EQ(resets[0]->stream_id, 3u);
+  EXPECT_EQ(resets[0]->error_code,
+            static_cast<uint32_t>(Http2ErrorCode::kRefusedStream));
+  read_close();
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+  LOG(INFO) << "TestHttp2ServerTransportMaxConcurrentStreams End";
+}
+
+TEST_F(Http2ServerTransportTest, TestHttp2ServerTransportGracefulGoaway) {
+  // Event Engine      : FuzzingEventEngine
+  // This test asserts :
+  // 1. A graceful shutdown first sends a GOAWAY with the maximum stream id,
+  // followed by a PING.
+  // 2. The final GOAWAY carries the last stream id seen by the server. It is
+  // sent once the PING is acked, or once the ack has not come in time.
+
+  LOG(INFO) << "TestHttp2ServerTransportGracefulGoaway Begin";
+  MockPromiseEndpoint mock_endpoint(/*port=*/1000);
+  SliceBuffer writes;
+  mock_endpoint.CaptureWrites(writes, event_engine().get());
+  // A GOAWAY from the client starts the graceful shutdown of the server.
+  mock_endpoint.ExpectRead(
+      {EventEngineSlice(
+           grpc_slice_from_copied_string(GRPC_CHTTP2_CLIENT_CONNECT_STRING)),
+       helper_.EventEngineSliceFromHttp2SettingsFrameAck({}),
+       helper_.EventEngineSliceFromHttp2GoawayFrame(
+           /*debug_data=*/"bye", /*last_stream_id=*/0,
+           /*error_code=*/static_cast<uint32_t>(Http2ErrorCode::kNoError))},
+      event_engine().get());
+  auto read_close = mock_endpoint.ExpectDelayedReadClose(
+      absl::UnavailableError("Connection closed"), event_engine().get());
+
+  auto server_transport = MakeOrphanable<Http2ServerTransport>(
+      std::move(mock_endpoint.promise_endpoint), GetChannelArgs(),
+      event_engine());
+
+  // The client never acks the PING, so the final GOAWAY is sent once the
+  // ping timeout of the graceful shutdown has passed.
+  event_engine()->TickUntilIdle();
+  std::vector<Http2Frame> frames = ParseWrittenFrames(writes);
+  size_t first_goaway = frames.size();
+  size_t ping = frames.size();
+  size_t final_goaway = frames.size();
+  for (size_t i = 0; i < frames.size(); ++i) {
+    if (const auto* goaway = std::get_if<Http2GoawayFrame>(&frames[i])) {
+      EXPECT_EQ(goaway->error_code,
+                static_cast<uint32_t>(Http2ErrorCode::kNoError));
+      if (goaway->last_stream_id == RFC9113::kMaxStreamId31Bit) {
+        first_goaway = i;
+      } else {
+        EXPECT_EQ(goaway->last_stream_id, 0u);
+        final_goaway = i;
+      }
+    } else if (const auto* ping_frame =
+                   std::get_if<Http2PingFrame>(&frames[i])) {
+      if (!ping_frame->ack) ping = i;
+    }
+  }
+  ASSERT_LT(final_goaway, frames.size());
+  EXPECT_LT(first_goaway, ping);
+  EXPECT_LT(ping, final_goaway);
+  read_close();
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+  LOG(INFO) << "TestHttp2ServerTransportGracefulGoaway End";
+}
+
 }  // namespace testing
 }  // namespace http2
 }  // namespace grpc_core
@@ -31,6 +31,7 @@
 #include "gtest/gtest.h"
 #include "src/core/call/message.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
@@ -423,6 +424,38 @@ TEST(GrpcMessageDisassemblerTest, TwoMessageThreeFrames) {
   EXPECT_EQ(total_bytes_counter, expected_size * 2);
 }
 
+TEST(GrpcMessageDisassemblerTest, ManySmallMessagesOneFrame) {
+  constexpr absl::string_view kSmall = "telemetry";
+  constexpr int kNumMessages = 100;
+  const size_t expected_size = kGrpcHeaderSizeInBytes + kSmall.size();
+
+  const uint32_t stream_id = 1;
+  GrpcMessageDisassembler disassembler;
+  for (int i = 0; i < kNumMessages; ++i) {
+    SliceBuffer payload;
+    payload.Append(Slice::FromCopiedString(kSmall));
+    disassembler.PrepareBatchedMessageForSending(
+        Arena::MakePooled<Message>(std::move(payload), kFlags0));
+    EXPECT_EQ(disassembler.GetBufferedLength(), expected_size * (i + 1));
+  }
+
+  Http2DataFrame frame = disassembler.GenerateNextFrame(
+      stream_id, expected_size * kNumMessages, kNotEndStream);
+  EXPECT_EQ(frame.payload.Length(), expected_size * kNumMessages);
+  EXPECT_EQ(disassembler.GetBufferedLength(), 0);
+  if (IsChttp2PackSmallMessagesEnabled()) {
+    EXPECT_EQ(frame.payload.Count(), 1);
+  }
+
+  GrpcMessageAssembler assembler;
+  EXPECT_TRUE(assembler.AppendNewDataFrame(frame.payload, kEndStream).IsOk());
+  for (int i = 0; i < kNumMessages; ++i) {
+    ExpectMessagePayload(assembler.ExtractMessage(), kSmall.size(), kFlags0,
+                         kSmall);
+  }
+  ExpectMessageNull(assembler.ExtractMessage());
+}
+
 TEST(GrpcMessageDisassemblerTest, GenerateEmptyEndFrame) {
   const uint32_t stream_id = 1;
   GrpcMessageDisassembler disassembler;
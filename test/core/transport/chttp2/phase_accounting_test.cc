@@ -0,0 +1,115 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/phase_accounting.h"
+
+#include <grpc/grpc.h>
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+namespace {
+
+using Phase = Chttp2PhaseAccounting::Phase;
+
+class PhaseAccountingTest : public ::testing::Test {
+ protected:
+  ~PhaseAccountingTest() override { Chttp2PhaseAccounting::SetEnabled(false); }
+};
+
+TEST_F(PhaseAccountingTest, DisabledByDefault) {
+  EXPECT_FALSE(Chttp2PhaseAccounting::Enabled());
+  Chttp2PhaseAccounting accounting;
+  { Chttp2PhaseAccounting::Timer timer(&accounting, Phase::kReadParsing); }
+  EXPECT_EQ(accounting.runs(Phase::kReadParsing), 0u);
+}
+
+TEST_F(PhaseAccountingTest, EnabledByConfigVar) {
+  ConfigVars::Overrides overrides;
+  overrides.chttp2_phase_accounting = true;
+  ConfigVars::SetOverrides(overrides);
+  CoreConfiguration::Reset();
+  CoreConfiguration::Get();
+  EXPECT_TRUE(Chttp2PhaseAccounting::Enabled());
+  ConfigVars::SetOverrides({});
+  CoreConfiguration::Reset();
+  CoreConfiguration::Get();
+  EXPECT_FALSE(Chttp2PhaseAccounting::Enabled());
+}
+
+TEST_F(PhaseAccountingTest, TimerRecordsWhenEnabled) {
+  Chttp2PhaseAccounting::SetEnabled(true);
+  Chttp2PhaseAccounting accounting;
+  { Chttp2PhaseAccounting::Timer timer(&accounting, Phase::kWriteAssembly); }
+  {
+    Chttp2PhaseAccounting::Timer timer(&accounting, Phase::kWriteAssembly);
+    // Switching accounting off does not drop a run already being timed.
+    Chttp2PhaseAccounting::SetEnabled(false);
+  }
+  { Chttp2PhaseAccounting::Timer timer(&accounting, Phase::kWriteAssembly); }
+  EXPECT_EQ(accounting.runs(Phase::kWriteAssembly), 2u);
+  EXPECT_GE(accounting.total_nanos(Phase::kWriteAssembly), 0);
+  EXPECT_EQ(accounting.runs(Phase::kEndpointWrite), 0u);
+}
+
+TEST_F(PhaseAccountingTest, AccumulatesPerPhase) {
+  Chttp2PhaseAccounting accounting;
+  accounting.RecordNanos(Phase::kHeaderDecode, 3000);
+  accounting.RecordNanos(Phase::kHeaderDecode, 5000);
+  accounting.RecordNanos(Phase::kEndpointWrite, 7000);
+  // Negative durations, from a cycle counter that stepped back, count as zero.
+  accounting.RecordNanos(Phase::kEndpointWrite, -100);
+  EXPECT_EQ(accounting.runs(Phase::kHeaderDecode), 2u);
+  EXPECT_EQ(accounting.total_nanos(Phase::kHeaderDecode), 8000);
+  EXPECT_EQ(accounting.max_nanos(Phase::kHeaderDecode), 5000);
+  EXPECT_EQ(accounting.runs(Phase::kEndpointWrite), 2u);
+  EXPECT_EQ(accounting.total_nanos(Phase::kEndpointWrite), 7000);
+  EXPECT_EQ(accounting.runs(Phase::kReadParsing), 0u);
+}
+
+TEST_F(PhaseAccountingTest, RecordsIntoStatsCollector) {
+  auto stats = std::make_shared<Http2StatsCollector>();
+  Chttp2PhaseAccounting accounting;
+  accounting.SetHttp2StatsCollector(stats);
+  accounting.RecordNanos(Phase::kReadParsing, 20000);
+  accounting.RecordNanos(Phase::kReadParsing, 20000);
+  accounting.RecordNanos(Phase::kEndpointWrite, 1000);
+  auto count = [](const Histogram_1000000_8_8& histogram) {
+    int total = 0;
+    for (size_t i = 0; i < histogram.bucket_count(); ++i) {
+      total += histogram.buckets()[i];
+    }
+    return total;
+  };
+  EXPECT_EQ(count(stats->View().http2_read_parsing_time), 2);
+  EXPECT_EQ(count(stats->View().http2_endpoint_write_time), 1);
+  EXPECT_EQ(count(stats->View().http2_header_decode_time), 0);
+  EXPECT_EQ(count(stats->View().http2_write_assembly_time), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,127 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_deficit.h"
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kBulk = 1024 * 1024;
+
+TEST(WriteDeficitTest, BulkStreamEarnsOneQuantumPerTurn) {
+  Chttp2WriteDeficit deficit;
+  EXPECT_EQ(deficit.BeginTurn(kBulk), Chttp2WriteDeficit::Quantum());
+  deficit.EndTurn(Chttp2WriteDeficit::Quantum(),
+                  kBulk - Chttp2WriteDeficit::Quantum());
+  EXPECT_EQ(deficit.deficit(), 0);
+  EXPECT_EQ(deficit.BeginTurn(kBulk), Chttp2WriteDeficit::Quantum());
+}
+
+TEST(WriteDeficitTest, WeightScalesQuantum) {
+  Chttp2WriteDeficit deficit;
+  deficit.SetWeight(3);
+  EXPECT_EQ(deficit.BeginTurn(kBulk), 3 * Chttp2WriteDeficit::Quantum());
+}
+
+TEST(WriteDeficitTest, WeightIsClamped) {
+  Chttp2WriteDeficit deficit;
+  deficit.SetWeight(0);
+  EXPECT_EQ(deficit.weight(), 1);
+  deficit.SetWeight(1000000);
+  EXPECT_EQ(deficit.weight(), Chttp2WriteDeficit::MaxWeight());
+}
+
+TEST(WriteDeficitTest, SmallWritesAreCharged) {
+  Chttp2WriteDeficit deficit;
+  EXPECT_TRUE(deficit.InFastLane(100));
+  EXPECT_EQ(deficit.BeginTurn(100), 100);
+  deficit.EndTurn(100, 0);
+  EXPECT_EQ(deficit.deficit(), -100);
+  // They also spend the deficit carried over by a bulk stream.
+  Chttp2WriteDeficit bulk;
+  bulk.BeginTurn(kBulk);
+  bulk.EndTurn(1000, kBulk - 1000);
+  EXPECT_EQ(bulk.deficit(), Chttp2WriteDeficit::Quantum() - 1000);
+  ASSERT_TRUE(bulk.InFastLane(Chttp2WriteDeficit::SmallWrite()));
+  bulk.BeginTurn(Chttp2WriteDeficit::SmallWrite());
+  bulk.EndTurn(Chttp2WriteDeficit::SmallWrite(), 1);
+  EXPECT_EQ(bulk.deficit(), Chttp2WriteDeficit::Quantum() - 1000 -
+                                Chttp2WriteDeficit::SmallWrite());
+}
+
+TEST(WriteDeficitTest, StreamInDebtLeavesFastLane) {
+  Chttp2WriteDeficit deficit;
+  // A stream writing in small pieces gets one of them through the fast lane.
+  deficit.BeginTurn(Chttp2WriteDeficit::SmallWrite());
+  deficit.EndTurn(Chttp2WriteDeficit::SmallWrite(), 0);
+  EXPECT_FALSE(deficit.InFastLane(100));
+  // Its next turn pays the debt back out of its quantum.
+  EXPECT_EQ(deficit.BeginTurn(100),
+            Chttp2WriteDeficit::Quantum() - Chttp2WriteDeficit::SmallWrite());
+  deficit.EndTurn(100, 0);
+  EXPECT_EQ(deficit.deficit(), 0);
+  EXPECT_TRUE(deficit.InFastLane(100));
+}
+
+TEST(WriteDeficitTest, UnspentDeficitCarriesOverWhileBacklogged) {
+  Chttp2WriteDeficit deficit;
+  deficit.BeginTurn(kBulk);
+  // Held back, e.g. by flow control.
+  deficit.EndTurn(0, kBulk);
+  EXPECT_EQ(deficit.BeginTurn(kBulk), 2 * Chttp2WriteDeficit::Quantum());
+  deficit.EndTurn(0, kBulk);
+  // But no more than one quantum is ever carried over.
+  EXPECT_EQ(deficit.BeginTurn(kBulk), 2 * Chttp2WriteDeficit::Quantum());
+}
+
+TEST(WriteDeficitTest, DrainedStreamForfeitsDeficit) {
+  Chttp2WriteDeficit deficit;
+  deficit.BeginTurn(kBulk);
+  deficit.EndTurn(0, kBulk);
+  deficit.BeginTurn(kBulk);
+  deficit.EndTurn(10000, 0);
+  EXPECT_EQ(deficit.deficit(), 0);
+}
+
+TEST(WriteDeficitTest, BulkStreamsShareByWeight) {
+  Chttp2WriteDeficit light;
+  Chttp2WriteDeficit heavy;
+  heavy.SetWeight(3);
+  // Frames smaller than the quantum do not divide it evenly, so streams have
+  // to carry their remainders over to get their share.
+  constexpr size_t kFrame = 5000;
+  auto turn = [](Chttp2WriteDeficit& deficit) {
+    const size_t allowed = deficit.BeginTurn(kBulk);
+    const size_t written = allowed - allowed % kFrame;
+    deficit.EndTurn(written, kBulk);
+    return written;
+  };
+  size_t light_bytes = 0;
+  size_t heavy_bytes = 0;
+  for (int i = 0; i < 1000; ++i) {
+    light_bytes += turn(light);
+    heavy_bytes += turn(heavy);
+  }
+  EXPECT_NEAR(static_cast<double>(heavy_bytes) / light_bytes, 3.0, 0.01);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
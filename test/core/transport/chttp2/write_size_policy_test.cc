@@ -116,6 +116,90 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+// Write of `size` bytes from `start` to `start + 10`ms, during which the
+// endpoint reports `metrics` if it was asked to.
+void SampledWrite(Chttp2WriteSizePolicy& policy, ScopedTimeCache& time_cache,
+                  int start, size_t size,
+                  Chttp2WriteSizePolicy::EndpointMetrics metrics) {
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                            Duration::Milliseconds(start));
+  auto sample = policy.MaybeSampleEndpoint();
+  policy.BeginWrite(size);
+  if (sample != nullptr) sample->Set(metrics);
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                            Duration::Milliseconds(start + 10));
+  policy.EndWrite(true);
+}
+
+TEST(WriteSizePolicyTest, QueuedBytesLimitBurst) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteSizePolicy policy;
+  Chttp2WriteSizePolicy::EndpointMetrics metrics;
+  // 100000 bytes per round trip, of which 150000 are still queued.
+  metrics.pacing_rate = 100000000;
+  metrics.min_rtt_us = 1000;
+  metrics.notsent_bytes = 150000;
+  SampledWrite(policy, time_cache, 10000, 131072, metrics);
+  EXPECT_EQ(policy.WriteTargetSize(), 50000);
+  EXPECT_EQ(policy.last_limit(), Chttp2WriteSizePolicy::Limit::kBurst);
+}
+
+TEST(WriteSizePolicyTest, BurstLimitIsAtLeastMinTarget) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteSizePolicy policy;
+  Chttp2WriteSizePolicy::EndpointMetrics metrics;
+  metrics.congestion_window = 10;
+  metrics.notsent_bytes = 1000000;
+  SampledWrite(policy, time_cache, 10000, 131072, metrics);
+  EXPECT_EQ(policy.WriteTargetSize(), Chttp2WriteSizePolicy::MinTarget());
+  EXPECT_EQ(policy.last_limit(), Chttp2WriteSizePolicy::Limit::kBurst);
+}
+
+TEST(WriteSizePolicyTest, FastPacingRaisesTarget) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteSizePolicy policy;
+  Chttp2WriteSizePolicy::EndpointMetrics metrics;
+  // 2000000 bytes per round trip.
+  metrics.pacing_rate = 1000000000;
+  metrics.min_rtt_us = 2000;
+  metrics.notsent_bytes = 0;
+  SampledWrite(policy, time_cache, 10000, 131072, metrics);
+  EXPECT_EQ(policy.WriteTargetSize(), 500000);
+  EXPECT_EQ(policy.last_limit(), Chttp2WriteSizePolicy::Limit::kPacing);
+}
+
+TEST(WriteSizePolicyTest, StaleSamplesAreIgnored) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteSizePolicy policy;
+  Chttp2WriteSizePolicy::EndpointMetrics metrics;
+  metrics.pacing_rate = 1000000000;
+  metrics.min_rtt_us = 2000;
+  SampledWrite(policy, time_cache, 10000, 131072, metrics);
+  EXPECT_EQ(policy.WriteTargetSize(), 500000);
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                            Duration::Seconds(12));
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  EXPECT_EQ(policy.last_limit(), Chttp2WriteSizePolicy::Limit::kWriteLatency);
+}
+
+TEST(WriteSizePolicyTest, SamplesAreRateLimited) {
+  ScopedTimeCache time_cache;
+  Chttp2WriteSizePolicy policy;
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                            Duration::Seconds(10));
+  auto sample = policy.MaybeSampleEndpoint();
+  EXPECT_NE(sample, nullptr);
+  // Only one sample is outstanding at a time.
+  EXPECT_EQ(policy.MaybeSampleEndpoint(), nullptr);
+  policy.BeginWrite(131072);
+  policy.EndWrite(true);
+  EXPECT_EQ(policy.MaybeSampleEndpoint(), nullptr);
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                            Duration::Seconds(10) +
+                            Chttp2WriteSizePolicy::EndpointSampleInterval());
+  EXPECT_NE(policy.MaybeSampleEndpoint(), nullptr);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -20,6 +20,7 @@
 #include "absl/log/check.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/util/sync.h"
 #include "test/core/test_util/test_config.h"
 
@@ -27,6 +28,7 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
 
 grpc_core::Mutex globalMu;
@@ -122,10 +124,52 @@ void BM_MultithreadedStdDequeLIFO(benchmark::State& state) {
 }
 BENCHMARK(BM_MultithreadedStdDequeLIFO)->Apply(MultithreadedTestArguments);
 
+// The usage pattern of the thread pool: thread 0 owns the queue, and adds and
+// pops its most recent closures, while the other threads steal the oldest
+// ones.
+template <typename Queue>
+void BM_MultithreadedWorkQueueOwnerAndThieves(benchmark::State& state) {
+  // Set up by thread 0 before, and deleted after, the benchmark loop: all
+  // threads wait for each other at both ends of it.
+  static Queue* queue;
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  if (state.thread_index() == 0) {
+    queue = new Queue();
+  }
+  double popped = 0;
+  double stolen = 0;
+  if (state.thread_index() == 0) {
+    for (auto _ : state) {
+      for (int i = 0; i < element_count; i++) queue->Add(&closure);
+      while (!queue->Empty()) {
+        if (queue->PopMostRecent() != nullptr) ++popped;
+      }
+    }
+  } else {
+    for (auto _ : state) {
+      if (queue->PopOldest() != nullptr) ++stolen;
+    }
+  }
+  state.counters["popped"] =
+      benchmark::Counter(popped, benchmark::Counter::kIsRate);
+  state.counters["stolen"] =
+      benchmark::Counter(stolen, benchmark::Counter::kIsRate);
+  if (state.thread_index() == 0) {
+    CHECK(queue->Empty());
+    delete queue;
+  }
+}
+BENCHMARK_TEMPLATE(BM_MultithreadedWorkQueueOwnerAndThieves, BasicWorkQueue)
+    ->Apply(MultithreadedTestArguments);
+BENCHMARK_TEMPLATE(BM_MultithreadedWorkQueueOwnerAndThieves, ChaseLevWorkQueue)
+    ->Apply(MultithreadedTestArguments);
+
 // --- Basic Functionality Tests ---------------------------------------------
 
+template <typename Queue>
 void BM_WorkQueueIntptrPopMostRecent(benchmark::State& state) {
-  BasicWorkQueue queue;
+  Queue queue;
   grpc_event_engine::experimental::AnyInvocableClosure closure([] {});
   int element_count = state.range(0);
   for (auto _ : state) {
@@ -140,13 +184,18 @@ void BM_WorkQueueIntptrPopMostRecent(benchmark::State& state) {
   state.counters["Pop Rate"] =
       benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_WorkQueueIntptrPopMostRecent)
+BENCHMARK_TEMPLATE(BM_WorkQueueIntptrPopMostRecent, BasicWorkQueue)
+    ->Range(1, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_WorkQueueIntptrPopMostRecent, ChaseLevWorkQueue)
     ->Range(1, 512)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
 
+template <typename Queue>
 void BM_WorkQueueClosureExecution(benchmark::State& state) {
-  BasicWorkQueue queue;
+  Queue queue;
   int element_count = state.range(0);
   int run_count = 0;
   grpc_event_engine::experimental::AnyInvocableClosure closure(
@@ -163,13 +212,18 @@ void BM_WorkQueueClosureExecution(benchmark::State& state) {
   state.counters["Pop Rate"] =
       benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_WorkQueueClosureExecution)
+BENCHMARK_TEMPLATE(BM_WorkQueueClosureExecution, BasicWorkQueue)
+    ->Range(8, 128)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_WorkQueueClosureExecution, ChaseLevWorkQueue)
     ->Range(8, 128)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
 
+template <typename Queue>
 void BM_WorkQueueAnyInvocableExecution(benchmark::State& state) {
-  BasicWorkQueue queue;
+  Queue queue;
   int element_count = state.range(0);
   int run_count = 0;
   for (auto _ : state) {
@@ -186,7 +240,11 @@ void BM_WorkQueueAnyInvocableExecution(benchmark::State& state) {
   state.counters["Pop Rate"] =
       benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_WorkQueueAnyInvocableExecution)
+BENCHMARK_TEMPLATE(BM_WorkQueueAnyInvocableExecution, BasicWorkQueue)
+    ->Range(8, 128)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_WorkQueueAnyInvocableExecution, ChaseLevWorkQueue)
     ->Range(8, 128)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
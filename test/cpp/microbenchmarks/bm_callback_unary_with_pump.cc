@@ -0,0 +1,157 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Unary ping pong latency while a bulk stream pumps data over the same
+// connection. Compare runs with GRPC_EXPERIMENTS=chttp2_weighted_fair_writes
+// to see how much the bulk stream delays the unary calls queued behind it.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/callback_test_service.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Writes messages of a given size on a bidi stream for as long as it runs.
+class StreamingPump : public ClientBidiReactor<EchoRequest, EchoResponse> {
+ public:
+  StreamingPump(EchoTestService::Stub* stub, int message_size) {
+    request_.set_message(std::string(message_size, 'a'));
+    stub->async()->BidiStream(&cli_ctx_, this);
+    StartRead(&response_);
+    StartWrite(&request_);
+    StartCall();
+  }
+
+  void OnWriteDone(bool ok) override {
+    bool stopping;
+    {
+      std::lock_guard<std::mutex> l(mu_);
+      stopping = stopping_;
+    }
+    if (ok && !stopping) {
+      StartWrite(&request_);
+    } else {
+      StartWritesDone();
+    }
+  }
+  void OnReadDone(bool ok) override {
+    if (ok) StartRead(&response_);
+  }
+  void OnDone(const Status& s) override {
+    CHECK(s.ok());
+    std::lock_guard<std::mutex> l(mu_);
+    done_ = true;
+    cv_.notify_one();
+  }
+
+  void Stop() {
+    std::unique_lock<std::mutex> l(mu_);
+    stopping_ = true;
+    cv_.wait(l, [this] { return done_; });
+  }
+
+ private:
+  ClientContext cli_ctx_;
+  EchoRequest request_;
+  EchoResponse response_;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool stopping_ = false;
+  bool done_ = false;
+};
+
+template <class Fixture>
+static void BM_CallbackUnaryPingPongWithPump(benchmark::State& state) {
+  const int unary_msgs_size = state.range(0);
+  const int pump_msgs_size = state.range(1);
+  CallbackStreamingTestService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  request.set_message(std::string(unary_msgs_size, 'a'));
+  EchoResponse response;
+  std::unique_ptr<StreamingPump> pump;
+  if (pump_msgs_size > 0) {
+    pump = std::make_unique<StreamingPump>(stub.get(), pump_msgs_size);
+  }
+  std::vector<double> latencies_us;
+  for (auto _ : state) {
+    ClientContext cli_ctx;
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(stub->Echo(&cli_ctx, request, &response).ok());
+    latencies_us.push_back(std::chrono::duration<double, std::micro>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+  }
+  if (pump != nullptr) pump->Stop();
+  stub.reset();
+  fixture.reset();
+  std::sort(latencies_us.begin(), latencies_us.end());
+  auto percentile = [&latencies_us](double p) {
+    return latencies_us[std::min(
+        latencies_us.size() - 1,
+        static_cast<size_t>(p * static_cast<double>(latencies_us.size())))];
+  };
+  state.counters["unary_p50_us"] = percentile(0.5);
+  state.counters["unary_p99_us"] = percentile(0.99);
+}
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+// First argument is the message size of the unary requests
+// Second argument is the message size of the pump, or 0 for no pump
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPongWithPump, TCP)
+    ->Args({0, 0})
+    ->Args({0, 64 * 1024})
+    ->Args({0, 4 * 1024 * 1024})
+    ->Args({1024, 4 * 1024 * 1024});
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
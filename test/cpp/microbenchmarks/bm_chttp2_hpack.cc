@@ -25,11 +25,15 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
 #include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -126,6 +130,54 @@ static void BM_HpackEncoderEncodeDeadline(benchmark::State& state) {
 }
 BENCHMARK(BM_HpackEncoderEncodeDeadline);
 
+static void BM_HuffmanCompress(benchmark::State& state) {
+  // Header values as they typically appear in application metadata.
+  static const absl::string_view kValues[] = {
+      "Bearer ya29.a0AfH6SMBx3fP2kq9v7Lq0wN4sRtYz1uVbXcDe5fGhIj",
+      "6f1c2a9e-3b7d-4e8a-9c05-d2f4b1a7e390",
+      "acme-production-eu-west1",
+      "grpc-c/3.0.0-dev (linux; chttp2; green)",
+      "/grpc.test.FooService/BarMethod",
+  };
+  std::vector<uint8_t> out(256);
+  size_t bytes = 0;
+  for (auto _ : state) {
+    for (absl::string_view value : kValues) {
+      const uint8_t* in = reinterpret_cast<const uint8_t*>(value.data());
+      size_t length = grpc_chttp2_huffman_compressed_length(in, value.size());
+      if (length < value.size()) {
+        grpc_chttp2_huffman_compress_into(in, value.size(), out.data());
+      }
+      benchmark::DoNotOptimize(out.data());
+      bytes += value.size();
+    }
+  }
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_HuffmanCompress);
+
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  std::vector<uint8_t> v(state.range(0));
+  for (auto& b : v) b = static_cast<uint8_t>(rand());
+  grpc_slice input = grpc_slice_from_copied_buffer(
+      reinterpret_cast<const char*>(v.data()), v.size());
+  for (auto _ : state) {
+    uint32_t wire_size;
+    grpc_slice output =
+        grpc_chttp2_base64_encode_and_huffman_compress(input, &wire_size);
+    benchmark::DoNotOptimize(wire_size);
+    grpc_slice_unref(output);
+  }
+  grpc_slice_unref(input);
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+// Sizes of trace contexts, tags and typical auth tokens.
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)
+    ->Arg(29)
+    ->Arg(64)
+    ->Arg(256)
+    ->Arg(1024);
+
 template <class Fixture>
 static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   grpc_core::ExecCtx exec_ctx;
@@ -304,6 +356,33 @@ class RepresentativeServerTrailingMetadata {
   }
 };
 
+// Application defined metadata as commonly attached by clients behind a
+// gateway: mostly lower case ascii tokens, a bearer token and a request id
+// that changes on every call.
+class RepresentativeApplicationMetadata {
+ public:
+  static constexpr bool kEnableTrueBinary = true;
+  static void Prepare(grpc_metadata_batch* b) {
+    RepresentativeClientInitialMetadata::Prepare(b);
+    b->Append("authorization",
+              grpc_core::Slice::FromStaticString(
+                  "Bearer ya29.a0AfH6SMBx3fP2kq9v7Lq0wN4sRtYz1uVbXcDe5fGhIj"),
+              CrashOnAppendError);
+    b->Append("x-tenant-id",
+              grpc_core::Slice::FromStaticString("acme-production-eu-west1"),
+              CrashOnAppendError);
+    b->Append("x-request-id",
+              grpc_core::Slice::FromStaticString(
+                  "6f1c2a9e-3b7d-4e8a-9c05-d2f4b1a7e390"),
+              CrashOnAppendError);
+    b->Append("x-forwarded-for",
+              grpc_core::Slice::FromStaticString("10.128.0.42, 172.16.4.7"),
+              CrashOnAppendError);
+    b->Append("x-envoy-expected-rq-timeout-ms",
+              grpc_core::Slice::FromStaticString("15000"), CrashOnAppendError);
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({0, 16384});
 // test with eof (shouldn't affect anything)
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, EmptyBatch)->Args({1, 16384});
@@ -321,6 +400,10 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<31, false>)
     ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<100, false>)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<256, false>)
+    ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<1024, false>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonBinaryElem)
     ->Args({0, 1});
@@ -337,6 +420,9 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerTrailingMetadata)
     ->Args({1, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
+                   RepresentativeApplicationMetadata)
+    ->Args({0, 16384});
 
 }  // namespace hpack_encoder_fixtures
 
@@ -594,6 +680,47 @@ class NonIndexedBinaryElem<100, false> {
   }
 };
 
+// Several large plain text values that are not added to the table, as sent by
+// applications carrying tokens or serialized context in metadata. Compare
+// runs with GRPC_EXPERIMENTS=hpack_zero_copy_parsing to see the cost of
+// copying the values out of the read buffer. Only the 16KiB values are large
+// enough to be referenced rather than copied, since each of the others is
+// an eighth of the slice.
+template <int kLength>
+class NonIndexedLargeElems {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> bytes;
+    for (int i = 0; i < 8; ++i) {
+      const std::string key = absl::StrCat("x-large-value-", i);
+      // Literal header field without indexing, new name.
+      bytes.push_back(0x00);
+      AppendLength(key.size(), &bytes);
+      bytes.insert(bytes.end(), key.begin(), key.end());
+      AppendLength(kLength, &bytes);
+      for (int j = 0; j < kLength; ++j) bytes.push_back('a' + (i + j) % 26);
+    }
+    return {MakeSlice(bytes)};
+  }
+
+ private:
+  // HPACK integer with a 7 bit prefix and the huffman bit clear.
+  static void AppendLength(size_t length, std::vector<uint8_t>* bytes) {
+    if (length < 0x7f) {
+      bytes->push_back(length);
+      return;
+    }
+    bytes->push_back(0x7f);
+    length -= 0x7f;
+    while (length >= 0x80) {
+      bytes->push_back(0x80 | (length & 0x7f));
+      length >>= 7;
+    }
+    bytes->push_back(length);
+  }
+};
+
 using RepresentativeClientInitialMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::RepresentativeClientInitialMetadata>;
 using RepresentativeServerInitialMetadata = FromEncoderFixture<
@@ -602,6 +729,12 @@ using RepresentativeServerTrailingMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::RepresentativeServerTrailingMetadata>;
 using MoreRepresentativeClientInitialMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::MoreRepresentativeClientInitialMetadata>;
+using RepresentativeApplicationMetadata = FromEncoderFixture<
+    hpack_encoder_fixtures::RepresentativeApplicationMetadata>;
+// Base64 encoded binary values, as sent to peers without true binary support.
+template <int kLength>
+using Base64BinaryElem = FromEncoderFixture<
+    hpack_encoder_fixtures::SingleBinaryElem<kLength, false>>;
 
 // Send the same deadline repeatedly
 class SameDeadline {
@@ -635,6 +768,13 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<3, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<10, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<31, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<100, true>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, Base64BinaryElem<64>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, Base64BinaryElem<256>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, Base64BinaryElem<1024>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedLargeElems<64>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedLargeElems<512>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedLargeElems<4096>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedLargeElems<16384>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
@@ -649,6 +789,8 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    MoreRepresentativeClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
+                   RepresentativeApplicationMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
 
 }  // namespace hpack_parser_fixtures
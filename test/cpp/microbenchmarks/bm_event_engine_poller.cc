@@ -0,0 +1,160 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the readiness notification throughput of the posix EventEngine
+// pollers: each iteration makes a number of registered sockets readable and
+// drives the poller until all of their read closures ran.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+#ifdef GRPC_LINUX_EPOLL
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::EventHandle;
+using ::grpc_event_engine::experimental::MakeEpoll1Poller;
+using ::grpc_event_engine::experimental::MakeIoUringPoller;
+using ::grpc_event_engine::experimental::PosixEngineClosure;
+using ::grpc_event_engine::experimental::PosixEventPoller;
+using ::grpc_event_engine::experimental::Scheduler;
+
+using namespace std::chrono_literals;
+
+// Runs closures inline on the polling thread, so that the benchmark measures
+// the poller rather than the thread pool.
+class InlineScheduler : public Scheduler {
+ public:
+  void Run(EventEngine::Closure* closure) override { closure->Run(); }
+  void Run(absl::AnyInvocable<void()> cb) override { cb(); }
+};
+
+// A socketpair whose read end is registered with the poller. The read closure
+// drains the socket and re-arms itself.
+struct Connection {
+  int write_fd;
+  EventHandle* handle;
+  PosixEngineClosure* on_read;
+};
+
+void RunPollerBenchmark(benchmark::State& state,
+                        std::shared_ptr<PosixEventPoller> poller) {
+  if (poller == nullptr) {
+    state.SkipWithError("poller is not supported on this platform");
+    return;
+  }
+  const int num_connections = state.range(0);
+  const int num_active = state.range(1);
+  std::atomic<int> reads{0};
+  std::vector<Connection> connections(num_connections);
+  for (auto& c : connections) {
+    int fds[2];
+    CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+    c.write_fd = fds[1];
+    c.handle = poller->CreateHandle(poller->posix_interface().Adopt(fds[0]),
+                                    "bm_event_engine_poller", false);
+    c.on_read = PosixEngineClosure::ToPermanentClosure(
+        [&reads, &c, read_fd = fds[0]](absl::Status status) {
+          if (!status.ok()) return;
+          char buf[64];
+          while (read(read_fd, buf, sizeof(buf)) > 0) {
+          }
+          reads.fetch_add(1, std::memory_order_relaxed);
+          c.handle->NotifyOnRead(c.on_read);
+        });
+    c.handle->NotifyOnRead(c.on_read);
+  }
+  // Drain the initial notifications, if any.
+  while (poller->Work(0ms, []() {}) !=
+         grpc_event_engine::experimental::Poller::WorkResult::
+             kDeadlineExceeded) {
+  }
+  int64_t work_calls = 0;
+  for (auto _ : state) {
+    reads.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < num_active; ++i) {
+      CHECK_EQ(write(connections[i].write_fd, "x", 1), 1);
+    }
+    while (reads.load(std::memory_order_relaxed) < num_active) {
+      poller->Work(1s, []() {});
+      ++work_calls;
+    }
+  }
+  state.SetItemsProcessed(num_active * state.iterations());
+  state.counters["work_calls_per_iteration"] = benchmark::Counter(
+      static_cast<double>(work_calls) / state.iterations());
+  for (auto& c : connections) {
+    c.handle->ShutdownHandle(absl::CancelledError("benchmark done"));
+    c.handle->OrphanHandle(nullptr, nullptr, "benchmark done");
+    close(c.write_fd);
+    delete c.on_read;
+  }
+}
+
+void BM_Epoll1Poller(benchmark::State& state) {
+  InlineScheduler scheduler;
+  RunPollerBenchmark(state, MakeEpoll1Poller(&scheduler));
+}
+BENCHMARK(BM_Epoll1Poller)
+    ->ArgsProduct({{64, 1024, 8192}, {1, 16, 64}})
+    ->UseRealTime();
+
+void BM_IoUringPoller(benchmark::State& state) {
+  InlineScheduler scheduler;
+  RunPollerBenchmark(state, MakeIoUringPoller(&scheduler));
+}
+BENCHMARK(BM_IoUringPoller)
+    ->ArgsProduct({{64, 1024, 8192}, {1, 16, 64}})
+    ->UseRealTime();
+
+}  // namespace
+
+#endif  // GRPC_LINUX_EPOLL
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -47,6 +47,23 @@ BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, MinInProcess)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinTCP)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinUDS)->Arg(0);
 BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, MinInProcess)->Arg(0);
+// Streams of small messages, such as telemetry, where per-message framing
+// rather than bytes dominates. Compare runs with
+// GRPC_EXPERIMENTS=chttp2_pack_small_messages.
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, TCP)
+    ->Arg(16)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, TCP)
+    ->Arg(16)
+    ->Arg(32)
+    ->Arg(128)
+    ->Arg(256);
+BENCHMARK_TEMPLATE(BM_PumpStreamClientToServer, RxZerocopyTCP)
+    ->Range(1024 * 1024, 128 * 1024 * 1024);
+BENCHMARK_TEMPLATE(BM_PumpStreamServerToClient, RxZerocopyTCP)
+    ->Range(1024 * 1024, 128 * 1024 * 1024);
 
 }  // namespace testing
 }  // namespace grpc
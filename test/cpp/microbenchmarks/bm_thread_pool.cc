@@ -24,7 +24,9 @@
 #include "absl/log/check.h"
 #include "absl/strings/str_format.h"
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/useful.h"
@@ -35,8 +37,10 @@
 namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::CpuTopology;
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::ThreadPool;
+using ::grpc_event_engine::experimental::WorkStealingThreadPool;
 
 struct FanoutParameters {
   int depth;
@@ -239,6 +243,69 @@ void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
 }
 BENCHMARK(BM_ThreadPool_Closure_FanOut)->Apply(FanoutTestArguments);
 
+// Measures how far closures travel when they are stolen. Every producer
+// closure queues a batch of small closures on its worker's local queue, where
+// idle workers steal them from.
+//
+// Arguments: whether to use the topology of the machine (0) or to pretend
+// that its CPUs are split over two NUMA nodes (1), and whether to pin the
+// worker threads.
+void BM_ThreadPool_TopologyAwareStealing(benchmark::State& state) {
+  const bool split_nodes = state.range(0) != 0;
+  const bool pin_threads = state.range(1) != 0;
+  const CpuTopology* topology = &CpuTopology::Get();
+  std::unique_ptr<CpuTopology> split_topology;
+  if (split_nodes) {
+    std::vector<CpuTopology::Cpu> cpus = topology->cpus();
+    const size_t half = (cpus.size() + 1) / 2;
+    for (size_t i = 0; i < cpus.size(); ++i) {
+      cpus[i].node = i < half ? 0 : 1;
+      cpus[i].cache_domain = cpus[i].node;
+    }
+    split_topology = std::make_unique<CpuTopology>(std::move(cpus));
+    topology = split_topology.get();
+  }
+  const size_t num_threads =
+      grpc_core::Clamp<size_t>(topology->cpus().size(), 2, 64);
+  WorkStealingThreadPool pool(num_threads, topology, pin_threads);
+  constexpr int kProducers = 64;
+  constexpr int kClosuresPerProducer = 64;
+  std::atomic<int> runs{0};
+  for (auto _ : state) {
+    runs.store(0, std::memory_order_relaxed);
+    grpc_core::Notification done;
+    for (int i = 0; i < kProducers; ++i) {
+      pool.Run([&pool, &runs, &done] {
+        for (int j = 0; j < kClosuresPerProducer; ++j) {
+          pool.Run([&runs, &done] {
+            if (runs.fetch_add(1, std::memory_order_relaxed) + 1 ==
+                kProducers * kClosuresPerProducer) {
+              done.Notify();
+            }
+          });
+        }
+      });
+    }
+    done.WaitForNotification();
+  }
+  pool.Quiesce();
+  const auto steals = pool.steal_counts();
+  const double total_steals =
+      steals.same_cache + steals.same_node + steals.cross_node;
+  state.SetItemsProcessed(kProducers * kClosuresPerProducer *
+                          state.iterations());
+  state.counters["steals_per_iteration"] =
+      benchmark::Counter(total_steals / state.iterations());
+  state.counters["cross_node_steal_rate"] = benchmark::Counter(
+      total_steals == 0 ? 0 : steals.cross_node / total_steals);
+  state.counters["same_cache_steal_rate"] = benchmark::Counter(
+      total_steals == 0 ? 0 : steals.same_cache / total_steals);
+}
+BENCHMARK(BM_ThreadPool_TopologyAwareStealing)
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
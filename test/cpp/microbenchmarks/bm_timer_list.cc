@@ -0,0 +1,179 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the insert, cancel and expire throughput of the posix EventEngine
+// timer lists: the heap based TimerList and the TimerWheel, in its exact and
+// coarse modes. Time is simulated, so that only the data structures are
+// measured.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/impl/grpc_library.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerListInterface;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+class FakeHost : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(now_ms);
+  }
+  void Kick() override {}
+
+  int64_t now_ms = 1;
+};
+
+class NoopClosure : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+enum class Kind { kHeap, kWheel, kCoarseWheel };
+
+std::unique_ptr<TimerListInterface> MakeTimerList(Kind kind,
+                                                  TimerListHost* host) {
+  switch (kind) {
+    case Kind::kHeap:
+      return std::make_unique<TimerList>(host);
+    case Kind::kWheel:
+      return std::make_unique<TimerWheel>(host);
+    case Kind::kCoarseWheel:
+      return std::make_unique<TimerWheel>(host, /*coarse=*/true);
+  }
+  return nullptr;
+}
+
+// Random timeouts between 1ms and a minute, log-uniformly distributed: most
+// timers are short, but some (e.g. keepalives and deadlines) are long.
+std::vector<int64_t> MakeTimeouts(size_t n) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> exponent(0, 16);
+  std::vector<int64_t> timeouts(n);
+  for (auto& timeout : timeouts) {
+    timeout = static_cast<int64_t>(std::exp2(exponent(rng))) % 60000 + 1;
+  }
+  return timeouts;
+}
+
+// Inserts timers and cancels them all before they fire: the common case for
+// RPC deadlines.
+void BM_InsertCancel(benchmark::State& state, Kind kind) {
+  const size_t num_timers = state.range(0);
+  FakeHost host;
+  auto timer_list = MakeTimerList(kind, &host);
+  std::vector<Timer> timers(num_timers);
+  NoopClosure closure;
+  const auto timeouts = MakeTimeouts(num_timers);
+  for (auto _ : state) {
+    for (size_t i = 0; i < num_timers; ++i) {
+      timer_list->TimerInit(
+          &timers[i],
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+              host.now_ms + timeouts[i]),
+          &closure);
+    }
+    for (size_t i = 0; i < num_timers; ++i) {
+      CHECK(timer_list->TimerCancel(&timers[i]));
+    }
+  }
+  state.SetItemsProcessed(num_timers * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_InsertCancel, heap, Kind::kHeap)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+BENCHMARK_CAPTURE(BM_InsertCancel, wheel, Kind::kWheel)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+BENCHMARK_CAPTURE(BM_InsertCancel, coarse_wheel, Kind::kCoarseWheel)
+    ->RangeMultiplier(8)
+    ->Range(8, 32768);
+
+// Inserts timers and advances time, one millisecond per check, until all of
+// them fired.
+void BM_InsertExpire(benchmark::State& state, Kind kind) {
+  const size_t num_timers = state.range(0);
+  FakeHost host;
+  auto timer_list = MakeTimerList(kind, &host);
+  std::vector<Timer> timers(num_timers);
+  NoopClosure closure;
+  const auto timeouts = MakeTimeouts(num_timers);
+  int64_t checks = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < num_timers; ++i) {
+      timer_list->TimerInit(
+          &timers[i],
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+              host.now_ms + timeouts[i]),
+          &closure);
+    }
+    size_t fired = 0;
+    while (fired < num_timers) {
+      ++host.now_ms;
+      auto expired = timer_list->TimerCheck(nullptr);
+      CHECK(expired.has_value());
+      fired += expired->size();
+      ++checks;
+    }
+  }
+  state.SetItemsProcessed(num_timers * state.iterations());
+  state.counters["checks_per_iteration"] =
+      benchmark::Counter(static_cast<double>(checks) / state.iterations());
+}
+BENCHMARK_CAPTURE(BM_InsertExpire, heap, Kind::kHeap)
+    ->RangeMultiplier(8)
+    ->Range(512, 32768);
+BENCHMARK_CAPTURE(BM_InsertExpire, wheel, Kind::kWheel)
+    ->RangeMultiplier(8)
+    ->Range(512, 32768);
+BENCHMARK_CAPTURE(BM_InsertExpire, coarse_wheel, Kind::kCoarseWheel)
+    ->RangeMultiplier(8)
+    ->Range(512, 32768);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -286,6 +286,25 @@ typedef MinStackize<UDS> MinUDS;
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 
+class RxZerocopyConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+// TCP with TCP_ZEROCOPY_RECEIVE enabled on both ends.
+class RxZerocopyTCP : public TCP {
+ public:
+  explicit RxZerocopyTCP(Service* service)
+      : TCP(service, RxZerocopyConfiguration()) {}
+};
+
 }  // namespace testing
 }  // namespace grpc
 